@@ -14,4 +14,7 @@ namespace vpux::VPUIP::arch37xx {
 int64_t computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params, VPUNN::VPUCostModel& costModel,
                          LogCb logCb = emptyLogCb);
 
+SmallVector<int64_t> computeSplitPoolCosts(ArrayRef<WorkloadSplit> splits, const WorkloadCostParams& params,
+                                           VPUNN::VPUCostModel& costModel, LogCb logCb = emptyLogCb);
+
 }  // namespace vpux::VPUIP::arch37xx
@@ -13,6 +13,7 @@
 #include "vpux/compiler/utils/attributes.hpp"
 #include "vpux/compiler/utils/stl_extras.hpp"
 
+#include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/dense_map.hpp"
 #include "vpux/utils/core/small_string.hpp"
 
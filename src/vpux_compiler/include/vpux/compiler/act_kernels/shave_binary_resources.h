@@ -7,14 +7,27 @@
 #include <llvm/ADT/StringRef.h>
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/format.hpp"
+#include "vpux/utils/core/small_vector.hpp"
 
 #include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 extern std::unordered_map<std::string, const std::pair<const uint8_t*, size_t>> shaveBinaryResourcesMap;
 
 namespace vpux {
 
+// Entry point and sections of a kernel ELF, the sections point into the embedded binary
+struct ShaveKernelInfo final {
+    uint32_t entryPoint = 0;
+    SmallVector<std::pair<std::string, llvm::ArrayRef<uint8_t>>> sections;
+
+    // Returns the section with one of the given names
+    llvm::ArrayRef<uint8_t> getSection(llvm::ArrayRef<llvm::StringRef> possibleNames) const;
+};
+
 class ShaveBinaryResources {
 public:
     static const ShaveBinaryResources& getInstance();
@@ -78,6 +91,14 @@ public:
     }
 
     llvm::ArrayRef<uint8_t> getElf(llvm::StringRef kernelPath) const;
+
+    // `elfBlob` must be a binary returned by getElf. It is parsed on the first request only,
+    // so the entry point and the sections of a kernel are not looked up in the ELF for every operation
+    const ShaveKernelInfo& getKernelInfo(llvm::ArrayRef<uint8_t> elfBlob) const;
+
+private:
+    mutable std::mutex _kernelInfoMutex;
+    mutable std::unordered_map<const uint8_t*, ShaveKernelInfo> _kernelInfoCache;
 };
 
 }  // namespace vpux
@@ -19,7 +19,12 @@ namespace vpux::bitc {
 
 class Encoder {
 public:
+    // Runs `body(index)` for every index in [0, count), the calls may run concurrently
+    using ParallelFor = std::function<void(size_t count, const std::function<void(size_t)>& body)>;
+
     Encoder();
+    // Independent chunks of the input blocks are encoded through `parallel_for`
+    explicit Encoder(ParallelFor parallel_for);
     void encode(const BitCompactorConfig& config, const std::vector<uint8_t>& in, std::vector<uint8_t>& out);
     ~Encoder();
 
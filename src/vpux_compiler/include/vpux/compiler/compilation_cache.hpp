@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "intel_npu/al/icompiler.hpp"
+
+#include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
+#include "vpux/utils/core/logger.hpp"
+
+#include <llvm/ADT/SmallString.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace vpux {
+
+//
+// CompilationCache
+//
+
+// Persistent, content-addressed cache of compiled blobs.
+//
+// The key is a digest of the serialized model (topology and weights), the options which affect the compiled blob,
+// the target arch and the compiler version. Only the blob is stored: on a hit the metadata is re-parsed from it, which is
+// cheap compared to running the import, the pass pipeline and the export.
+//
+// Entries are written to a unique temporary file and renamed into place, so several processes may share one cache
+// directory. Entries older than `maxAge` are removed and the least recently used ones are evicted once the total
+// size exceeds `maxSize`. Eviction only considers the entries and the temporary files of the cache, other files
+// in the directory are left intact.
+//
+// The cache is configured with the following environment variables:
+//   * IE_NPU_COMPILATION_CACHE_DIR - cache directory, the cache is disabled when it is not set;
+//   * IE_NPU_COMPILATION_CACHE_MAX_SIZE_MB - size limit of the directory (4096 MB by default);
+//   * IE_NPU_COMPILATION_CACHE_MAX_AGE_HOURS - lifetime of an unused entry (168 hours by default).
+
+class CompilationCache final {
+public:
+    struct Statistics final {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t stores = 0;
+        size_t evictions = 0;
+    };
+
+public:
+    // Returns the cache configured by the environment or `std::nullopt` if caching is disabled
+    static std::optional<CompilationCache> fromEnv(Logger log);
+
+    CompilationCache(StringRef directory, uint64_t maxSize, std::chrono::seconds maxAge, Logger log);
+
+public:
+    static std::string computeKey(const std::shared_ptr<ov::Model>& model, const intel_npu::Config& config,
+                                  VPU::ArchKind arch);
+
+    std::optional<std::vector<uint8_t>> lookup(StringRef key) const;
+    void store(StringRef key, const std::vector<uint8_t>& blob) const;
+
+    // Removes expired entries and shrinks the directory down to the size limit
+    void evict() const;
+
+    static Statistics getStatistics();
+
+private:
+    llvm::SmallString<128> getEntryPath(StringRef key) const;
+
+private:
+    llvm::SmallString<128> _directory;
+    uint64_t _maxSize;
+    std::chrono::seconds _maxAge;
+    Logger _log;
+};
+
+}  // namespace vpux
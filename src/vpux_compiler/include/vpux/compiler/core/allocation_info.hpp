@@ -19,9 +19,12 @@
 
 namespace vpux {
 
+// With `enableOfflinePlacement` the buffers are placed again once all their live ranges are known
+// and the new addresses are used if they reduce the peak memory usage
 std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> runLinearScan(
         mlir::func::FuncOp funcOp, MemLiveRangeInfo& liveRangeInfo, const AsyncDepsInfo& depsInfo,
-        VPU::MemoryKind memKind, Logger log, ArrayRef<std::pair<vpux::AddressType, vpux::AddressType>> vec = {});
+        VPU::MemoryKind memKind, Logger log, ArrayRef<std::pair<vpux::AddressType, vpux::AddressType>> vec = {},
+        bool enableOfflinePlacement = false);
 
 //
 // AllocationInfo
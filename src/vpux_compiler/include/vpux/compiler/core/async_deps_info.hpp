@@ -32,8 +32,8 @@ public:
     mlir::async::ExecuteOp getExecuteOpAtIndex(size_t opIdx) const;
     const llvm::SmallVector<size_t> getOpDeps(size_t opIdx) const;
     const llvm::SmallVector<size_t> getConsumerOps(size_t opIdx) const;
-    std::unordered_map<size_t, size_t> calculateOpInDegreeTable() const;
-    std::unordered_map<size_t, size_t> calculateOpOutDegreeTable() const;
+    SmallVector<size_t> calculateOpInDegreeTable() const;
+    SmallVector<size_t> calculateOpOutDegreeTable() const;
     uint32_t getIndex(mlir::async::ExecuteOp execOp) const;
 
 private:
@@ -10,6 +10,7 @@
 #include "vpux/utils/core/func_ref.hpp"
 #include "vpux/utils/core/logger.hpp"
 #include "vpux/utils/core/small_vector.hpp"
+#include "vpux/utils/core/sorted_vector_set.hpp"
 
 #include <mlir/Dialect/Async/IR/Async.h>
 #include <mlir/IR/BuiltinOps.h>
@@ -24,8 +25,9 @@ class BarrierInfo {
 public:
     // TaskSet is used to store barrier's producer/consumer task op index as well as task op's
     // wait/update barrier index, which is supposed to have better performance than BitVector when the data size is
-    // small.
-    using TaskSet = llvm::SmallSet<size_t, 16>;
+    // small. Indices are kept sorted in a flat vector, so the sets of barriers with many producers stay contiguous
+    // and are merged linearly.
+    using TaskSet = SortedVectorSet<size_t, 16>;
     explicit BarrierInfo();
     explicit BarrierInfo(mlir::func::FuncOp func);
     friend class BarrierInfoTest;
@@ -56,12 +58,29 @@ private:
     void optimizeBarrierConsumers(size_t blockIdx);
     void optimizeBarriersWithSameProducers(size_t blockIdx, bool checkValidSlotCount = true);
 
+    // Optimizations of a control graph block are split into the analysis, which only reads the barrier maps,
+    // and the update of the maps. Blocks share only the sync points, so the analyses of all blocks can run
+    // in parallel and their results are applied afterwards.
+    struct BlockTaskBarriers {
+        size_t firstTaskInd = 0;
+        SmallVector<TaskSet> barriers;
+    };
+    using BarrierMerges = SmallVector<std::pair<size_t, size_t>>;
+
+    void forEachControlGraphBlock(FuncRef<void(size_t)> func);
+    BlockTaskBarriers getOptimizedUpdateBarriers(size_t blockIdx);
+    BlockTaskBarriers getOptimizedWaitBarriers(size_t blockIdx);
+    BarrierMerges getBarriersWithSameProducers(size_t blockIdx, bool checkValidSlotCount);
+    void setBlockUpdateBarriers(const BlockTaskBarriers& blockBarriers);
+    void setBlockWaitBarriers(const BlockTaskBarriers& blockBarriers);
+    void mergeBarriers(const BarrierMerges& merges);
+
     bool inRange(const unsigned low, const unsigned high, const unsigned val) const;
     void setBarrierMask(llvm::BitVector& mask, const BarrierInfo::TaskSet& barriers, size_t offset = 0);
     void splitBarrierProducers(VPURT::DeclareVirtualBarrierOp barrierOp, size_t availableSlots);
     void splitBarrierConsumers(VPURT::DeclareVirtualBarrierOp barrierOp, size_t availableSlots);
-    SmallVector<BarrierInfo::TaskSet> createProducerBatches(const BarrierInfo::TaskSet& waitBarriers,
-                                                            size_t availableSlots);
+    SmallVector<size_t> getBarriersInIROrder(const TaskSet& barriers, mlir::ValueRange irBarriers) const;
+    SmallVector<BarrierInfo::TaskSet> createProducerBatches(ArrayRef<size_t> waitBarriers, size_t availableSlots);
     void linearizeLegalParallelProducers(size_t taskInd, const BarrierInfo::TaskSet& parallelProducers,
                                          const BarrierInfo::TaskSet& parallelConsumers, size_t availableSlots);
     bool canMergeBarriersForTasks(const BarrierInfo::TaskSet& producers, size_t availableSlots);
@@ -86,6 +105,8 @@ public:
     size_t addNewBarrier(VPURT::DeclareVirtualBarrierOp barrierOp);
     bool controlPathExistsBetweenTasksInSameBlock(const SmallVector<llvm::BitVector>& taskControlMap, size_t taskAInd,
                                                   size_t taskBInd, bool biDirection = true) const;
+    void updateTaskControlMap(SmallVector<llvm::BitVector>& taskControlMap, size_t controlMapOffset,
+                              const TaskSet& producers, const TaskSet& consumers) const;
     size_t getProducerSlotCount(VPURT::DeclareVirtualBarrierOp barrierOp);
     size_t getConsumerSlotCount(VPURT::DeclareVirtualBarrierOp barrierOp);
     void addProducer(size_t barrierInd, size_t taskInd);
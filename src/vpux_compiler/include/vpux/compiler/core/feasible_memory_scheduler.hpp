@@ -11,6 +11,8 @@
 #include "vpux/compiler/core/mem_live_range_info.hpp"
 #include "vpux/compiler/utils/partitioner.hpp"
 
+#include "vpux/utils/core/dense_index_set.hpp"
+
 namespace vpux {
 
 class FeasibleMemoryScheduler final {
@@ -361,6 +363,8 @@ private:
     QueueType getQueueType(operationIdxType opIdx);
     size_t getCurrentCycle(operationIdxType opIdx, bool spilled = false);
     void insertInOpIdxCycleEndMap(const operationIdxType& opIdx, const size_t& endCycle);
+    bool hasOpIdxCycleEnd(operationIdxType opIdx) const;
+    size_t getOpIdxCycleEnd(operationIdxType opIdx);
     size_t getEarliestComputeBeginCycle(operationIdxType opIdx);
     // Based on operation/buffer properties determine how many executor instances are needed
     // to run given operation
@@ -443,12 +447,14 @@ private:
     std::set<HeapElement, CycleBeginMinHeapOrdering> _cycleBeginHeap;
     // heap with earliest operation end cycle
     std::set<HeapElement, CycleEndMinHeapOrdering> _cycleEndHeap;
+    // number of operations in the cycle end heap per queue
+    std::map<QueueType, size_t> _cycleEndHeapQueueSize;
     // compute operations with 0 in-degree, optimal to schedule, that strictly preserve IR order
-    std::set<operationIdxType, operationIdxSort> _readyComputeOps;
+    DenseIndexSet _readyComputeOps;
     // compute DMA operations with 0 in-degree, that do not necessarily preserve IR order
-    std::set<operationIdxType, operationIdxSort> _readyDMAOps;
+    DenseIndexSet _readyDMAOps;
     // data operations with 0 in-degree
-    std::set<operationIdxType, operationIdxSort> _readyDataOps;
+    DenseIndexSet _readyDataOps;
     // spilled operation which are ready to be rescheduled
     mlir::DenseMap<mlir::Value, operationIdxType> _readySpilledOps;
     // store operation spilled buffers
@@ -457,13 +463,11 @@ private:
     // input to output. Such operations need to be distinguished from other ops as scheduler
     // is focused on scheduling ops along compute chain. Such operation will only be considered
     // for scheduling once all input dependency data and/or compute ops have been executed
-    std::set<operationIdxType, operationIdxSort> _nonComputeChainOps;
-    // operation in-degree, number of incoming edges
-    std::unordered_map<operationIdxType, size_t> _inDegreeTable;
-    // operation out-degree, number of outgoing edges
-    std::unordered_map<operationIdxType, size_t> _outDegreeTable;
-    // level of DMAs corresponding to how many DPUs will execute before this DMA is needed
-    mlir::DenseMap<operationIdxType, size_t> _dataOpLevels;
+    DenseIndexSet _nonComputeChainOps;
+    // operation in-degree, number of incoming edges, indexed by operation index
+    SmallVector<size_t> _inDegreeTable;
+    // operation out-degree, number of outgoing edges, indexed by operation index
+    SmallVector<size_t> _outDegreeTable;
     // contains the operation writing to the buffer
     mlir::DenseMap<mlir::Value, operationIdxType> _bufferProducer;
     // contains last used cycle of buffer
@@ -494,7 +498,8 @@ private:
     // space
     mlir::DenseMap<mlir::Value, SmallVector<operationIdxType>> _bufferOpIdxMap;
 
-    mlir::DenseMap<operationIdxType, size_t> _opIdxEndCycleMap;
+    // end cycle of the scheduled operations, indexed by operation index
+    SmallVector<std::optional<size_t>> _opIdxEndCycle;
 
     std::set<EvictionCandidate, EvictionPriority> _evictionCandidatesCache;
 
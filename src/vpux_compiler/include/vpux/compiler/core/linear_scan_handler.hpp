@@ -48,6 +48,8 @@ public:
     static int getSpillWeight(mlir::Value);
     static bool spilled(mlir::Value);
     void setAddress(mlir::Value val, AddressType address);
+    // Moves the allocated values to the new addresses and updates the max allocated size
+    void relocate(ArrayRef<std::pair<mlir::Value, AddressType>> addresses);
 
 private:
     DenseMap<mlir::Value, AddressType> _valOffsets;
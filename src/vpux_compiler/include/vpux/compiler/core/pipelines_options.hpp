@@ -42,7 +42,8 @@ struct ReferenceSWOptions : mlir::PassPipelineOptions<T> {
 
     IntOption constantFoldingInBackgroundNumThreads{
             *this, "constant-folding-in-background-num-threads",
-            llvm::cl::desc("Number of background threads to use for constant folding in background. Ignored if "
+            llvm::cl::desc("Maximum number of concurrent constant folding tasks in background, used when the "
+                           "folding threads cannot run with idle OS priority. Ignored if "
                            "`constant-folding-in-background` is disabled."),
             llvm::cl::init(1)};
 
@@ -284,7 +285,8 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
 
     IntOption constantFoldingInBackgroundNumThreads{
             *this, "constant-folding-in-background-num-threads",
-            llvm::cl::desc("Number of background threads to use for constant folding in background. Ignored if "
+            llvm::cl::desc("Maximum number of concurrent constant folding tasks in background, used when the "
+                           "folding threads cannot run with idle OS priority. Ignored if "
                            "`constant-folding-in-background` is disabled."),
             llvm::cl::init(1)};
 
@@ -490,7 +492,8 @@ struct DefaultHWOptionsBase : mlir::PassPipelineOptions<DefaultHWOptionsBase> {
 
     IntOption constantFoldingInBackgroundNumThreads{
             *this, "constant-folding-in-background-num-threads",
-            llvm::cl::desc("Number of background threads to use for constant folding in background. Ignored if "
+            llvm::cl::desc("Maximum number of concurrent constant folding tasks in background, used when the "
+                           "folding threads cannot run with idle OS priority. Ignored if "
                            "`constant-folding-in-background` is disabled."),
             llvm::cl::init(1)};
 
@@ -546,6 +549,16 @@ struct DefaultHWOptionsBase : mlir::PassPipelineOptions<DefaultHWOptionsBase> {
                                 llvm::cl::desc("Enable vertical fusion pipelining pass and schedule pipelining"),
                                 llvm::cl::init(true)};
 
+    IntOption numStrategyReplicas{*this, "strategy-replicas",
+                                  llvm::cl::desc("Number of simulated annealing replicas used by the strategy "
+                                                 "manager. Parallel tempering is used for more than one replica"),
+                                  llvm::cl::init(1)};
+
+    BoolOption enableExactStrategySolver{
+            *this, "exact-strategy-solver",
+            llvm::cl::desc("Solve chain, tree and series-parallel regions exactly in the strategy manager"),
+            llvm::cl::init(false)};
+
     StrOption computeLayersWithHigherPrecision{
             *this, "compute-layers-with-higher-precision",
             llvm::cl::desc("Enable compute layers with higher precision for the specified layer types"),
@@ -635,6 +648,16 @@ struct MCAndTilingOptionsBase : mlir::PassPipelineOptions<MCAndTilingOptionsBase
             llvm::cl::desc("Enable DistributedTensorAttr with explicit per cluster memory/compute shapes & offsets"),
             llvm::cl::init(false)};
 
+    IntOption numStrategyReplicas{*this, "strategy-replicas",
+                                  llvm::cl::desc("Number of simulated annealing replicas used by the strategy "
+                                                 "manager. Parallel tempering is used for more than one replica"),
+                                  llvm::cl::init(1)};
+
+    BoolOption enableExactStrategySolver{
+            *this, "exact-strategy-solver",
+            llvm::cl::desc("Solve chain, tree and series-parallel regions exactly in the strategy manager"),
+            llvm::cl::init(false)};
+
     MCAndTilingOptionsBase() = default;
 
     template <class OtherOptions>
@@ -648,6 +671,8 @@ struct MCAndTilingOptionsBase : mlir::PassPipelineOptions<MCAndTilingOptionsBase
         readStrategyFromJson = options.readStrategyFromJson;
         writeStrategyToJson = options.writeStrategyToJson;
         enableExplicitDistributedTensorAttr = options.enableExplicitDistributedTensorAttr;
+        numStrategyReplicas = options.numStrategyReplicas;
+        enableExactStrategySolver = options.enableExactStrategySolver;
     }
 };
 
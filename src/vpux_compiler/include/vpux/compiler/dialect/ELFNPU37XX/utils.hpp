@@ -49,9 +49,6 @@ struct DenseMapInfo<RelocKey37XX> {
 namespace vpux {
 namespace ELFNPU37XX {
 
-std::pair<const uint8_t*, size_t> getDataAndSizeOfElfSection(llvm::ArrayRef<uint8_t> elfBlob,
-                                                             const std::vector<std::string> possibleSecNames);
-
 using OffsetCache = mlir::DenseMap<mlir::Value, mlir::DenseMap<mlir::Value, size_t>>;
 size_t getOffsetOfOpInSection(mlir::Value op, mlir::Value section, OffsetCache& cache);
 size_t getOffsetOfOpInSection(mlir::Value& op);
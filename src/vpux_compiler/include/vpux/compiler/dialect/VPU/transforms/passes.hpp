@@ -93,6 +93,16 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
             *this, "enable-shave-ddr-access-optimization",
             llvm::cl::desc("SHAVE DDR access optimization option (true, false or auto)"), llvm::cl::init("true")};
 
+    IntOption numStrategyReplicas{*this, "strategy-replicas",
+                                  llvm::cl::desc("Number of simulated annealing replicas used by the strategy "
+                                                 "manager. Parallel tempering is used for more than one replica"),
+                                  llvm::cl::init(1)};
+
+    BoolOption enableExactStrategySolver{
+            *this, "exact-strategy-solver",
+            llvm::cl::desc("Solve chain, tree and series-parallel regions exactly in the strategy manager"),
+            llvm::cl::init(false)};
+
     // Extended Tiling options - Incremental Pipeline
     BoolOption readStrategyFromJson{*this, "read-strategy-from-json",
                                     llvm::cl::desc("Read the multiclustering and tiling strategy from a JSON file"),
@@ -114,6 +124,8 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
         enableShaveDDRAccessOptimization = options.enableShaveDDRAccessOptimization;
         readStrategyFromJson = options.readStrategyFromJson;
         writeStrategyToJson = options.writeStrategyToJson;
+        numStrategyReplicas = options.numStrategyReplicas;
+        enableExactStrategySolver = options.enableExactStrategySolver;
     }
 };
 
@@ -315,6 +327,8 @@ std::unique_ptr<mlir::Pass> createEnsureNCEOpsSizeRequirementsPass(Logger log =
 std::unique_ptr<mlir::Pass> createFuseClampPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createOptimizeConcatPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createStrategyManagerImplPass(bool enablePrefetchTiling = true,
+                                                          int64_t numStrategyReplicas = 1,
+                                                          bool enableExactStrategySolver = false,
                                                           Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createEfficientIROrderPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createRemoveOutputSparseToAvoidSuboptimalDPUWorkloadsPass(Logger log = Logger::global());
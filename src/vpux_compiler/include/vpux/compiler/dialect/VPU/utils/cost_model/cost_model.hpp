@@ -12,6 +12,7 @@
 #include <vpu_layer_cost_model.h>
 
 #include <memory>
+#include <string>
 
 namespace vpux {
 
@@ -25,8 +26,27 @@ static constexpr uint32_t UNIT_COST = 1;
 static constexpr uint32_t INVALID_COST_BASE = MAX_VAL - 100;
 static constexpr uint32_t ERROR_INPUT_TOO_BIG = MAX_VAL - 0;
 
+// The cost models are deserialized once per thread and shared by all the passes executed on that thread. VPUNN models
+// keep mutable inference buffers and workload caches, so an instance must not be used by several threads concurrently.
 std::shared_ptr<VPUNN::VPUCostModel> createCostModel(ArchKind arch);
 std::shared_ptr<VPUNN::VPULayerCostModel> createLayerCostModel(ArchKind arch, bool isFastModel = true);
+
+// Memoized VPUNN queries. For the models returned by createCostModel / createLayerCostModel, identical queries from any
+// pass or thread run the inference only once per process. Error codes are not memoized, so `info` is always filled in
+// for them.
+VPUNN::CyclesInterfaceType getDPUWorkloadCost(VPUNN::VPUCostModel& costModel, const VPUNN::DPUWorkload& workload,
+                                              std::string& info);
+VPUNN::CyclesInterfaceType getDPULayerCost(VPUNN::VPULayerCostModel& costModel, VPUNN::DPULayer& layer,
+                                           const VPUNN::VPULayerStrategy& strategy);
+
+// Batched versions of the queries above. Identical workloads / layers of the batch are evaluated only once and the
+// costs are scattered back in the order of the queries. `infos` receives the VPUNN debug info for each workload.
+SmallVector<VPUNN::CyclesInterfaceType> getDPUWorkloadCosts(VPUNN::VPUCostModel& costModel,
+                                                            ArrayRef<VPUNN::DPUWorkload> workloads,
+                                                            SmallVectorImpl<std::string>& infos);
+SmallVector<VPUNN::CyclesInterfaceType> getDPULayerCosts(VPUNN::VPULayerCostModel& costModel,
+                                                         MutableArrayRef<VPUNN::DPULayer> layers,
+                                                         const VPUNN::VPULayerStrategy& strategy);
 uint32_t checkAndReturnCost(const VPUNN::CyclesInterfaceType& cost, vpux::Logger log, bool beSilent = false);
 void printVPUNNLayerConfig(const VPUNN::DPULayer& layer, const VPUNN::VPULayerStrategy& strategy, vpux::Logger log);
 void printVPUNNWorkloadConfig(const VPUNN::DPUWorkload& wl, LogCb logCb = globalLogCb);
@@ -24,6 +24,10 @@ struct VPUNNCostParameters {
     SmallVector<SmallVector<TileInfo>> _operandsTiling;
 };
 
+/*
+ *  Temporarily assigns the strategy to the operation for the utilities which read it from the IR,
+ *  e.g. the CMX requirement checks. LayerVPUNNCost takes the strategy as a parameter and doesn't use it
+ */
 class MultiClusterStrategySetter {
 public:
     MultiClusterStrategySetter(mlir::Operation* operation, VPU::MultiClusterStrategy strategy);
@@ -47,6 +51,8 @@ private:
 /*
  *  Class adaptor to get cost from VPUNN
  *  for DPU, SW layers
+ *  The evaluated strategy is passed in the parameters, the operations are not modified,
+ *  so the costs of different operations can be calculated concurrently by instances created on each thread
  */
 
 class LayerVPUNNCost final {
@@ -121,12 +121,14 @@ bool isStrategyCompatibleShape(VPU::ClusteredOpInterface clusteredOp, const vpux
 bool isStrategySOXCompatible(VPU::ClusteredOpInterface clusteredOp, VPU::MultiClusterStrategy strategy,
                              size_t numTiles);
 
+// When tileTypesForStrategy is set, tilesTypes are built for mcStrategy and not for the strategy attribute of the op
 SmallVector<uint32_t> getDPUCostForNCEOp(VPU::NCEOpInterface nceOp, VPU::MultiClusterStrategy mcStrategy,
                                          const OutputTiling& outTiles,
                                          SmallVector<SmallVector<NDTypeInterface>>& tilesTypes,
                                          const VPUIP::WorkloadCostParams& costParams,
                                          VPUNN::VPULayerStrategy vpunnStrategy,
-                                         const std::shared_ptr<VPUNN::VPULayerCostModel>& vpunnCostModel, Logger log);
+                                         const std::shared_ptr<VPUNN::VPULayerCostModel>& vpunnCostModel, Logger log,
+                                         bool tileTypesForStrategy = false);
 
 SmallVector<uint32_t> getPerTileWeightsDMACosts(VPU::NCEOpInterface nceOp,
                                                 ArrayRef<SmallVector<NDTypeInterface>> tilesTypes,
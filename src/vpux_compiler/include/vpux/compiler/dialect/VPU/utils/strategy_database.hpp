@@ -0,0 +1,102 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/core/tiling.hpp"
+#include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
+
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <llvm/ADT/StringMap.h>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace vpux::VPU {
+
+/*
+   Structural key of the operation for the strategy database.
+   It covers the operation name, the types (shape, element type, layout, memory space) of the operands and results,
+   the attributes except the strategy ones and the names and result types of the producers and consumers.
+   Locations are not included, so the same layer gets the same key in a different model.
+   `context` distinguishes the passes and the options which affect the choice, e.g. arch, number of tiles.
+   The tiling strategy attribute is never a part of the key. The multi-cluster strategy is included with
+   `withMCStrategy`, for the passes which choose the tiling for the multi-cluster strategy assigned before
+*/
+std::string getStrategyDatabaseKey(mlir::Operation* op, StringRef context, bool withMCStrategy = false);
+
+/*
+   Strategy chosen for the operation by one of the strategy passes
+*/
+struct StrategyRecord {
+    std::optional<MultiClusterStrategy> mcStrategy;
+    // Empty when the operation isn't tiled
+    SmallVector<int64_t> tilingStrategy;
+    TilingMode tilingMode = TilingMode::ISOLATED;
+    // Day (since the Unix epoch) of the last lookup or update, the least recently used records are pruned first.
+    // It isn't a part of the strategy, so it doesn't take part in the comparison
+    int64_t lastUseDay = 0;
+
+    bool operator==(const StrategyRecord& other) const {
+        return mcStrategy == other.mcStrategy && tilingStrategy == other.tilingStrategy &&
+               tilingMode == other.tilingMode;
+    }
+};
+
+/*
+   Output tiles of the tiling strategy stored in the record. Fails when the strategy doesn't match the rank
+   of the output or the operation doesn't support the tiles in the stored mode, e.g. for an edited entry.
+   An empty tiling strategy gives empty tiles
+*/
+mlir::FailureOr<OutputTiling> getRecordTiling(mlir::Operation* op, const StrategyRecord& record, Logger log);
+
+/*
+   Persistent storage of the strategies chosen in previous compilations, keyed by getStrategyDatabaseKey.
+   The strategy passes look the operations up first and run the cost search only for the unknown ones,
+   so models which share most of their layers (fine-tuned variants, re-exports) skip most of the search.
+   The database is a JSON file. It is shared by all the passes of the process which use the same file,
+   and on save the entries written by other processes in the meantime are merged in.
+   The file keeps at most `maxRecords` entries, the least recently used ones are dropped on save
+*/
+class StrategyDatabase final {
+public:
+    static constexpr int64_t VERSION = 1;
+    static constexpr size_t DEFAULT_MAX_RECORDS = 1 << 16;
+
+public:
+    explicit StrategyDatabase(StringRef fileName, Logger log = Logger::global(),
+                              size_t maxRecords = DEFAULT_MAX_RECORDS);
+
+    // Process-wide instance for the file, loaded on the first call
+    static std::shared_ptr<StrategyDatabase> get(StringRef fileName, Logger log = Logger::global());
+
+    // A hit refreshes the last use of the record
+    std::optional<StrategyRecord> lookup(StringRef key);
+    void record(StringRef key, const StrategyRecord& record);
+
+    // Writes the database if there are new records. Failures are reported as warnings, since the database is a cache
+    void save();
+
+    size_t size() const;
+
+private:
+    void load(llvm::StringMap<StrategyRecord>& records) const;
+    void prune();
+
+private:
+    std::string _fileName;
+    Logger _log;
+    size_t _maxRecords;
+
+    mutable std::mutex _mutex;
+    llvm::StringMap<StrategyRecord> _records;
+    bool _isModified = false;
+};
+
+}  // namespace vpux::VPU
@@ -6,8 +6,10 @@
 #pragma once
 
 #include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/DenseSet.h>
 #include "strategy.hpp"
 
+#include <memory>
 #include <unordered_map>
 
 #include <vpu/cycles_interface_types.h>
@@ -103,7 +105,13 @@ struct hashCombinedKey {
 
 class OperationStrategies final {
 public:
-    OperationStrategies(){};
+    OperationStrategies();
+
+    /*
+       Create a copy of the storage with its own current and best states.
+       Strategy and transition costs are shared with the copy, they can't be updated in the view
+    */
+    std::shared_ptr<OperationStrategies> createView() const;
 
     /*
        Add new strategy for operation with cost
@@ -178,6 +186,22 @@ public:
     */
     SmallVector<StrategyInfo> getAllStrategies(mlir::Operation* operation) const;
 
+    /*
+       Pin the operation to the strategy: it's set as "current" and "best" and the optimization algorithms
+       don't search over this operation until it's unpinned
+    */
+    void pinStrategy(const OperationStrategy& opStr);
+
+    /*
+       Allow the optimization algorithms to change the strategies of all operations again
+    */
+    void unpinAll();
+
+    /*
+       Get the operations whose strategies are searched, i.e. all the operations except the pinned ones
+    */
+    llvm::SetVector<mlir::Operation*> getSearchedOperations() const;
+
 private:
     /*
      * Current number of bits for StrategyState
@@ -201,9 +225,13 @@ private:
     */
     CombinedTransitionKey getTransitionHash(const OperationStrategy& srcOpStr, const OperationStrategy& dstOpStr) const;
 
+    using TransitionCostMap = std::unordered_map<CombinedTransitionKey, StrategyCost, hashCombinedKey>;
+
     std::unordered_map<mlir::Operation*, SmallVector<StrategyInfo>> _strategies;
-    std::unordered_map<CombinedTransitionKey, StrategyCost, hashCombinedKey> _transitionCost;
+    std::shared_ptr<TransitionCostMap> _transitionCost;
+    bool _isView = false;
     llvm::SetVector<mlir::Operation*> _operationList;
+    llvm::DenseSet<mlir::Operation*> _pinnedOperations;
 };
 
 }  // namespace vpux::VPU
@@ -0,0 +1,115 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/VPU/utils/strategy_manager/operation_strategies.hpp"
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <map>
+
+namespace vpux::VPU {
+
+/*
+   Pairwise cost model of the strategy assignment.
+   Full cost of the assignment is the sum of node costs of the chosen strategies
+   and edge costs of the chosen pairs of strategies of neighbouring operations.
+   Node cost includes the cost of the strategy itself and the transitions to the operations outside the storage
+*/
+struct StrategyGraph {
+    struct Node {
+        mlir::Operation* operation = nullptr;
+        SmallVector<Strategy> strategies;
+        SmallVector<double> costs;
+    };
+
+    /*
+       Costs are stored row-major: src strategy x dst strategy
+    */
+    struct Edge {
+        size_t src = 0;
+        size_t dst = 0;
+        SmallVector<double> costs;
+    };
+
+    SmallVector<Node> nodes;
+    SmallVector<Edge> edges;
+
+    /*
+       Full cost of the assignment, `strategyInds` contains the index of the chosen strategy for each node
+    */
+    double getCost(ArrayRef<size_t> strategyInds) const;
+};
+
+/*
+   Exact min-sum solver for the chain, tree and series-parallel parts of the strategy graph.
+   Nodes are eliminated one by one:
+   - node with one neighbour (leaf) folds its best cost for each strategy of the neighbour into the neighbour's cost
+   - node with two neighbours (series) is replaced by the edge between the neighbours,
+     parallel edges are merged by summing their costs
+   Elimination of a node is exact, so when the whole graph is reduced the assignment is optimal.
+   The nodes which can't be eliminated (all of them have at least three neighbours) form the irreducible kernel.
+   Their strategies have to be chosen by other means (e.g. simulated annealing),
+   the rest of the nodes are then assigned optimally for the given kernel assignment
+*/
+class StrategyGraphSolver final {
+public:
+    // Strategy index for each kernel node
+    using KernelAssignment = llvm::DenseMap<size_t, size_t>;
+
+public:
+    explicit StrategyGraphSolver(const StrategyGraph& graph);
+
+    /*
+       Nodes which remained after the elimination, in increasing order
+    */
+    ArrayRef<size_t> getKernelNodes() const {
+        return _kernelNodes;
+    }
+
+    /*
+       Choose strategies for all the nodes. `kernelAssignment` must contain the strategy of each kernel node
+    */
+    SmallVector<size_t> solve(const KernelAssignment& kernelAssignment = KernelAssignment()) const;
+
+private:
+    /*
+       Dense cost table, row-major: node strategy x neighbour strategy
+    */
+    struct CostTable {
+        size_t rows = 0;
+        size_t cols = 0;
+        SmallVector<double> values;
+
+        double at(size_t row, size_t col) const {
+            return values[row * cols + col];
+        }
+    };
+
+    /*
+       Eliminated node and the table of its best strategy for each combination of the neighbours' strategies
+    */
+    struct Elimination {
+        size_t node = 0;
+        SmallVector<size_t> neighbours;
+        SmallVector<size_t> choices;
+    };
+
+    void addEdge(size_t first, size_t second, const CostTable& table);
+    void removeEdges(size_t node);
+    void eliminateLeaf(size_t node);
+    void eliminateSeries(size_t node);
+    void eliminateIsolated(size_t node);
+
+    SmallVector<size_t> _numStrategies;
+    SmallVector<SmallVector<double>> _nodeCosts;
+    // Ordered adjacency keeps the elimination deterministic
+    SmallVector<std::map<size_t, CostTable>> _adjacency;
+    SmallVector<Elimination> _eliminations;
+    SmallVector<size_t> _kernelNodes;
+};
+
+}  // namespace vpux::VPU
@@ -8,6 +8,9 @@
 #include "vpux/compiler/dialect/VPU/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/state_provider_interface.hpp"
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_opt_alg_interface.hpp"
+#include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_state_provider.hpp"
+
+#include <functional>
 
 using namespace vpux::VPU;
 
@@ -37,12 +40,80 @@ public:
     void optimize() override;
 };
 
+/*
+Creates a state provider for one replica of the parallel tempering. The provider works over the storage view
+and must not call the cost model, as the replicas run on different threads
+*/
+using StateProviderFactory = std::function<std::shared_ptr<DefaultStateProvider>(
+        const std::shared_ptr<OperationStrategies>&, uint32_t seed)>;
+
+/*
+Parallel tempering (replica exchange) on top of the simulated annealing:
+several replicas run Metropolis steps at fixed temperatures of the ladder on the context thread pool.
+After each round neighbouring temperatures are exchanged between the replicas, so the good solutions found by
+the hot replicas are refined by the cold ones. Each replica works over its own view of the shared storage.
+The result doesn't depend on the thread scheduling: the replicas are seeded by their index, exchanges are decided
+sequentially and the best solution is chosen by the full cost with ties resolved by the replica index.
+*/
+class ParallelTemperingStrategy : public IStrategyOptAlgorithm {
+private:
+    const std::shared_ptr<OperationStrategies> _storage;
+    const StateProviderFactory _providerFactory;
+    const size_t _temperature;
+    const size_t _steps;
+    const size_t _numReplicas;
+
+public:
+    ParallelTemperingStrategy(const std::shared_ptr<OperationStrategies>& storage, StateProviderFactory providerFactory,
+                              const size_t temp, const size_t steps, const size_t numReplicas)
+            : _storage(storage),
+              _providerFactory(std::move(providerFactory)),
+              _temperature(temp),
+              _steps(steps),
+              _numReplicas(numReplicas) {
+    }
+
+    /*
+    Runs the replicas and stores the best found solution as the current and the best state of the storage
+    */
+    void optimize() override;
+};
+
+/*
+Exact dynamic programming solver for the chain, tree and series-parallel regions of the graph
+(see StrategyGraphSolver). When the whole graph is reduced, the assignment is optimal.
+Otherwise the irreducible remainder (kernel) is optimized by the fallback algorithm, with the rest of operations
+pinned to their optimal strategies for the initial kernel assignment. Then the rest of operations is assigned
+optimally for the strategies the fallback has chosen, so the result is never worse than the fallback one.
+*/
+class DynamicProgrammingStrategy : public IStrategyOptAlgorithm {
+private:
+    const std::shared_ptr<OperationStrategies> _storage;
+    const std::shared_ptr<DefaultStateProvider> _stateProvider;
+    const std::unique_ptr<IStrategyOptAlgorithm> _fallback;
+
+public:
+    DynamicProgrammingStrategy(const std::shared_ptr<OperationStrategies>& storage,
+                               const std::shared_ptr<DefaultStateProvider>& stateProvider,
+                               std::unique_ptr<IStrategyOptAlgorithm> fallback)
+            : _storage(storage), _stateProvider(stateProvider), _fallback(std::move(fallback)) {
+    }
+
+    /*
+    Solves the graph and stores the solution as the current and the best state of the storage
+    */
+    void optimize() override;
+};
+
 /*
 Creates an instance of the strategy optimization algorithm
+The exact solver is used when it's enabled in the options and the default state provider is used
+Parallel tempering is used when more than one replica is requested in the options and the replica factory is set
 */
 std::unique_ptr<IStrategyOptAlgorithm> createAlgorithm(const vpux::VPU::TilingOptions& options,
                                                        const std::shared_ptr<IStateProvider>& stateProvider,
-                                                       const std::shared_ptr<OperationStrategies>& strategies);
+                                                       const std::shared_ptr<OperationStrategies>& strategies,
+                                                       StateProviderFactory replicaFactory = nullptr);
 /*
 Calculate initial temperature for Simulated Annealing
 */
@@ -7,6 +7,7 @@
 
 #include "state_provider_interface.hpp"
 #include "vpux/compiler/dialect/VPU/utils/cost_model/layer_vpunn_cost.hpp"
+#include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_graph.hpp"
 
 #include <llvm/ADT/SetVector.h>
 
@@ -24,8 +25,8 @@ class LayerVPUNNCost;
 class DefaultStateProvider : public IStateProvider {
 public:
     DefaultStateProvider(const std::shared_ptr<OperationStrategies>& storage,
-                         const std::shared_ptr<LayerVPUNNCost>& costModel)
-            : _storage(storage), _costModel(costModel), _generator(0) {
+                         const std::shared_ptr<LayerVPUNNCost>& costModel, uint32_t seed = 0)
+            : _storage(storage), _costModel(costModel), _generator(seed) {
     }
 
     /*
@@ -33,6 +34,17 @@ public:
     */
     OperationStrategy getState(int temperature, double& cost, const OperationStrategy* const state) override;
 
+    /*
+      Get random operation with its current strategy. Unlike getState, the storage is never reverted to the best
+      solution, so the fixed temperature runs (e.g. parallel tempering replicas) use it
+    */
+    OperationStrategy getRandomState();
+
+    /*
+      Get the same operation with another randomly chosen strategy
+    */
+    OperationStrategy getNeighbourState(const OperationStrategy& state);
+
     /*
       Get cost associated with selected pair of operation -> strategy
     */
@@ -53,6 +65,18 @@ public:
     */
     StrategyCost getFullCost() override;
 
+    /*
+      Calculate transition costs between all strategies of neighbouring operations in advance.
+      Afterwards the cost requests don't call the cost model and don't touch the IR, so the providers
+      over the storage views can be used from several threads
+    */
+    void fillInTransitionCosts();
+
+    /*
+      Build pairwise cost model of the storage, its cost for any assignment is equal to the full cost
+    */
+    StrategyGraph buildStrategyGraph();
+
 private:
     /*
        Choose randomly operation from the list and return its current strategy
@@ -114,6 +138,11 @@ private:
     StrategyCost accumulateCost(ArrayRef<mlir::Operation*> neighbours, const OperationStrategy& state,
                                 bool parent = true);
 
+    /*
+      Calculate transition costs between the state and all strategies of the neighbour
+    */
+    void fillInNeighbourCosts(mlir::Operation* neighbour, const OperationStrategy& state, bool parent);
+
     /*
       Get all neighbours for operation
     */
@@ -12,6 +12,11 @@ namespace vpux::VPUIP {
 using SplitCostCb = int64_t (*)(const VPUIP::WorkloadSplit&, const VPUIP::WorkloadCostParams&, VPUNN::VPUCostModel&,
                                 LogCb);
 
+// Computes the costs of all the splits at once, so that their workloads are queried from VPUNN in a single batch
+using SplitPoolCostCb = SmallVector<int64_t> (*)(ArrayRef<VPUIP::WorkloadSplit>, const VPUIP::WorkloadCostParams&,
+                                                 VPUNN::VPUCostModel&, LogCb);
+
 SplitCostCb getSplitCostCb(VPU::ArchKind arch);
+SplitPoolCostCb getSplitPoolCostCb(VPU::ArchKind arch);
 
 }  // namespace vpux::VPUIP
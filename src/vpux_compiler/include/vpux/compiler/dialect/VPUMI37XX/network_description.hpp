@@ -8,8 +8,14 @@
 #include "intel_npu/al/icompiler.hpp"
 #include "vpux/compiler/dialect/ELFNPU37XX/metadata.hpp"
 
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
 namespace vpux::VPUMI37XX {
 
-intel_npu::NetworkMetadata getNetworkMetadata(const std::vector<uint8_t>& blob);
+intel_npu::NetworkMetadata getNetworkMetadata(ArrayRef<uint8_t> blob);
+
+// Parses the metadata of a compiled network stored in a file without reading the whole file
+intel_npu::NetworkMetadata getNetworkMetadataFromFile(StringRef blobPath);
 
 }  // namespace vpux::VPUMI37XX
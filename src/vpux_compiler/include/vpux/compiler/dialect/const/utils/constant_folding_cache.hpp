@@ -10,7 +10,9 @@
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 #include "vpux/compiler/dialect/const/utils/content.hpp"
 #include "vpux/utils/core/mem_size.hpp"
+#include "vpux/utils/core/small_vector.hpp"
 
+#include <llvm/Support/Compression.h>
 #include <mlir/IR/MLIRContext.h>
 
 #include <tbb/concurrent_hash_map.h>
@@ -18,7 +20,10 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <utility>
 
 namespace vpux {
@@ -57,21 +62,37 @@ struct ContentAttrHash {
 //
 // CachedContent
 //
-// Contains two elements:
-// - content: Represents the folded content
-// - refCount: An integer that represents the number of times the content has been queried minus the number of times it
-// has been retrieved. Based on observation, the more times the content is queried, the more likely it is going to be
-// used in the future. Conversely, the more times the content is retrieved, the less likely it is going to be used in
-// the future. Therefore, a smaller refCount indicates a higher priority for removing the cache entry if the memory
-// limit is reached. This is a temporary solution for the basic cache clean mechanism and will be further optimized in
-// the future.
+// Contains the folded content and the information used to choose the entries which are evicted once the memory limit
+// is reached:
+// - numFoldingSteps: The number of steps needed to fold the content again, i.e. reading the base content and applying
+// each transformation
+// - lastAccess: The value of the cache access counter when the entry was last queried or retrieved
 struct CachedContent {
     Const::Content content;
-    std::atomic<int> refCount{1};
+    size_t numFoldingSteps = 0;
+    std::atomic<uint64_t> lastAccess{0};
+};
+
+//
+// CompressedContent
+//
+// Folded content evicted from the main cache. Instead of being dropped, it is kept compressed in memory, so that it can
+// be restored without repeating the whole transformation chain. The data is stored as is when the compression is not
+// beneficial, e.g. for splat values.
+struct CompressedContent {
+    vpux::NDTypeInterface type;
+    mlir::Type storageElemType;
+    bool isSplat = false;
+    std::optional<llvm::compression::Format> format;
+    SmallVector<uint8_t> data;
+    size_t rawSize = 0;
+    size_t numFoldingSteps = 0;
+    uint64_t lastAccess = 0;
 };
 
 using RequestQueue = tbb::concurrent_bounded_queue<FoldingRequest>;
 using ContentMap = tbb::concurrent_hash_map<Const::ContentAttr, CachedContent, ContentAttrHash>;
+using CompressedContentMap = tbb::concurrent_hash_map<Const::ContentAttr, CompressedContent, ContentAttrHash>;
 
 struct CacheStatistics {
     std::atomic<size_t> numElementsAddedToCache = 0;
@@ -79,19 +100,26 @@ struct CacheStatistics {
     std::atomic<size_t> numCacheHits = 0;
     std::atomic<size_t> numCacheMisses = 0;
     std::atomic<size_t> numDuplicatedRequests = 0;
+    std::atomic<size_t> numCompressedCacheHits = 0;
+    std::atomic<size_t> numElementsCompressed = 0;
+    std::atomic<size_t> numBytesSavedByCompression = 0;
+    std::atomic<size_t> numBytesRestoredFromCompressedCache = 0;
 
     void updateMaxNumRequestsInQueue(size_t newNumRequests);
     void updateMaxCacheSize(size_t newCacheSize);
     void updateMaxMemoryUsedCache(size_t newMemoryUsedCache);
+    void updateMaxMemoryUsedCompressedCache(size_t newMemoryUsedCompressedCache);
 
     size_t getMaxNumRequestsInQueue();
     size_t getMaxCacheSize();
     size_t getMaxMemoryUsedCache();
+    size_t getMaxMemoryUsedCompressedCache();
 
 private:
     size_t _maxNumRequestsInQueue = 0;
     size_t _maxCacheSize = 0;
     size_t _maxMemoryUsedCache = 0;
+    size_t _maxMemoryUsedCompressedCache = 0;
 
     std::mutex _mtx{};
 };
@@ -121,7 +149,7 @@ public:
     FoldingRequest getRequest();
 
     /**
-     * @brief Checks whether the given attribute is found in the cache
+     * @brief Checks whether the given attribute is found in the cache, including its compressed tier
      * @details This method is thread-safe
      * @return true if the attribute has been found
      */
@@ -151,6 +179,15 @@ public:
      */
     void setCacheCleanThreshold(double cacheCleanThreshold);
 
+    /**
+     * @brief Sets the memory usage limit for the compressed tier of the cache. The folding results evicted from the
+     * main cache are compressed and kept in this tier until it reaches the limit. A zero limit disables the tier
+     * @details This method is not thread-safe but assumed not to be used in contexts
+     * where multi-threading scenarios are involved
+     * @param `memoryUsageLimit`: the memory usage limit in bytes
+     */
+    void setCompressedMemoryUsageLimit(vpux::Byte memoryUsageLimit);
+
     /**
      * @brief Gets the memory used by the cache
      * @details This method is not thread-safe but assumed not to be used in contexts
@@ -159,8 +196,17 @@ public:
     size_t getMemoryUsedCache() const;
 
     /**
-     * @brief Clean the cache to cacheCleanThreshold based on the refCount
-     * @details This method is thread-safe
+     * @brief Gets the memory used by the compressed tier of the cache
+     * @details This method is not thread-safe but assumed not to be used in contexts
+     * where multi-threading scenarios are involved
+     */
+    size_t getMemoryUsedCompressedCache() const;
+
+    /**
+     * @brief Clean the cache to cacheCleanThreshold by moving the entries with the lowest retention score to the
+     * compressed tier. The score is the number of folding steps needed to recompute the entry, divided by its size and
+     * by the number of cache accesses since it was last used
+     * @details This method is thread-safe. In case another thread is already cleaning the cache, nothing is done
      */
     void cleanUpCache();
 
@@ -172,7 +218,7 @@ public:
     bool isMemoryLimitReached() const;
 
     /**
-     * @brief Removes a folding result from the cache
+     * @brief Removes a folding result from the cache, including its compressed tier
      * @details This method is thread-safe
      * @param `attr`: the folding request whose folding result should be removed from the cache
      */
@@ -180,6 +226,7 @@ public:
 
     /**
      * @brief Tries to get the folding result from the cache for the given request (represented as an attribute). In
+     * case the result is found in the compressed tier, it is decompressed and moved back to the main cache. In
      * case the cache does not contain the result, the function will return nothing
      * @details This method is thread-safe
      * @param `attr`: the folding request whose folding result should be obtained from the cache
@@ -197,6 +244,31 @@ public:
      */
     bool replaceContentAttr(Const::ContentAttr originalAttr, Const::ContentAttr newAttr);
 
+    /**
+     * @brief Sets the handler used to promote the pending folding requests. The handler should return once the
+     * request is folded or if it is not pending. An empty handler disables the promotion
+     * @details This method is NOT thread-safe
+     * @param `handler`: the handler which receives the attribute whose folding result is needed
+     */
+    void setPromoteHandler(std::function<void(Const::ContentAttr)> handler);
+
+    /**
+     * @brief Sets the handler used to run the clean-up of the cache once its memory limit is reached, so that the
+     * compression of the evicted entries does not run on the thread adding the content. An empty handler makes the
+     * clean-up run synchronously
+     * @details This method is NOT thread-safe
+     * @param `handler`: the handler which receives the task to run in background
+     */
+    void setBackgroundTaskHandler(std::function<void(std::function<void()>)> handler);
+
+    /**
+     * @brief Notifies the background folding that the caller is about to block on the folding result of the given
+     * attribute. In case the request is still pending, it is folded with priority before this method returns
+     * @details This method is thread-safe
+     * @param `attr`: the attribute whose folding result is needed
+     */
+    void promoteRequest(Const::ContentAttr attr);
+
     /**
      * @brief Enable the collection of statistics for the cache
      * @details This method is NOT thread-safe
@@ -223,15 +295,31 @@ public:
      */
     Const::details::CacheStatistics& getStatistics();
 
+private:
+    uint64_t nextAccess();
+    void compressContent(Const::ContentAttr attr);
+    std::optional<Const::Content> restoreCompressedContent(Const::ContentAttr attr);
+    void cleanUpCompressedCache();
+    void scheduleCleanUp();
+
 private:
     Const::details::RequestQueue _requestQueue{};
     Const::details::ContentMap _cache{};
-
-    std::mutex _mutex;
+    Const::details::CompressedContentMap _compressedCache{};
+
+    // Shared by the insertions and erasures of the maps, taken exclusively to traverse them
+    std::shared_mutex _mutex;
+    std::mutex _cleanUpMutex;
+    std::function<void(Const::ContentAttr)> _promoteHandler;
+    std::function<void(std::function<void()>)> _backgroundTaskHandler;
+    std::atomic<bool> _isCleanUpScheduled = false;
     bool _collectStatistics = false;
     size_t _memoryUsageLimit = 0;
+    size_t _compressedMemoryUsageLimit = 0;
     double _cacheCleanThreshold = 0.8;
     std::atomic<size_t> _memoryUsedCache = 0;
+    std::atomic<size_t> _memoryUsedCompressedCache = 0;
+    std::atomic<uint64_t> _accessCounter = 0;
     Const::details::CacheStatistics _statistics{};
 };
 
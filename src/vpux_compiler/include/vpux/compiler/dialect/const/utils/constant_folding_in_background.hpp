@@ -8,13 +8,18 @@
 #ifdef BACKGROUND_FOLDING_ENABLED
 
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
+#include "vpux/compiler/utils/priority_executor.hpp"
 #include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/logger.hpp"
 #include "vpux/utils/core/small_vector.hpp"
 
-#include <llvm/Support/ThreadPool.h>
+#include <llvm/ADT/DenseMap.h>
 #include <mlir/IR/MLIRContext.h>
 
+#include <memory>
+#include <mutex>
+#include <thread>
+
 namespace vpux {
 namespace Const {
 
@@ -30,23 +35,25 @@ public:
     BackgroundConstantFolding& operator=(BackgroundConstantFolding&&) = delete;
 
 private:
-    std::shared_future<void> initFoldingListener(llvm::ThreadPool& threadPool);
+    std::thread initFoldingListener();
     void stopFoldingListener();
     void processFoldingRequest(const FoldingRequest& foldingRequest, ConstantFoldingCache& cache);
+    void foldRequest(const FoldingRequest& foldingRequest, ConstantFoldingCache& cache);
+    void promoteRequest(Const::ContentAttr attr);
 
     bool _isEnabled = true;
     mlir::MLIRContext* _ctx;
-    const size_t _maxConcurrentTasks;
-    std::shared_future<void> _listenerThread;
+    std::thread _listenerThread;
     Logger _log;
 
-    // The goal is to prevent overloading the thread-pool queue with background folding tasks, as the main compilation
-    // process also utilizes the pool concurrently. To achieve this, a limit is imposed on the number of tasks submitted
-    // to the pool from the background. Currently, the pool lacks a sophisticated mechanism to prioritize tasks from the
-    // main compilation over those from the background.
-    std::atomic<size_t> _activeTasks{0};
-    std::mutex _mutex;
-    std::condition_variable _cv;
+    // The folding tasks are executed by dedicated workers with the idle OS priority, so the main compilation process
+    // preempts them and folding uses the whole machine width only while the cores are idle. Where the priority cannot
+    // be lowered, at most `maxConcurrentTasks` folding tasks are executed at the same time.
+    std::unique_ptr<PriorityExecutor> _executor;
+
+    // Requests which are queued or being folded, so that the main compilation can promote the ones it is blocked on
+    llvm::DenseMap<Const::ContentAttr, PriorityExecutor::TaskId> _pendingRequests;
+    std::mutex _pendingRequestsMutex;
 };
 
 }  // namespace Const
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "vpux/compiler/dialect/const/utils/convert_elements.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
 #include "vpux/utils/core/checked_cast.hpp"
@@ -17,6 +18,7 @@
 
 #include <llvm/Support/TypeName.h>
 
+#include <atomic>
 #include <memory>
 
 namespace vpux {
@@ -29,71 +31,39 @@ namespace details {
 //
 
 template <typename OutT>
-using ConvertCb = OutT (*)(const char*);
+using ConvertCb = OutT (*)(const char*, size_t&);
 
-template <typename OutT>
-struct CvtHelper final {
-    template <typename InT>
-    static OutT cvt(InT val) {
-        return checked_cast<OutT>(val);
-    }
-};
+template <typename InT, typename OutT>
+ConvertCb<OutT> makeConvertCb() {
+    return [](const char* rawPtr, size_t& clampedCount) {
+        return SaturateCvtHelper<OutT>::cvt(*reinterpret_cast<const InT*>(rawPtr), clampedCount);
+    };
+}
 
-template <>
-struct CvtHelper<vpux::type::float16> final {
-    template <typename InT>
-    static vpux::type::float16 cvt(InT val) {
-        auto castedVal = vpux::type::float16(checked_cast<float>(val));
-        if (std::isinf(castedVal)) {
-            const auto clampedVal = std::numeric_limits<vpux::type::float16>::clamp(castedVal);
-            auto logger = Logger::global();
-            logger.warning("Value is out of range for FP16 = {0}; clamping to = {1}.", checked_cast<float>(val),
-                           checked_cast<float>(clampedVal));
-            return clampedVal;
-        }
-        return castedVal;
-    }
-};
+//
+// ClampedValuesCounter
+//
 
-template <>
-struct CvtHelper<vpux::type::bfloat16> final {
-    template <typename InT>
-    static vpux::type::bfloat16 cvt(InT val) {
-        return vpux::type::bfloat16(checked_cast<float>(val));
-    }
-};
+// Accumulates the values clamped while reading a range and reports them once, when the last copy of it is destroyed
+class ClampedValuesCounter final {
+public:
+    ClampedValuesCounter() = default;
+    ClampedValuesCounter(const ClampedValuesCounter&) = delete;
+    ClampedValuesCounter& operator=(const ClampedValuesCounter&) = delete;
 
-template <>
-struct CvtHelper<vpux::type::float8_e4m3> final {
-    template <typename InT>
-    static vpux::type::float8_e4m3 cvt(InT val) {
-        return vpux::type::float8_e4m3(checked_cast<float>(val));
+    ~ClampedValuesCounter() {
+        reportClampedValues(_count.load());
     }
-};
 
-template <>
-struct CvtHelper<vpux::type::float8_e5m2> final {
-    template <typename InT>
-    static vpux::type::float8_e5m2 cvt(InT val) {
-        return vpux::type::float8_e5m2(checked_cast<float>(val));
+public:
+    void add(size_t count) {
+        _count += count;
     }
-};
 
-template <>
-struct CvtHelper<bool> final {
-    template <typename InT>
-    static bool cvt(InT val) {
-        return val != static_cast<InT>(0);
-    }
+private:
+    std::atomic<size_t> _count{0};
 };
 
-template <typename InT, typename OutT>
-ConvertCb<OutT> makeConvertCb() {
-    return [](const char* rawPtr) {
-        return CvtHelper<OutT>::cvt(*reinterpret_cast<const InT*>(rawPtr));
-    };
-}
-
 //
 // ContentRangeBase
 //
@@ -102,7 +72,14 @@ template <typename OutT>
 class ContentRangeBase final {
 public:
     ContentRangeBase(ArrayRef<char> data, bool isSplat, Byte elemSize, ConvertCb<OutT> cvtOp)
-            : _data(data), _isSplat(isSplat), _elemSize(elemSize), _cvtOp(std::move(cvtOp)) {
+            : _data(data),
+              _isSplat(isSplat),
+              _elemSize(elemSize),
+              _cvtOp(std::move(cvtOp)) {
+        // Only the conversions which may clamp need the counter, the others don't pay for the allocation
+        if constexpr (SaturateCvtHelper<OutT>::canClamp) {
+            _clampedValues = std::make_shared<ClampedValuesCounter>();
+        }
         if (_isSplat) {
             VPUX_THROW_UNLESS(_data.size() == checked_cast<size_t>(_elemSize.count()),
                               "Splat data store size '{0}' doesn't match element type size '{1}'", _data.size(),
@@ -113,13 +90,13 @@ public:
 public:
     OutT getItem(ptrdiff_t ind) const {
         if (_isSplat) {
-            return _cvtOp(_data.data());
+            return convert(_data.data());
         }
 
         const auto rawIndex = checked_cast<size_t>(ind * _elemSize.count());
         VPUX_THROW_UNLESS(rawIndex < _data.size(), "Out-of-bound access in ContentRangeBase");
 
-        return _cvtOp(_data.data() + rawIndex);
+        return convert(_data.data() + rawIndex);
     }
 
 public:
@@ -130,11 +107,24 @@ public:
         return !(*this == other);
     }
 
+private:
+    OutT convert(const char* rawPtr) const {
+        size_t clampedCount = 0;
+        const auto val = _cvtOp(rawPtr, clampedCount);
+        if constexpr (SaturateCvtHelper<OutT>::canClamp) {
+            if (clampedCount != 0) {
+                _clampedValues->add(clampedCount);
+            }
+        }
+        return val;
+    }
+
 private:
     ArrayRef<char> _data;
     bool _isSplat = false;
     Byte _elemSize;
     ConvertCb<OutT> _cvtOp;
+    std::shared_ptr<ClampedValuesCounter> _clampedValues;
 };
 
 //
@@ -200,6 +190,36 @@ public:
     template <typename OutT>
     void getValues() && = delete;
 
+    // Converts all the elements into `out` at once. In contrast to the element-wise `getValues` it uses vectorized
+    // kernels for the common element type pairs.
+    template <typename OutT>
+    void copyValuesTo(MutableArrayRef<OutT> out) const {
+        const Bit storageElemTypeSize = vpux::getElemTypeSize(_storageElemType);
+        VPUX_THROW_WHEN(storageElemTypeSize.count() < CHAR_BIT, "Unsupported storage type of size '{0}' bits.",
+                        storageElemTypeSize.count());
+
+        const auto numElements = checked_cast<size_t>(getType().getNumElements());
+        VPUX_THROW_UNLESS(out.size() >= numElements,
+                          "Buffer with size '{0}' is not enough to hold '{1}' actual elements", out.size(),
+                          numElements);
+
+        const auto clampedCount = dispatchByElemType<size_t>(getStorageElemType(), [&](auto dummy) {
+            using InT = std::decay_t<decltype(dummy)>;
+            const auto inVals = ArrayRef<InT>(reinterpret_cast<const InT*>(_data.data()), _isSplat ? 1 : numElements);
+
+            if (_isSplat) {
+                size_t splatClampedCount = 0;
+                const auto splatVal = details::SaturateCvtHelper<OutT>::cvt(inVals.front(), splatClampedCount);
+                std::fill_n(out.begin(), numElements, splatVal);
+                return splatClampedCount;
+            }
+
+            return details::convertElementsParallel(getType().getContext(), inVals, out.take_front(numElements));
+        });
+
+        details::reportClampedValues(clampedCount);
+    }
+
     template <typename OutT>
     std::vector<OutT> vec() const {
         auto allocSize = getType().getTotalAllocSize().count();
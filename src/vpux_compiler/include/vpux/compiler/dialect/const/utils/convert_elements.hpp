@@ -0,0 +1,164 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/utils/loop.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/custom_float.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/type/float16.hpp"
+
+#include <atomic>
+#include <cmath>
+
+namespace vpux {
+namespace Const {
+namespace details {
+
+// Reports a single warning for all values clamped during one conversion
+void reportClampedValues(size_t clampedCount);
+
+//
+// CvtHelper
+//
+
+template <typename OutT>
+struct CvtHelper final {
+    template <typename InT>
+    static OutT cvt(InT val) {
+        return checked_cast<OutT>(val);
+    }
+};
+
+// Conversion to FP16 may clamp the values, it goes through SaturateCvtHelper which counts them for a single report
+template <>
+struct CvtHelper<vpux::type::float16> final {
+    template <typename InT>
+    static vpux::type::float16 cvt(InT val) = delete;
+};
+
+template <>
+struct CvtHelper<vpux::type::bfloat16> final {
+    template <typename InT>
+    static vpux::type::bfloat16 cvt(InT val) {
+        return vpux::type::bfloat16(checked_cast<float>(val));
+    }
+};
+
+template <>
+struct CvtHelper<vpux::type::float8_e4m3> final {
+    template <typename InT>
+    static vpux::type::float8_e4m3 cvt(InT val) {
+        return vpux::type::float8_e4m3(checked_cast<float>(val));
+    }
+};
+
+template <>
+struct CvtHelper<vpux::type::float8_e5m2> final {
+    template <typename InT>
+    static vpux::type::float8_e5m2 cvt(InT val) {
+        return vpux::type::float8_e5m2(checked_cast<float>(val));
+    }
+};
+
+template <>
+struct CvtHelper<bool> final {
+    template <typename InT>
+    static bool cvt(InT val) {
+        return val != static_cast<InT>(0);
+    }
+};
+
+//
+// SaturateCvtHelper
+//
+
+// Same as CvtHelper, but counts the values clamped to the output type range.
+// `canClamp` tells whether the conversion may clamp at all, so the callers can skip the counting.
+template <typename OutT>
+struct SaturateCvtHelper final {
+    static constexpr bool canClamp = false;
+
+    template <typename InT>
+    static OutT cvt(InT val, size_t&) {
+        return CvtHelper<OutT>::cvt(val);
+    }
+};
+
+template <>
+struct SaturateCvtHelper<vpux::type::float16> final {
+    static constexpr bool canClamp = true;
+
+    template <typename InT>
+    static vpux::type::float16 cvt(InT val, size_t& clampedCount) {
+        auto castedVal = vpux::type::float16(checked_cast<float>(val));
+        if (std::isinf(castedVal)) {
+            ++clampedCount;
+            return std::numeric_limits<vpux::type::float16>::clamp(castedVal);
+        }
+        return castedVal;
+    }
+};
+
+//
+// convertElements
+//
+
+// Converts `count` elements and returns the number of values clamped to the output type range.
+// The most common pairs are specialized with vectorized kernels, the rest use the scalar loop.
+template <typename InT, typename OutT>
+size_t convertElements(const InT* in, OutT* out, size_t count) {
+    size_t clampedCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = SaturateCvtHelper<OutT>::cvt(in[i], clampedCount);
+    }
+    return clampedCount;
+}
+
+template <>
+size_t convertElements<float, vpux::type::float16>(const float* in, vpux::type::float16* out, size_t count);
+
+template <>
+size_t convertElements<vpux::type::float16, float>(const vpux::type::float16* in, float* out, size_t count);
+
+template <>
+size_t convertElements<int8_t, vpux::type::float16>(const int8_t* in, vpux::type::float16* out, size_t count);
+
+template <>
+size_t convertElements<uint8_t, vpux::type::float16>(const uint8_t* in, vpux::type::float16* out, size_t count);
+
+template <>
+size_t convertElements<int8_t, float>(const int8_t* in, float* out, size_t count);
+
+template <>
+size_t convertElements<uint8_t, float>(const uint8_t* in, float* out, size_t count);
+
+// Splits the conversion into blocks processed in parallel
+template <typename InT, typename OutT>
+size_t convertElementsParallel(mlir::MLIRContext* ctx, ArrayRef<InT> in, MutableArrayRef<OutT> out) {
+    constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    VPUX_THROW_UNLESS(out.size() >= in.size(), "Output buffer size '{0}' is smaller than the input size '{1}'",
+                      out.size(), in.size());
+
+    std::atomic<size_t> clampedCount{0};
+    const auto numBlocks = divUp(in.size(), BLOCK_SIZE);
+    loop_1d(LoopExecPolicy::Parallel, ctx, checked_cast<int64_t>(numBlocks), [&](int64_t blockIdx) {
+        const auto begin = checked_cast<size_t>(blockIdx) * BLOCK_SIZE;
+        const auto size = std::min(BLOCK_SIZE, in.size() - begin);
+        clampedCount += convertElements<InT, OutT>(in.data() + begin, out.data() + begin, size);
+    });
+
+    return clampedCount.load();
+}
+
+}  // namespace details
+}  // namespace Const
+}  // namespace vpux
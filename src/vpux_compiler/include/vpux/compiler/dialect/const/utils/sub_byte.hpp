@@ -14,6 +14,7 @@
 
 #include <openvino/core/type/element_type.hpp>
 
+#include <mlir/IR/BuiltinTypes.h>
 #include <mlir/IR/MLIRContext.h>
 
 namespace vpux {
@@ -23,5 +24,15 @@ bool isSubByte(const size_t bitWidth);
 
 SmallVector<char> getConstBuffer(const char* sourceData, const size_t bitWidth, const int64_t numElems);
 
+// Unpacks sub-byte elements into one element per byte, targetData size defines the number of elements
+void unpackSubByteBuffer(const char* sourceData, const size_t bitWidth, MutableArrayRef<char> targetData);
+
+// Size in bytes of `numElems` sub-byte elements packed together
+int64_t getPackedBufferSize(const size_t bitWidth, const int64_t numElems);
+
+// Whether `data` holds the elements of `type` packed with several sub-byte elements per byte,
+// as they are stored in the shared OV constants
+bool isPackedSubByteBuffer(mlir::ShapedType type, ArrayRef<char> data);
+
 }  // namespace Const
 }  // namespace vpux
@@ -18,6 +18,16 @@ namespace details {
 vpux::Const::Content memPermuteTransformation(vpux::Const::Content& input, vpux::NDTypeInterface outType,
                                               mlir::AffineMap memPerm);
 
+//
+// applyFusedTransformations
+//
+
+// Evaluates the leading run of element-wise (Rescale, Add) and view (Reshape, LayoutCast, ConvertElemType, SubView)
+// transformations in a single pass over the elements, instead of materializing a buffer after each of them.
+// Replaces `content` with the result and returns the number of applied transformations. Returns 0 and leaves
+// `content` untouched when the fusion is not applicable or would not save any intermediate buffer.
+size_t applyFusedTransformations(vpux::Const::Content& content, ArrayRef<TransformAttrInterface> transformations);
+
 }  // namespace details
 }  // namespace Const
 }  // namespace vpux
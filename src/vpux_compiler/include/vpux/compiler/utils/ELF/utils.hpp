@@ -63,7 +63,6 @@ size_t lcm(size_t a, size_t b);
 elf::platform::ArchKind mapVpuArchKindToElfArchKind(const VPU::ArchKind& archKind);
 
 ArrayRef<uint8_t> getKernelELF(mlir::Operation* operation, StringRef kernelPath, ArrayRef<StringRef> sectionNames = {});
-ArrayRef<uint8_t> getDataAndSizeOfElfSection(ArrayRef<uint8_t> elfBlob, ArrayRef<StringRef> possibleSecNames);
 
 class SymbolReferenceMap {
 public:
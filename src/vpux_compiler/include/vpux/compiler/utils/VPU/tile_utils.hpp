@@ -47,6 +47,12 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::DequantizeOp origOp, const
 SmallVector<vpux::NDTypeInterface> getTileTypes(mlir::Operation* op, const TileInfo& outTile,
                                                 const std::optional<InputTiling>& inputTiles = std::nullopt);
 
+// Same as getTileTypes, but the distributed types are built for the given strategy instead of the
+// multiClusterStrategy attribute. The operation is not modified, so candidates can be evaluated concurrently
+SmallVector<vpux::NDTypeInterface> getTileTypesForStrategy(mlir::Operation* op, const TileInfo& outTile,
+                                                           VPU::MultiClusterStrategy strategy,
+                                                           const std::optional<InputTiling>& inputTiles = std::nullopt);
+
 // Permute
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEPermuteOp origOp, const TileInfo& outTile,
@@ -13,13 +13,14 @@
 namespace vpux {
 class BitCompactorCodec final : public ICodec {
 public:
-    BitCompactorCodec(VPU::ArchKind arch_kind);
+    BitCompactorCodec(VPU::ArchKind arch_kind, mlir::MLIRContext* ctx = nullptr);
     bool supportsFP16compression() const override;
     mlir::FailureOr<std::vector<uint8_t>> compress(std::vector<uint8_t>& data, const CompressionMode mode,
                                                    const Logger& _log) const override;
 
 private:
     vpux::bitc::ArchType arch_type_;
+    mlir::MLIRContext* ctx_;
 };
 
 }  // namespace vpux
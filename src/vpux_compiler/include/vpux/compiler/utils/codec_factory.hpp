@@ -25,5 +25,7 @@ public:
     static std::string compressionModeToStr(ICodec::CompressionMode mode);
 };
 
-std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch = VPU::ArchKind::UNKNOWN);
+// With non-null `ctx` the codec may use the context thread pool to compress independent parts of the data in parallel
+std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch = VPU::ArchKind::UNKNOWN,
+                                  mlir::MLIRContext* ctx = nullptr);
 }  // namespace vpux
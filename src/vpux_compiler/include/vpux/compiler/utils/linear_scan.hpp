@@ -29,10 +29,11 @@
 #include "vpux/utils/core/optional.hpp"
 #include "vpux/utils/core/small_vector.hpp"
 
+#include <llvm/ADT/DenseMap.h>
+
 #include <algorithm>
 #include <initializer_list>
 #include <limits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -47,7 +48,7 @@ public:
     using Direction = Partitioner::Direction;
     using LiveRangeVector = SmallVector<LiveRange>;
     using LiveRangeIter = typename LiveRangeVector::iterator;
-    using AllocatedAddrs = std::unordered_map<const LiveRange*, std::pair<AddressType, AddressType>>;
+    using AllocatedAddrs = llvm::DenseMap<const LiveRange*, std::pair<AddressType, AddressType>>;
     using ReservedAddressAndSizeVector = ArrayRef<std::pair<vpux::AddressType, vpux::AddressType>>;
 
 public:
@@ -124,7 +125,9 @@ public:
         for (auto curIt = newLiveRanges.begin(); curIt != newLiveRanges.end(); ++curIt) {
             const auto& newRange = *curIt;
 
-            const auto addr = allocatedAddrs.at(&newRange).first;
+            const auto addrIt = allocatedAddrs.find(&newRange);
+            assert(addrIt != allocatedAddrs.end());
+            const auto addr = addrIt->second.first;
             assert(addr != InvalidAddress);
 
             _handler.allocated(newRange, addr);
@@ -136,7 +139,7 @@ public:
 
     template <class LiveRanges>
     bool canAlloc(const LiveRanges& newLiveRanges, Direction dir = Direction::Up) {
-        auto gapCountBefore = _par.gaps().size();
+        auto gapCountBefore = _par.numGaps();
         bool canAllocAll = true;
         SmallVector<std::pair<vpux::AddressType, vpux::AddressType>> tempAlloc;
         // temp allocation
@@ -157,7 +160,7 @@ public:
             vpux::AddressType size = curIt->second;
             _par.free(address, size);
         }
-        VPUX_THROW_UNLESS(gapCountBefore == _par.gaps().size(), "Error new gaps created");
+        VPUX_THROW_UNLESS(gapCountBefore == _par.numGaps(), "Error new gaps created");
         return canAllocAll;
     }
 
@@ -193,10 +196,14 @@ public:
         return _par.maxFreeSize();
     }
 
-    const auto& gaps() const {
+    auto gaps() const {
         return _par.gaps();
     }
 
+    Partitioner::Backend backend() const {
+        return _par.backend();
+    }
+
 private:
     bool allocFixedRange(const LiveRange& newRange, bool allowSpills, AllocatedAddrs& allocatedAddrs) {
         assert(_handler.isFixedAlloc(newRange));
@@ -16,6 +16,11 @@ namespace vpux {
 void addLogging(mlir::MLIRContext& ctx, Logger log);
 void addLogging(mlir::PassManager& pm, Logger log);
 
+// Reports which part of the pipeline wall time was spent in function-nested segments,
+// which can run in parallel across functions, and how many module-level passes split them.
+// The report is logged at info level when the pass manager is destroyed.
+void addParallelismReport(mlir::PassManager& pm, Logger log);
+
 class OpBuilderLogger final : public mlir::OpBuilder::Listener {
 public:
     explicit OpBuilderLogger(Logger log): _log(log) {
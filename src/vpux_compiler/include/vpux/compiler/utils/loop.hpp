@@ -17,14 +17,35 @@ enum class LoopExecPolicy {
     Parallel,
 };
 
-void loop_1d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, vpux::FuncRef<void(int64_t)> func);
+// Cost hint value for loops with unknown per-iteration cost, every iteration is considered expensive enough
+// to be scheduled separately
+constexpr int64_t LOOP_COST_UNKNOWN = 0;
+
+// Parallel loops split the flattened iteration space into chunks that are dynamically claimed by the thread pool
+// workers and by the calling thread, so uneven iterations and a pool shared with other work do not leave cores idle.
+// Nested parallel loops are allowed: the calling thread always participates in the work and never waits idle.
+//
+// `costHint` is an estimation of the cost of a single iteration (e.g. number of elements or bytes processed).
+// It is used to choose the chunk size, so each chunk amortizes the scheduling overhead, and to run
+// cheap loops sequentially.
+
+void loop_1d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, vpux::FuncRef<void(int64_t)> func,
+             int64_t costHint = LOOP_COST_UNKNOWN);
 
 void loop_2d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1,
-             FuncRef<void(int64_t, int64_t)> func);
+             FuncRef<void(int64_t, int64_t)> func, int64_t costHint = LOOP_COST_UNKNOWN);
 
 void loop_3d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1, int64_t dim2,
-             FuncRef<void(int64_t, int64_t, int64_t)> func);
+             FuncRef<void(int64_t, int64_t, int64_t)> func, int64_t costHint = LOOP_COST_UNKNOWN);
 
 void loop_4d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1, int64_t dim2, int64_t dim3,
-             FuncRef<void(int64_t, int64_t, int64_t, int64_t)> func);
+             FuncRef<void(int64_t, int64_t, int64_t, int64_t)> func, int64_t costHint = LOOP_COST_UNKNOWN);
+
+namespace details {
+
+// Returns the number of iterations claimed at once by a worker
+int64_t getLoopGrainSize(int64_t numIterations, int64_t numThreads, int64_t costHint);
+
+}  // namespace details
+
 }  // namespace vpux
@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Offline placement of buffers with known live ranges.
+// Each buffer is a rectangle of (live range x size) and placement packs the rectangles into the memory,
+// so that the buffers which are alive at the same time don't overlap. Unlike LinearScan, which places
+// the buffers greedily in schedule order, the whole set of live ranges is known in advance,
+// so the buffers are placed by decreasing size with best fit and the order is refined by a local search.
+//
+
+#pragma once
+
+#include "vpux/compiler/utils/partitioner.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <optional>
+#include <utility>
+
+namespace vpux {
+
+class OfflinePlacement final {
+public:
+    struct Buffer final {
+        AddressType size = 0;
+        AddressType alignment = 1;
+        // Live range in schedule steps, the end is exclusive
+        size_t begin = 0;
+        size_t end = 0;
+        // Address of the buffers which can't be moved
+        std::optional<AddressType> fixedAddress;
+    };
+
+    struct Statistics final {
+        // End of the highest buffer, aligned
+        AddressType peakUsage = 0;
+        // Average over the schedule steps of the unused part of the memory below the highest alive buffer
+        double fragmentation = 0.0;
+    };
+
+public:
+    // `reserved` are (address, size) ranges which are occupied during the whole schedule
+    explicit OfflinePlacement(AddressType totalSize, ArrayRef<std::pair<AddressType, AddressType>> reserved = {});
+
+public:
+    // Returns the addresses of the buffers or std::nullopt if they don't fit into the memory.
+    // The result doesn't depend on the time of the search: `maxIterations` bounds the number of
+    // refinement steps, each of them places all the buffers once. For large sets of buffers the number
+    // of steps is lowered further, so that the total number of buffer placements stays bounded
+    std::optional<SmallVector<AddressType>> place(ArrayRef<Buffer> buffers, size_t maxIterations = 16) const;
+
+    static Statistics getStatistics(ArrayRef<Buffer> buffers, ArrayRef<AddressType> addresses);
+
+private:
+    // `overlaps` are the indices of the buffers which are alive at the same time as each buffer
+    std::optional<SmallVector<AddressType>> placeInOrder(ArrayRef<Buffer> buffers,
+                                                         ArrayRef<SmallVector<size_t>> overlaps,
+                                                         ArrayRef<size_t> order) const;
+
+private:
+    AddressType _totalSize = 0;
+    SmallVector<std::pair<AddressType, AddressType>> _reserved;
+};
+
+}  // namespace vpux
@@ -7,10 +7,18 @@
 // Partitioner finds and allocates unused portion of memory from the contiguous
 // memory array; returns the portion back after their usage is finished
 //
+// Two interchangeable backends produce the same allocations:
+//   * Linear keeps the gaps in a sorted vector and scans all of them for the best fit.
+//   * Indexed keeps the gaps in balanced trees ordered by address and by size,
+//     so the best fit lookup and the coalescing on free are logarithmic.
+//
 
 #pragma once
 
 #include <limits>
+#include <map>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include <cassert>
@@ -26,6 +34,8 @@ class Partitioner final {
 public:
     enum class Direction { Up, Down };
 
+    enum class Backend { Linear, Indexed };
+
     struct Gap final {
         AddressType begin;
         AddressType end;
@@ -37,7 +47,11 @@ public:
     };
 
 public:
-    explicit Partitioner(AddressType totalSize);
+    explicit Partitioner(AddressType totalSize, Backend backend = getDefaultBackend());
+
+    // Backend used when none is specified. Developer builds allow to override it
+    // with IE_NPU_PARTITIONER_BACKEND environment variable (`linear` or `indexed`)
+    static Backend getDefaultBackend();
 
 public:
     AddressType alloc(AddressType size, AddressType alignment = 1, Direction dir = Direction::Up);
@@ -53,25 +67,49 @@ public:
         return _totalSize;
     }
 
+    Backend backend() const {
+        return _backend;
+    }
+
     AddressType totalFreeSize() const;
 
     AddressType maxFreeSize() const;
 
-    const std::vector<Gap>& gaps() const {
-        return _gaps;
-    }
+    size_t numGaps() const;
+
+    // Free gaps sorted by address
+    std::vector<Gap> gaps() const;
 
 public:
     static bool intersects(AddressType addr1, AddressType size1, AddressType addr2, AddressType size2);
 
 private:
-    AddressType getAddrFromGap(size_t pos, AddressType size, AddressType alignment, Direction dir);
+    static AddressType getAddrFromGap(const Gap& g, AddressType size, AddressType alignment, Direction dir);
     AddressType useGap(size_t pos, AddressType alignedBegin, AddressType size);
     AddressType chooseMinimalGap(AddressType size, AddressType alignment, Direction dir);
 
+    void allocFixedLinear(AddressType addr, AddressType size);
+    void freeLinear(AddressType addr, AddressType size);
+
+    void insertIndexedGap(AddressType begin, AddressType end);
+    void eraseIndexedGap(AddressType begin, AddressType end);
+    AddressType useIndexedGap(const Gap& g, AddressType alignedBegin, AddressType size);
+    AddressType chooseMinimalIndexedGap(AddressType size, AddressType alignment, Direction dir);
+    void allocFixedIndexed(AddressType addr, AddressType size);
+    void freeIndexed(AddressType addr, AddressType size);
+
 private:
-    std::vector<Gap> _gaps;
     AddressType _totalSize = 0;
+    Backend _backend = Backend::Linear;
+
+    // Linear backend
+    std::vector<Gap> _gaps;
+
+    // Indexed backend: gap begin -> gap end
+    std::map<AddressType, AddressType> _gapsByBegin;
+    // Indexed backend: (gap size, gap begin)
+    std::set<std::pair<AddressType, AddressType>> _gapsBySize;
+    AddressType _freeSize = 0;
 };
 
 }  // namespace vpux
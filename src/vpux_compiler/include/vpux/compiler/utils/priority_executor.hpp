@@ -0,0 +1,123 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/logger.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace vpux {
+
+//
+// PriorityExecutor
+//
+// Executes tasks on dedicated worker threads with two priority levels:
+// - Foreground tasks are always dequeued before the background ones. A queued background task can be promoted to
+//   the foreground level, or taken over by the thread which is about to block on its result.
+// - Background tasks run on workers with the idle OS scheduling priority where it is supported, so the foreground
+//   work of the process (e.g. the MLIR thread pool) preempts them and they effectively use only the idle cores.
+//   Workers which failed to lower their priority run at most `maxNormalPriorityTasks` background tasks at once.
+//   Where the idle priority is not available (e.g. unprivileged Linux threads with RLIMIT_NICE at 0), all workers
+//   run background tasks with the normal priority and yield the core between them, while the foreground queue is
+//   still served first.
+// - A thread blocked in `runOrWait` on a task which is running on an idle priority worker raises the priority of
+//   that worker until the task is finished, so the waiter does not depend on the idle cores. The idle priority is
+//   used only if it can be reverted, otherwise all workers run with the normal priority.
+//
+
+enum class TaskPriority { Foreground, Background };
+
+class PriorityExecutor final {
+public:
+    using TaskId = uint64_t;
+
+    struct Statistics final {
+        size_t numForegroundTasks = 0;
+        size_t numBackgroundTasks = 0;
+        size_t numPromotedTasks = 0;
+        size_t numTasksRunByWaiter = 0;
+        size_t numBoostedTasks = 0;
+        size_t numCanceledTasks = 0;
+        size_t maxQueueDepth = 0;
+        std::chrono::microseconds totalWaitTime{0};
+        std::chrono::microseconds maxWaitTime{0};
+    };
+
+public:
+    PriorityExecutor(size_t numThreads, size_t maxNormalPriorityTasks, Logger log = Logger::global());
+    ~PriorityExecutor();
+
+    PriorityExecutor(const PriorityExecutor&) = delete;
+    PriorityExecutor(PriorityExecutor&&) = delete;
+    PriorityExecutor& operator=(const PriorityExecutor&) = delete;
+    PriorityExecutor& operator=(PriorityExecutor&&) = delete;
+
+public:
+    TaskId submit(std::function<void()> task, TaskPriority priority);
+
+    // Moves the queued background task to the foreground queue. Returns false if the task has already started
+    bool promote(TaskId id);
+
+    // Runs the task on the calling thread if it is still queued, or waits for its completion otherwise
+    void runOrWait(TaskId id);
+
+    // Drops the queued tasks and waits for the running ones
+    void cancelPending();
+
+    size_t getQueueDepth() const;
+    size_t getNumIdlePriorityWorkers() const;
+    Statistics getStatistics() const;
+
+private:
+    struct Task final {
+        TaskId id = 0;
+        TaskPriority priority = TaskPriority::Background;
+        std::function<void()> func;
+        std::chrono::steady_clock::time_point submitTime;
+    };
+
+    void workerLoop(size_t workerIndex);
+    bool popTask(Task& task, size_t workerIndex, bool isIdlePriorityWorker);
+    void runTask(const Task& task);
+    bool finishTask(const Task& task, std::optional<size_t> idleWorkerIndex);
+    void boostWorker(size_t workerIndex);
+    void updateWaitTime(const Task& task);
+    bool extractQueuedTask(std::deque<Task>& queue, TaskId id, Task& task);
+
+private:
+    Logger _log;
+    const size_t _maxNormalPriorityTasks;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _taskAvailable;
+    std::condition_variable _taskFinished;
+
+    std::deque<Task> _foregroundQueue;
+    std::deque<Task> _backgroundQueue;
+    // Maps the running tasks to the index of the idle priority worker executing them, if any
+    std::unordered_map<TaskId, std::optional<size_t>> _runningTasks;
+    std::vector<bool> _boostedWorkers;
+    bool _useIdlePriority = false;
+    TaskId _nextTaskId = 0;
+    size_t _numNormalPriorityBackgroundTasks = 0;
+    size_t _numIdlePriorityWorkers = 0;
+    bool _stopped = false;
+
+    Statistics _statistics;
+
+    std::vector<std::thread> _workers;
+};
+
+}  // namespace vpux
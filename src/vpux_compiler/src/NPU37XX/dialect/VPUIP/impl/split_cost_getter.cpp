@@ -8,59 +8,84 @@
 
 using namespace vpux;
 
+namespace {
+
+// Correct invalid input channels for depthwise workload before passing to VPUNN
+// split to produce more small and valid workloads
+void appendCorrectWorkloads(const WorkloadTile& wl, const WorkloadCostParams& params,
+                            std::vector<WorkloadTile>& correctWls) {
+    const SmallVector<int64_t> supportedChannelsDW = {64, 32, 16};
+
+    // Split workload channel to satisfy HW limit for depthwise ops before passing to VPUNN
+    const auto wlChannel = std::get<0>(wl).shape[Dims4D::Act::C];
+    if ((params.nceTaskType != NCETaskType::DWCONV && params.nceTaskType != NCETaskType::MAXPOOL &&
+         params.nceTaskType != NCETaskType::AVEPOOL) ||
+        std::find(supportedChannelsDW.begin(), supportedChannelsDW.end(), wlChannel) != supportedChannelsDW.end()) {
+        correctWls.push_back(wl);
+        return;
+    }
+
+    const auto validWorkloadChannels = splitWorkloadChannel(wlChannel, supportedChannelsDW);
+    VPUX_THROW_WHEN(validWorkloadChannels.size() == 0,
+                    "splitWorkloadChannel failed please check wlChannel - {0}, supportedChannelsDW - {1}", wlChannel,
+                    supportedChannelsDW);
+    auto newWl = wl;
+    for (auto validChannel : validWorkloadChannels) {
+        std::get<0>(newWl).shape[Dims4D::Act::C] = validChannel;
+        correctWls.push_back(newWl);
+    }
+}
+
+}  // namespace
+
 int64_t VPUIP::arch37xx::computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
                                           VPUNN::VPUCostModel& costModel, LogCb logCb) {
-    std::vector<int64_t> workloadCost;
-    workloadCost.reserve(split.size());
-
-    std::string vpunnInputCheckInfo;
+    return computeSplitPoolCosts(ArrayRef<WorkloadSplit>(split), params, costModel, logCb).front();
+}
 
-    // Correct invalid input channels for depthwise workload before passing to VPUNN
-    // split to produce more small and valid workloads
-    const SmallVector<int64_t> supportedChannelsDW = {64, 32, 16};
-    auto correctDepthwiseWorkloadChannel = [=](const WorkloadTile& wl) {
-        auto wlChannel = std::get<0>(wl).shape[Dims4D::Act::C];
-        SmallVector<int64_t> validWorkloadChannels;
-        std::vector<WorkloadTile> newWorkloads;
-        auto newWl = wl;
-        validWorkloadChannels = splitWorkloadChannel(wlChannel, supportedChannelsDW);
-        VPUX_THROW_WHEN(validWorkloadChannels.size() == 0,
-                        "splitWorkloadChannel failed please check wlChannel - {0}, supportedChannelsDW - {1}",
-                        wlChannel, supportedChannelsDW);
-        for (auto validChannel : validWorkloadChannels) {
-            std::get<0>(newWl).shape[Dims4D::Act::C] = validChannel;
-            newWorkloads.push_back(newWl);
-        }
-        return newWorkloads;
-    };
+SmallVector<int64_t> VPUIP::arch37xx::computeSplitPoolCosts(ArrayRef<WorkloadSplit> splits,
+                                                            const WorkloadCostParams& params,
+                                                            VPUNN::VPUCostModel& costModel, LogCb logCb) {
+    // The workloads of all the splits are collected into a single batch, as different splits usually share most of
+    // their workloads
+    std::vector<VPUNN::DPUWorkload> vpunnWorkloads;
+    SmallVector<size_t> splitOffsets;
+    splitOffsets.reserve(splits.size() + 1);
 
     std::vector<WorkloadTile> correctWls;
-    for (const auto& wl : split) {
-        correctWls.push_back(wl);
-        // Split workload channel to satisfy HW limit for depthwise ops before passing to VPUNN
-        if (params.nceTaskType == NCETaskType::DWCONV || params.nceTaskType == NCETaskType::MAXPOOL ||
-            params.nceTaskType == NCETaskType::AVEPOOL) {
-            auto wlChannel = std::get<0>(wl).shape[Dims4D::Act::C];
-            if (std::find(supportedChannelsDW.begin(), supportedChannelsDW.end(), wlChannel) ==
-                supportedChannelsDW.end()) {
-                correctWls = correctDepthwiseWorkloadChannel(wl);
+    for (const auto& split : splits) {
+        splitOffsets.push_back(vpunnWorkloads.size());
+        for (const auto& wl : split) {
+            correctWls.clear();
+            appendCorrectWorkloads(wl, params, correctWls);
+            for (const auto& correctWl : correctWls) {
+                vpunnWorkloads.push_back(VPU::getDPUWorkload(params, correctWl));
             }
         }
+    }
+    splitOffsets.push_back(vpunnWorkloads.size());
+
+    SmallVector<std::string> vpunnInputCheckInfos;
+    const auto vpunnCosts = VPU::getDPUWorkloadCosts(costModel, vpunnWorkloads, vpunnInputCheckInfos);
+
+    SmallVector<int64_t> splitCosts;
+    splitCosts.reserve(splits.size());
+    for (const auto splitInd : irange(splits.size())) {
+        std::vector<int64_t> workloadCost;
+        workloadCost.reserve(splitOffsets[splitInd + 1] - splitOffsets[splitInd]);
 
-        for (const auto& correctWl : correctWls) {
-            const auto vpunnWorkload = VPU::getDPUWorkload(params, correctWl);
-            auto wlCost =
-                    VPU::checkAndReturnCost(costModel.DPU(vpunnWorkload, vpunnInputCheckInfo), Logger::global(), true);
+        for (auto wlInd = splitOffsets[splitInd]; wlInd < splitOffsets[splitInd + 1]; ++wlInd) {
+            auto wlCost = VPU::checkAndReturnCost(vpunnCosts[wlInd], Logger::global(), true);
             if (wlCost >= VPU::INVALID_COST_BASE) {
                 logCb(formatv("[VPUNN LOG] INVALID_COST is caught. Please check possible VPUNN debug info: {0}",
-                              vpunnInputCheckInfo));
-                VPU::printVPUNNWorkloadConfig(vpunnWorkload, logCb);
+                              vpunnInputCheckInfos[wlInd]));
+                VPU::printVPUNNWorkloadConfig(vpunnWorkloads[wlInd], logCb);
             }
             workloadCost.push_back(static_cast<int64_t>(wlCost));
         }
 
-        correctWls.clear();
+        splitCosts.push_back(VPUNN::dpu_schedule(checked_cast<unsigned int>(params.numDPU), workloadCost));
     }
 
-    return VPUNN::dpu_schedule(checked_cast<unsigned int>(params.numDPU), workloadCost);
+    return splitCosts;
 }
@@ -5,9 +5,61 @@
 
 #include <vpux_elf/writer.hpp>
 #include "vpux/compiler/NPU40XX/dialect/ELF/ops.hpp"
+#include "vpux/compiler/utils/loop.hpp"
 
 using namespace vpux;
 
+namespace {
+
+// Bound of the temporary storage for the concurrent serialization, a single op may still exceed it
+constexpr size_t PARALLEL_SERIALIZATION_CHUNK_SIZE = 64 * 1024 * 1024;
+
+// The section is split into chunks of consecutive ops. The chunk layout is computed first, then the ops are
+// serialized concurrently straight into their place in the chunk, and the whole chunk is appended at once.
+// Sections of constants are this way folded in parallel without a temporary buffer per constant
+void serializeInParallel(mlir::MLIRContext* ctx, ArrayRef<ELF::BinaryOpInterface> binaryOps,
+                         ELF::SymbolReferenceMap& symRefMap, elf::writer::BinaryDataSection<uint8_t>& section) {
+    SmallVector<size_t> sizes;
+    sizes.reserve(binaryOps.size());
+    for (auto binaryOp : binaryOps) {
+        sizes.push_back(binaryOp.getBinarySizeCached(symRefMap));
+    }
+
+    std::unique_ptr<uint8_t[]> chunk;
+    size_t chunkCapacity = 0;
+    SmallVector<size_t> offsets;
+    for (size_t chunkBegin = 0; chunkBegin < binaryOps.size();) {
+        offsets.clear();
+        size_t chunkSize = 0;
+        auto chunkEnd = chunkBegin;
+        while (chunkEnd < binaryOps.size() &&
+               (chunkEnd == chunkBegin || chunkSize + sizes[chunkEnd] <= PARALLEL_SERIALIZATION_CHUNK_SIZE)) {
+            offsets.push_back(chunkSize);
+            chunkSize += sizes[chunkEnd];
+            ++chunkEnd;
+        }
+
+        if (chunkSize > chunkCapacity) {
+            // Left uninitialized, every byte is written by the ops
+            chunk.reset(new uint8_t[chunkSize]);
+            chunkCapacity = chunkSize;
+        }
+
+        loop_1d(LoopExecPolicy::Parallel, ctx, checked_cast<int64_t>(chunkEnd - chunkBegin), [&](int64_t ind) {
+            const auto opInd = chunkBegin + checked_cast<size_t>(ind);
+            auto binaryOp = binaryOps[opInd];
+            binaryOp.serializeToBuffer(MutableArrayRef<uint8_t>(chunk.get() + offsets[ind], sizes[opInd]));
+        });
+
+        if (chunkSize != 0) {
+            section.appendData(chunk.get(), chunkSize);
+        }
+        chunkBegin = chunkEnd;
+    }
+}
+
+}  // namespace
+
 void ELF::DataSectionOp::serialize(elf::Writer& writer, ELF::SectionMapType& sectionMap, ELF::SymbolMapType& symbolMap,
                                    ELF::SymbolReferenceMap& symRefMap) {
     VPUX_UNUSED(symbolMap);
@@ -16,11 +68,14 @@ void ELF::DataSectionOp::serialize(elf::Writer& writer, ELF::SectionMapType& sec
     section->maskFlags(static_cast<elf::Elf_Xword>(getSecFlags()));
     section->setAddrAlign(getSecAddrAlign());
 
-    auto block = getBody();
-    for (auto& op : block->getOperations()) {
-        if (op.hasTrait<ELF::BinaryOpInterface::Trait>()) {
-            auto binaryOp = llvm::cast<ELF::BinaryOpInterface>(op);
-
+    auto binaryOps = to_small_vector(getBody()->getOps<ELF::BinaryOpInterface>());
+    const auto canSerializeToBuffer = llvm::all_of(binaryOps, [](ELF::BinaryOpInterface binaryOp) {
+        return binaryOp.canSerializeToBuffer();
+    });
+    if (canSerializeToBuffer) {
+        serializeInParallel(getContext(), binaryOps, symRefMap, *section);
+    } else {
+        for (auto binaryOp : binaryOps) {
             binaryOp.serializeCached(*section, symRefMap);
         }
     }
@@ -21,3 +21,11 @@ void vpux::ELF::PadOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDat
 size_t vpux::ELF::PadOp::getBinarySize() {
     return getPaddingSize();
 }
+
+bool vpux::ELF::PadOp::canSerializeToBuffer() {
+    return true;
+}
+
+void vpux::ELF::PadOp::serializeToBuffer(MutableArrayRef<uint8_t> buffer) {
+    std::fill(buffer.begin(), buffer.end(), getPaddingValue().value_or(0));
+}
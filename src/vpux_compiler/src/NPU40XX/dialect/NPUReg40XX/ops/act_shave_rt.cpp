@@ -4,9 +4,8 @@
 //
 
 #include <mlir/IR/BuiltinTypes.h>
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/NPU40XX/dialect/NPUReg40XX/ops.hpp"
+#include "vpux/compiler/act_kernels/shave_binary_resources.h"
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
 using namespace vpux;
@@ -51,19 +50,13 @@ bool vpux::NPUReg40XX::ActShaveRtOp::hasMemoryFootprint() {
 uint32_t vpux::NPUReg40XX::ActShaveRtOp::getKernelEntry() {
     const auto elfBlob = ELF::getKernelELF(getOperation(), getKernelPath());
 
-    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
-    auto elf_reader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
-
-    auto actKernelHeader = elf_reader.getHeader();
-    return actKernelHeader->e_entry;
+    return ShaveBinaryResources::getInstance().getKernelInfo(elfBlob).entryPoint;
 }
 
 uint32_t vpux::NPUReg40XX::ActShaveRtOp::getVersion() {
-    const auto elfBlob = ELF::getKernelELF(getOperation(), getKernelPath());
-
-    auto secDataSizePair = ELF::getDataAndSizeOfElfSection(elfBlob, {".versiondata"});
+    const auto versionData = ELF::getKernelELF(getOperation(), getKernelPath(), {".versiondata"});
 
-    auto nnActEntryRtVersion = reinterpret_cast<const uint32_t*>(secDataSizePair.data());
+    auto nnActEntryRtVersion = reinterpret_cast<const uint32_t*>(versionData.data());
 
     return *nnActEntryRtVersion;
 }
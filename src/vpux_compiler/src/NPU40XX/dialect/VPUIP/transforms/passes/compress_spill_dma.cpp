@@ -135,7 +135,7 @@ private:
     void clearIndexAttr(const SmallVector<VPURT::TaskOp>& taskOpsVec);
     size_t getTaskIndex(VPURT::TaskOp taskOp);
 
-    void safeRunOnModule() final;
+    void safeRunOnFunc() final;
 
     mlir::StringAttr _taskIndexAttrName;
     int64_t _tileCount = 0;
@@ -507,16 +507,11 @@ void CompressSpillDmaPass::convertSpillsToCompressOps(mlir::MLIRContext* ctx,
     }
 }
 
-void CompressSpillDmaPass::safeRunOnModule() {
-    // TODO: E#116060 This pass needs to work on function level
-    // as spill ids are only unique within single function
-    auto module = getOperation();
-    auto* ctx = module->getContext();
-
-    IE::CNNNetworkOp netOp;
-    mlir::func::FuncOp func;
-    IE::CNNNetworkOp::getFromModule(module, netOp, func);
-    mlir::OpBuilder builder(&func.getBody().front().front());
+void CompressSpillDmaPass::safeRunOnFunc() {
+    // Spill ids are only unique within single function, so each function is processed independently
+    auto func = getOperation();
+    auto module = func->getParentOfType<mlir::ModuleOp>();
+    auto* ctx = func->getContext();
 
     auto tileOp = IE::getTileExecutor(module);
     VPUX_THROW_UNLESS(tileOp != nullptr, "Failed to get NCE_Cluster information");
@@ -229,14 +229,14 @@ void ComputeTaskStrippingPass::safeRunOnFunc() {
     for (size_t barInd = 0; barInd < numOfBarriers; barInd++) {
         if (!allBarrierProducersLegal(barrierInfo.getBarrierOpAtIndex(barInd), barrierInfo)) {
             auto taskListToErase = legalizeBarrierProducers(barrierInfo.getBarrierOpAtIndex(barInd), barrierInfo);
-            tasksToErase.insert(taskListToErase.begin(), taskListToErase.end());
+            tasksToErase.merge(taskListToErase);
         }
     }
     // Handle consumers
     for (size_t barInd = (numOfBarriers - 1); barInd > 0; barInd--) {
         if (!allBarrierConsumersLegal(barrierInfo.getBarrierOpAtIndex(barInd), barrierInfo)) {
             auto taskListToErase = legalizeBarrierConsumers(barrierInfo.getBarrierOpAtIndex(barInd), barrierInfo);
-            tasksToErase.insert(taskListToErase.begin(), taskListToErase.end());
+            tasksToErase.merge(taskListToErase);
         }
     }
 
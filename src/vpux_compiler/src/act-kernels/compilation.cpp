@@ -69,11 +69,14 @@ ActKernelDesc compileKernelForACTShave(const CompilationUnitDesc& unitDesc, VPU:
     auto dataName = std::string(unitDesc.name) + ".data";
 
     // A copy is made for each vector in order not to modify their original content when padding is added
-    result.text = {unitDesc.name.data(), to_small_vector(textBinary), textBinary.size()};
+    result.text = {unitDesc.name.data(), {}, textBinary.size()};
     result.data = {std::move(dataName), to_small_vector(dataBinary), dataBinary.size()};
 
     // lets pad textBinary by 1K array at the end with FC CC FC CC
-    for (int i = 0; i != 512; i++) {
+    constexpr size_t textPaddingSize = 1024;
+    result.text.data.reserve(textBinary.size() + textPaddingSize);
+    result.text.data.append(textBinary.begin(), textBinary.end());
+    for (size_t i = 0; i != textPaddingSize / 2; i++) {
         result.text.data.push_back(0xFC);
         result.text.data.push_back(0xCC);
     }
@@ -5,6 +5,11 @@
 
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
 
+#include <vpux_elf/accessor.hpp>
+#include <vpux_elf/reader.hpp>
+
+#include <llvm/ADT/STLExtras.h>
+
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -25,3 +30,38 @@ llvm::ArrayRef<uint8_t> ShaveBinaryResources::getElf(llvm::StringRef kernelPath)
     const auto [symbolData, symbolSize] = it->second;
     return llvm::ArrayRef<uint8_t>(symbolData, symbolSize);
 }
+
+const ShaveKernelInfo& ShaveBinaryResources::getKernelInfo(llvm::ArrayRef<uint8_t> elfBlob) const {
+    std::lock_guard<std::mutex> lock(_kernelInfoMutex);
+
+    const auto it = _kernelInfoCache.find(elfBlob.data());
+    if (it != _kernelInfoCache.end()) {
+        return it->second;
+    }
+
+    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
+    auto elfReader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
+
+    ShaveKernelInfo info;
+    info.entryPoint = elfReader.getHeader()->e_entry;
+    for (size_t i = 0; i < elfReader.getSectionsNum(); ++i) {
+        auto section = elfReader.getSection(i);
+        const auto sectionSize = section.getHeader()->sh_size;
+        info.sections.emplace_back(section.getName(), llvm::ArrayRef<uint8_t>(section.getData<uint8_t>(), sectionSize));
+    }
+
+    return _kernelInfoCache.emplace(elfBlob.data(), std::move(info)).first->second;
+}
+
+llvm::ArrayRef<uint8_t> ShaveKernelInfo::getSection(llvm::ArrayRef<llvm::StringRef> possibleNames) const {
+    // The last matching section wins, as it did with the lookup over the ELF sections
+    const std::pair<std::string, llvm::ArrayRef<uint8_t>>* foundSection = nullptr;
+    for (const auto& section : sections) {
+        if (llvm::is_contained(possibleNames, section.first)) {
+            foundSection = &section;
+        }
+    }
+    VPUX_THROW_UNLESS(foundSection != nullptr, "Section {0} not found in ELF", possibleNames);
+
+    return foundSection->second;
+}
@@ -20,6 +20,10 @@ public:
         assert(byte_index < array_bytes_);
         return reinterpret_cast<uint8_t*>(bit_array_.data()) + byte_index;
     }
+    const uint8_t* get_byte_pointer(const uint32_t& byte_index) const {
+        assert(byte_index < array_bytes_);
+        return reinterpret_cast<const uint8_t*>(bit_array_.data()) + byte_index;
+    }
     uint32_t stream_length();
     uint32_t source_stream_length() {
         return source_byte_count_;
@@ -8,61 +8,83 @@
 #include "commons.hpp"
 
 #include <algorithm>
+#include <bitset>
 #include <cassert>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
 using namespace vpux::bitc;
 
+namespace {
+
+// Number of input blocks encoded by one task, 16 KB of the input
+const uint32_t BLOCKS_PER_CHUNK{256u};
+
+// The bit length LUTs depend only on the highest set bit of the value, so the bit length of the largest value
+// in a block is the bit length of the bitwise OR of all the values. Unlike the per element LUT lookups
+// and comparisons, the OR reduction is vectorized by the compiler.
+uint8_t reduce_or(const uint8_t* p_data, uint32_t block_size) {
+    uint8_t result{};
+    for (uint32_t i{}; i < block_size; ++i) {
+        result |= p_data[i];
+    }
+    return result;
+}
+
+}  // namespace
+
 class Encoder::Impl {
 public:
     Impl();
+    explicit Impl(ParallelFor parallel_for);
     void encode(const BitCompactorConfig& config, const std::vector<uint8_t>& in, std::vector<uint8_t>& out);
 
 private:
-    typedef void (Encoder::Impl::*AlgorithmEncoder)(AlgorithmParam& param);
+    // Encoding of a block only reads the state of the encoder, so the blocks can be encoded concurrently
+    using BlockParams = std::array<AlgorithmParam, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)>;
+
+    typedef void (Encoder::Impl::*AlgorithmEncoder)(AlgorithmParam& param) const;
     void verify_config(const BitCompactorConfig& config);
     void fp16enprdct(const unsigned char* src, const unsigned int srcLen, unsigned char* dst, const unsigned BLKSIZE);
 
-    void binexpproc(AlgorithmParam& param);
-    void btexpproc(AlgorithmParam& param);
-    void muprdct(AlgorithmParam& param);
-    void minprdct(AlgorithmParam& param);
-    void minsprdct(AlgorithmParam& param);
-    void medprdct(AlgorithmParam& param);
-    void noprdct(AlgorithmParam& param);
-    void nosprdct(AlgorithmParam& param);
-    void dummyprdct(AlgorithmParam& param);
-    void prevblkprdct(AlgorithmParam& param);
-    void dual_encode(AlgorithmParam& param);
-    void write_residual(const BitCompactorConfig& config, BitStream& stream, const AlgorithmParam& param);
-    uint32_t to_unsigned(int8_t* p_data, uint8_t* p_data_out, const uint32_t& block_size);
+    void binexpproc(AlgorithmParam& param) const;
+    void btexpproc(AlgorithmParam& param) const;
+    void muprdct(AlgorithmParam& param) const;
+    void minprdct(AlgorithmParam& param) const;
+    void minsprdct(AlgorithmParam& param) const;
+    void medprdct(AlgorithmParam& param) const;
+    void noprdct(AlgorithmParam& param) const;
+    void nosprdct(AlgorithmParam& param) const;
+    void dummyprdct(AlgorithmParam& param) const;
+    void prevblkprdct(AlgorithmParam& param) const;
+    void dual_encode(AlgorithmParam& param) const;
+    void write_residual(const BitCompactorConfig& config, BitStream& stream, const AlgorithmParam& param) const;
+    uint32_t to_unsigned(int8_t* p_data, uint8_t* p_data_out, const uint32_t& block_size) const;
     void init(const BitCompactorConfig& config, const std::vector<uint8_t>& in);
     void fp16_preprocess(uint32_t input_bytes);
     void pack_sparse_data(const BitCompactorConfig& config);
-    void init_block_param(AlgorithmParam& block_param, uint8_t* p_input_block, uint32_t algo);
-    void add_overhead_and_padding(const BitCompactorConfig& config, AlgorithmParam& block_param, uint32_t algo);
-    bool is_algo_dual_encode_compatible(const BitCompactorConfig& config, uint32_t algo);
-    bool is_algo_valid(uint32_t algo, int blk);
-    uint64_t get_dual_encode_len(const BitCompactorConfig& config, AlgorithmParam& block_param);
-    BestAlgorithm get_best_algorithm(const BitCompactorConfig& config, int blk,
-                                     std::vector<AlgorithmParam>& block_params);
+    void init_block_param(AlgorithmParam& block_param, uint8_t* p_input_block, uint32_t algo) const;
+    void add_overhead_and_padding(const BitCompactorConfig& config, AlgorithmParam& block_param, uint32_t algo) const;
+    bool is_algo_dual_encode_compatible(const BitCompactorConfig& config, uint32_t algo) const;
+    bool is_algo_valid(uint32_t algo, int blk) const;
+    uint64_t get_dual_encode_len(const BitCompactorConfig& config, AlgorithmParam& block_param) const;
+    BestAlgorithm get_best_algorithm(const BitCompactorConfig& config, int blk, BlockParams& block_params) const;
     CompressionHeader create_compression_header(const BitCompactorConfig& config, CompressionType type,
-                                                AlgorithmParam& block_param, uint32_t dual_encode = 0);
-    int write_dual_encode_header(const BitCompactorConfig& config, int blk, BitStream& blk_stream,
-                                 std::vector<AlgorithmParam>& block_params, BestAlgorithm& best_algorithm);
-    int write_compressed_header(const BitCompactorConfig& config, int blk, BitStream& blk_stream,
-                                std::vector<AlgorithmParam>& block_params, BestAlgorithm& best_algorithm);
-    void write_compressed_blk(const BitCompactorConfig& config, int blk, const bool using_dual_encoder,
-                              std::vector<BitStream>& block_stream, std::vector<AlgorithmParam>& block_params,
-                              BestAlgorithm& best_algorithm);
-    void write_uncompressed_blk(const BitCompactorConfig& config, int blk, std::vector<BitStream>& block_stream,
-                                std::vector<AlgorithmParam>& block_params);
-    void write_last_blk(uint32_t input_blocks, std::vector<BitStream>& block_stream, unsigned last_block_elements);
+                                                AlgorithmParam& block_param, uint32_t dual_encode = 0) const;
+    uint32_t write_dual_encode_header(const BitCompactorConfig& config, BitStream& blk_stream,
+                                      BlockParams& block_params, BestAlgorithm& best_algorithm) const;
+    uint32_t write_compressed_header(const BitCompactorConfig& config, BitStream& blk_stream,
+                                     BlockParams& block_params, BestAlgorithm& best_algorithm) const;
+    void write_compressed_blk(const BitCompactorConfig& config, const bool using_dual_encoder, BitStream& blk_stream,
+                              BlockParams& block_params, BestAlgorithm& best_algorithm) const;
+    void write_uncompressed_blk(const BitCompactorConfig& config, int blk, BitStream& blk_stream) const;
+    void write_blk(const BitCompactorConfig& config, int blk, BitStream& blk_stream) const;
+    void write_last_blk(uint32_t input_blocks, BitStream& last_blk_stream, unsigned last_block_elements) const;
     void write_to_output(std::vector<uint8_t>& out, std::vector<BitStream>& block_stream);
-    bool is_compression_better_than_uncompressed(BestAlgorithm& best_algorithm);
-    bool using_dual_encoder(BestAlgorithm& best_algorithm);
+    bool is_compression_better_than_uncompressed(BestAlgorithm& best_algorithm) const;
+    bool using_dual_encoder(BestAlgorithm& best_algorithm) const;
 
+    ParallelFor parallel_for_;
     BitStream bit_stream_in_;
     BitStream bit_stream_out_;
     uint32_t stream_bit_offset_in_{};
@@ -88,6 +110,10 @@ Encoder::Encoder() {
     impl_ = std::make_unique<Impl>();
 }
 
+Encoder::Encoder(ParallelFor parallel_for) {
+    impl_ = std::make_unique<Impl>(std::move(parallel_for));
+}
+
 void Encoder::encode(const BitCompactorConfig& config, const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
     impl_->encode(config, in, out);
 }
@@ -99,6 +125,10 @@ Encoder::Impl::Impl() {
     init(BitCompactorConfig{}, std::vector<uint8_t>());
 }
 
+Encoder::Impl::Impl(ParallelFor parallel_for): parallel_for_(std::move(parallel_for)) {
+    init(BitCompactorConfig{}, std::vector<uint8_t>());
+}
+
 const std::map<uint32_t, DecoderAlgorithm> Encoder::Impl::encoder_to_decoder_mapping_{
         {0, DecoderAlgorithm::ADDPROC},         {1, DecoderAlgorithm::SIGNSHFTADDPROC},
         {2, DecoderAlgorithm::SIGNSHFTADDPROC}, {3, DecoderAlgorithm::NOPROC},
@@ -195,47 +225,39 @@ void Encoder::Impl::fp16enprdct(const unsigned char* src, const unsigned int src
 
 // No Preprocess
 // No Predict, just look at the maximum in the array
-void Encoder::Impl::noprdct(AlgorithmParam& param) {
-    param.bit_length = 1u;
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        param.residual[i] = param.p_data[i];
-
-        const auto bits{log2_lut_[param.residual[i]]};
-
-        if (bits > param.bit_length) {
-            param.bit_length = bits;
-        }
-    }
+void Encoder::Impl::noprdct(AlgorithmParam& param) const {
+    std::memcpy(reinterpret_cast<void*>(param.residual), reinterpret_cast<const void*>(param.p_data), param.block_size);
 
+    param.bit_length = std::max<uint32_t>(1u, log2_lut_[reduce_or(param.residual, param.block_size)]);
     param.encoding_bits = param.bit_length * param.block_size;
 }
 
 // No Sign Preprocess
-void Encoder::Impl::nosprdct(AlgorithmParam& param) {
+void Encoder::Impl::nosprdct(AlgorithmParam& param) const {
     param.bit_length = to_unsigned(reinterpret_cast<int8_t*>(param.p_data), param.residual, param.block_size);
 
     param.encoding_bits = param.bit_length * param.block_size;
 }
 
-void Encoder::Impl::medprdct(AlgorithmParam& param) {
-    std::vector<uint8_t> data_sorted(param.block_size);
+void Encoder::Impl::medprdct(AlgorithmParam& param) const {
+    std::array<uint8_t, BLOCK_SIZE> data_sorted;
+    assert(param.block_size <= BLOCK_SIZE);
 
     std::memcpy(reinterpret_cast<void*>(data_sorted.data()), reinterpret_cast<const void*>(param.p_data),
                 param.block_size);
 
-    std::sort(std::begin(data_sorted), std::end(data_sorted));
-
+    // Only the median is needed, the rest of the block doesn't have to be sorted
     const auto med_indx{(param.block_size >> 1) - 1u};
+    std::nth_element(data_sorted.begin(), data_sorted.begin() + med_indx, data_sorted.begin() + param.block_size);
 
     param.minimum = data_sorted[med_indx];
 
     auto p_data{reinterpret_cast<int8_t*>(param.p_data)};
     auto p_residual{reinterpret_cast<int8_t*>(param.residual)};
-    auto& median{*reinterpret_cast<int8_t*>(&param.minimum)};
+    const auto median{static_cast<int8_t>(param.minimum)};
 
     for (uint32_t i{}; i < param.block_size; ++i) {
-        p_residual[i] = p_data[i] - median;
+        p_residual[i] = static_cast<int8_t>(p_data[i] - median);
     }
 
     param.bit_length = to_unsigned(p_residual, param.residual, param.block_size);
@@ -243,49 +265,38 @@ void Encoder::Impl::medprdct(AlgorithmParam& param) {
 }
 
 // Do Min Signed Predict algo on a buffer, return minimum number and the bitln
-void Encoder::Impl::minsprdct(AlgorithmParam& param) {
+void Encoder::Impl::minsprdct(AlgorithmParam& param) const {
     auto p_data{reinterpret_cast<int8_t*>(param.p_data)};
     auto p_residual{reinterpret_cast<int8_t*>(param.residual)};
-    auto& minimum{*reinterpret_cast<int8_t*>(&param.minimum)};
-
-    minimum = 127;
 
+    int8_t minimum{127};
     for (uint32_t i{}; i < param.block_size; ++i) {
-        if (p_data[i] < minimum) {
-            minimum = p_data[i];
-        }
+        minimum = std::min(minimum, p_data[i]);
     }
+    param.minimum = static_cast<uint8_t>(minimum);
 
     for (uint32_t i{}; i < param.block_size; ++i) {
-        p_residual[i] = p_data[i] - minimum;
+        p_residual[i] = static_cast<int8_t>(p_data[i] - minimum);
     }
 
     param.bit_length = to_unsigned(p_residual, param.residual, param.block_size);
     param.encoding_bits = param.bit_length * param.block_size;
 }
 
-uint32_t Encoder::Impl::to_unsigned(int8_t* p_data, uint8_t* p_data_out, const uint32_t& block_size) {
-    uint8_t bit_length{1};
-
+uint32_t Encoder::Impl::to_unsigned(int8_t* p_data, uint8_t* p_data_out, const uint32_t& block_size) const {
+    // Branchless form of `x < 0 ? (~x << 1) | 1 : x << 1`: the arithmetic shift gives all ones for negative values
     for (uint32_t i{}; i < block_size; ++i) {
-        if (p_data[i] < 0) {
-            p_data_out[i] = (static_cast<uint8_t>(~p_data[i] << 1) | 0x1);
-        } else {
-            p_data_out[i] = static_cast<uint8_t>(p_data[i] << 1);
-        }
-
-        const auto bits{log2_lut_[static_cast<uint8_t>(p_data_out[i])]};
-        if (bits > bit_length) {
-            bit_length = bits;
-        }
+        const auto value{static_cast<uint8_t>(p_data[i])};
+        const auto sign{static_cast<uint8_t>(p_data[i] >> 7)};
+        p_data_out[i] = static_cast<uint8_t>(value << 1) ^ sign;
     }
 
-    return static_cast<uint32_t>(bit_length);
+    return std::max<uint32_t>(1u, log2_lut_[reduce_or(p_data_out, block_size)]);
 }
 
 // Mean Preprocess
 // Do Mean Signed Predict algo on a buffer, return minimum number and the bitln.
-void Encoder::Impl::muprdct(AlgorithmParam& param) {
+void Encoder::Impl::muprdct(AlgorithmParam& param) const {
     auto p_data{reinterpret_cast<int8_t*>(param.p_data)};
     auto p_residual{reinterpret_cast<int8_t*>(param.residual)};
     int32_t mean{};
@@ -297,11 +308,11 @@ void Encoder::Impl::muprdct(AlgorithmParam& param) {
     double d_mean{static_cast<double>(mean) / static_cast<double>(param.block_size)};
     mean = static_cast<int32_t>(std::round(d_mean));
 
-    auto& mu{*reinterpret_cast<int8_t*>(&param.minimum)};
-    mu = static_cast<int8_t>(mean);
+    const auto mu{static_cast<int8_t>(mean)};
+    param.minimum = static_cast<uint8_t>(mu);
 
     for (uint32_t i{}; i < param.block_size; ++i) {
-        p_residual[i] = p_data[i] - mu;
+        p_residual[i] = static_cast<int8_t>(p_data[i] - mu);
     }
 
     param.bit_length = to_unsigned(p_residual, param.residual, param.block_size);
@@ -310,56 +321,49 @@ void Encoder::Impl::muprdct(AlgorithmParam& param) {
 
 // Min Preprocess
 // Do Min Predict algo on a buffer, return minimum number and the bitln.
-void Encoder::Impl::minprdct(AlgorithmParam& param) {
-    param.minimum = 255;
-
+void Encoder::Impl::minprdct(AlgorithmParam& param) const {
+    uint8_t minimum{255};
     for (uint32_t i{}; i < param.block_size; ++i) {
-        if (param.p_data[i] < param.minimum) {
-            param.minimum = param.p_data[i];
-        }
+        minimum = std::min(minimum, param.p_data[i]);
     }
-
-    param.bit_length = 1u;
+    param.minimum = minimum;
 
     for (uint32_t i{}; i < param.block_size; ++i) {
-        param.residual[i] = param.p_data[i] - param.minimum;
-        const auto residual_bits{log2_lut_[param.residual[i]]};
-
-        if (residual_bits > param.bit_length) {
-            param.bit_length = residual_bits;
-        }
+        param.residual[i] = static_cast<uint8_t>(param.p_data[i] - minimum);
     }
 
+    param.bit_length = std::max<uint32_t>(1u, log2_lut_[reduce_or(param.residual, param.block_size)]);
     param.encoding_bits = param.block_size * param.bit_length;
 }
 
-void Encoder::Impl::dummyprdct(AlgorithmParam& param) {
+void Encoder::Impl::dummyprdct(AlgorithmParam& param) const {
     param.bit_length = 8u;
 
     std::memcpy(reinterpret_cast<void*>(param.residual), reinterpret_cast<const void*>(param.p_data), param.block_size);
 
     param.encoding_bits = param.block_size * param.bit_length;
 }
-void Encoder::Impl::prevblkprdct(AlgorithmParam& param) {
+void Encoder::Impl::prevblkprdct(AlgorithmParam& param) const {
     const uint8_t* prev_blk = param.p_data - param.block_size;
 
     for (uint32_t i{}; i < param.block_size; ++i) {
-        param.residual[i] = param.p_data[i] - prev_blk[i];
+        param.residual[i] = static_cast<uint8_t>(param.p_data[i] - prev_blk[i]);
     }
     param.bit_length = to_unsigned(reinterpret_cast<int8_t*>(param.residual), param.residual, param.block_size);
     param.encoding_bits = param.bit_length * param.block_size;
 }
-void Encoder::Impl::binexpproc(AlgorithmParam& param) {
+void Encoder::Impl::binexpproc(AlgorithmParam& param) const {
     dummyprdct(param);
 }
 
-void Encoder::Impl::btexpproc(AlgorithmParam& param) {
+void Encoder::Impl::btexpproc(AlgorithmParam& param) const {
     dummyprdct(param);
 }
 
-void Encoder::Impl::dual_encode(AlgorithmParam& param) {
-    std::vector<uint32_t> bits_histogram(9);
-    std::vector<uint8_t> symbol_bits(param.block_size);
+void Encoder::Impl::dual_encode(AlgorithmParam& param) const {
+    std::array<uint32_t, 9> bits_histogram{};
+    std::array<uint8_t, BLOCK_SIZE> symbol_bits;
+    assert(param.block_size <= BLOCK_SIZE);
 
     for (uint32_t i{}; i < param.block_size; ++i) {
         symbol_bits[i] = dual_log2_lut_[param.residual[i]];
@@ -368,45 +372,32 @@ void Encoder::Impl::dual_encode(AlgorithmParam& param) {
 
     // For each of the bins, calculate the compressed Size.
     // And find the bitln that results in the minimum compressed Size.
-    uint32_t cumSumL{};
-    uint32_t cumSumH{};
-    std::vector<uint32_t> cSize(9);
-    param.dual_encoding_bits = ~0u;
+    // The symbols of bins 1..i are encoded with i bits, the rest with 8 bits
+    uint32_t total_symbols{};
+    for (int i = 1; i < 9; ++i) {
+        total_symbols += bits_histogram[i];
+    }
 
+    uint32_t cumSumL{};
     for (int i = 1; i < 9; ++i) {
-        cumSumL = 0u;
-        for (int j = 1; j <= i; ++j) {
-            cumSumL += bits_histogram[j];
-        }
-        cumSumH = 0;
-        for (int j = i + 1; j < 9; ++j) {
-            cumSumH += bits_histogram[j];
-        }
-        cSize[i] = cumSumL * i + cumSumH * 8;
+        cumSumL += bits_histogram[i];
+        const uint32_t cSize = cumSumL * i + (total_symbols - cumSumL) * 8;
         // Find the minimum compressed Size.
-        if (i == 1) {
-            param.dual_encoding_bits = cSize[i];
+        if (i == 1 || cSize < param.dual_encoding_bits) {
+            param.dual_encoding_bits = cSize;
             param.dual_bit_length = i;
-        } else {
-            if (cSize[i] < param.dual_encoding_bits) {
-                param.dual_encoding_bits = cSize[i];
-                param.dual_bit_length = i;
-            }
         }
     }
 
     param.dual_bitmap = 0ull;
-    bool using_8bits{false};
 
     for (uint32_t i{}; i < param.block_size; ++i) {
         const auto use_8bits{symbol_bits[i] > param.dual_bit_length};
 
         param.dual_bitmap |= (static_cast<uint64_t>(use_8bits)) << i;
-
-        using_8bits |= use_8bits;
     }
 
-    if (!using_8bits) {
+    if (param.dual_bitmap == 0ull) {
         param.dual_encoding_bits += (8u - param.dual_bit_length);
         param.dual_bitmap |= 0x1ull;
     }
@@ -418,7 +409,7 @@ void Encoder::Impl::fp16_preprocess(uint32_t input_bytes) {
     bit_stream_in_ = BitStream{processed_bits};
 }
 
-void Encoder::Impl::init_block_param(AlgorithmParam& block_param, uint8_t* p_input_block, uint32_t algo) {
+void Encoder::Impl::init_block_param(AlgorithmParam& block_param, uint8_t* p_input_block, uint32_t algo) const {
     block_param.p_data = p_input_block;
     block_param.block_size = BLOCK_SIZE;
     block_param.decoder = encoder_to_decoder_mapping_.at(algo);
@@ -427,7 +418,7 @@ void Encoder::Impl::init_block_param(AlgorithmParam& block_param, uint8_t* p_inp
 }
 
 CompressionHeader Encoder::Impl::create_compression_header(const BitCompactorConfig& config, CompressionType type,
-                                                           AlgorithmParam& block_param, uint32_t dual_encode) {
+                                                           AlgorithmParam& block_param, uint32_t dual_encode) const {
     CompressionHeader header{};
     header.compression_type = static_cast<uint32_t>(type);
     header.algo = static_cast<uint32_t>(block_param.decoder);
@@ -443,7 +434,7 @@ CompressionHeader Encoder::Impl::create_compression_header(const BitCompactorCon
 }
 
 void Encoder::Impl::add_overhead_and_padding(const BitCompactorConfig& config, AlgorithmParam& block_param,
-                                             uint32_t algo) {
+                                             uint32_t algo) const {
     block_param.encoding_bits += algorithm_overhead_bits_[algo];
     block_param.dual_encoding_bits += algorithm_overhead_bits_[algo];
     block_param.dual_encoding_bits += 74u;
@@ -454,15 +445,15 @@ void Encoder::Impl::add_overhead_and_padding(const BitCompactorConfig& config, A
     }
 }
 
-bool Encoder::Impl::is_algo_dual_encode_compatible(const BitCompactorConfig& config, uint32_t algo) {
+bool Encoder::Impl::is_algo_dual_encode_compatible(const BitCompactorConfig& config, uint32_t algo) const {
     return config.arch_type != ArchType::NPU27 || algo != static_cast<uint32_t>(EncoderAlgorithm::MINSPRDCT);
 }
 
-bool Encoder::Impl::is_algo_valid(uint32_t algo, int blk) {
+bool Encoder::Impl::is_algo_valid(uint32_t algo, int blk) const {
     return !(algo == static_cast<uint32_t>(EncoderAlgorithm::PREVBLKPRDCT) && blk == 0);
 }
 BestAlgorithm Encoder::Impl::get_best_algorithm(const BitCompactorConfig& config, int blk,
-                                                std::vector<AlgorithmParam>& block_params) {
+                                                BlockParams& block_params) const {
     uint32_t min_encoder_bits{~0u};
     uint32_t min_algo{};
 
@@ -470,16 +461,14 @@ BestAlgorithm Encoder::Impl::get_best_algorithm(const BitCompactorConfig& config
     uint32_t dual_min_algo{};
 
     const auto input_offset{blk * BLOCK_SIZE};
-    auto p_input_block{bit_stream_in_.get_byte_pointer(input_offset)};
-    const auto algorithm_offset{blk * ALGORITHMS};
+    auto p_input_block{const_cast<uint8_t*>(bit_stream_in_.get_byte_pointer(input_offset))};
 
     for (uint32_t algo{}; algo < ALGORITHMS; ++algo) {
         if (!is_algo_valid(algo, blk)) {
             continue;
         }
 
-        const auto offset{algorithm_offset + algo};
-        auto& block_param{block_params[offset]};
+        auto& block_param{block_params[algo]};
         init_block_param(block_param, p_input_block, algo);
 
         (this->*algorithm_encoder_[algo])(block_param);
@@ -506,31 +495,26 @@ BestAlgorithm Encoder::Impl::get_best_algorithm(const BitCompactorConfig& config
     return BestAlgorithm{min_encoder_bits, min_algo, dual_min_encoder_bits, dual_min_algo};
 }
 
-uint64_t Encoder::Impl::get_dual_encode_len(const BitCompactorConfig& config, AlgorithmParam& block_param) {
+uint64_t Encoder::Impl::get_dual_encode_len(const BitCompactorConfig& config, AlgorithmParam& block_param) const {
     uint64_t encode_len{};
 
     if (config.arch_type == ArchType::NPU27) {
         encode_len = block_param.dual_encoding_bits - algorithm_overhead_bits_[block_param.encoder_index] - 74u;
     } else {
         // Recalculating encode_len because of byte alignment
-        for (unsigned i = 0; i < BLOCK_SIZE; ++i) {
-            encode_len = encode_len + (((block_param.dual_bitmap >> i) & 1) ? 8 : block_param.bit_length);
-        }
+        const auto symbols_8bits{std::bitset<BLOCK_SIZE>(block_param.dual_bitmap).count()};
+        encode_len = symbols_8bits * 8 + (BLOCK_SIZE - symbols_8bits) * block_param.bit_length;
     }
 
     return encode_len;
 }
 
-int Encoder::Impl::write_dual_encode_header(const BitCompactorConfig& config, int blk, BitStream& blk_stream,
-                                            std::vector<AlgorithmParam>& block_params, BestAlgorithm& best_algorithm) {
-    const auto algorithm_offset{blk * ALGORITHMS};
-
-    int block_index = algorithm_offset + best_algorithm.dual_min_algo;
+uint32_t Encoder::Impl::write_dual_encode_header(const BitCompactorConfig& config, BitStream& blk_stream,
+                                                 BlockParams& block_params, BestAlgorithm& best_algorithm) const {
+    const auto block_index{best_algorithm.dual_min_algo};
     auto& min_block_params{block_params[block_index]};
     min_block_params.bit_length = min_block_params.dual_bit_length;
 
-    blk_stream.allocate_bits(min_block_params.dual_encoding_bits);
-
     CompressionHeader header{create_compression_header(config, CompressionType::cmprsd, min_block_params, 1)};
 
     blk_stream.write(*reinterpret_cast<uint64_t*>(&header), 20u);
@@ -542,13 +526,11 @@ int Encoder::Impl::write_dual_encode_header(const BitCompactorConfig& config, in
     return block_index;
 }
 
-int Encoder::Impl::write_compressed_header(const BitCompactorConfig& config, int blk, BitStream& blk_stream,
-                                           std::vector<AlgorithmParam>& block_params, BestAlgorithm& best_algorithm) {
-    const auto algorithm_offset{blk * ALGORITHMS};
-    int block_index = algorithm_offset + best_algorithm.min_algo;
+uint32_t Encoder::Impl::write_compressed_header(const BitCompactorConfig& config, BitStream& blk_stream,
+                                                BlockParams& block_params, BestAlgorithm& best_algorithm) const {
+    const auto block_index{best_algorithm.min_algo};
     auto& min_block_params{block_params[block_index]};
     min_block_params.dual_bitmap = 0ull;
-    blk_stream.allocate_bits(min_block_params.encoding_bits);
 
     CompressionHeader header{create_compression_header(config, CompressionType::cmprsd, min_block_params)};
 
@@ -562,14 +544,9 @@ int Encoder::Impl::write_compressed_header(const BitCompactorConfig& config, int
     return block_index;
 }
 
-void Encoder::Impl::write_uncompressed_blk(const BitCompactorConfig& config, int blk,
-                                           std::vector<BitStream>& block_stream,
-                                           std::vector<AlgorithmParam>& block_params) {
-    auto& blk_stream{block_stream[blk]};
+void Encoder::Impl::write_uncompressed_blk(const BitCompactorConfig& config, int blk, BitStream& blk_stream) const {
     const auto input_offset{blk * BLOCK_SIZE};
     auto p_input_block{bit_stream_in_.get_byte_pointer(input_offset)};
-    const auto algorithm_offset{blk * ALGORITHMS};
-    blk_stream.allocate_bits(MAX_BLOCK_COMPRESSION_BITS);
 
     CompressionHeader header{};
     header.compression_type = static_cast<uint32_t>(CompressionType::uncmprsd);
@@ -590,16 +567,15 @@ void Encoder::Impl::write_uncompressed_blk(const BitCompactorConfig& config, int
 
     write_residual(config, blk_stream, params_uncomp);
 }
-void Encoder::Impl::write_compressed_blk(const BitCompactorConfig& config, int blk, const bool using_dual_encoder,
-                                         std::vector<BitStream>& block_stream,
-                                         std::vector<AlgorithmParam>& block_params, BestAlgorithm& best_algorithm) {
+void Encoder::Impl::write_compressed_blk(const BitCompactorConfig& config, const bool using_dual_encoder,
+                                         BitStream& blk_stream, BlockParams& block_params,
+                                         BestAlgorithm& best_algorithm) const {
     uint32_t block_index{};
-    auto& blk_stream{block_stream[blk]};
 
     if (using_dual_encoder) {
-        block_index = write_dual_encode_header(config, blk, blk_stream, block_params, best_algorithm);
+        block_index = write_dual_encode_header(config, blk_stream, block_params, best_algorithm);
     } else {
-        block_index = write_compressed_header(config, blk, blk_stream, block_params, best_algorithm);
+        block_index = write_compressed_header(config, blk_stream, block_params, best_algorithm);
     }
 
     auto& min_block_params{block_params[block_index]};
@@ -617,20 +593,28 @@ void Encoder::Impl::write_compressed_blk(const BitCompactorConfig& config, int b
     write_residual(config, blk_stream, min_block_params);
 }
 
-bool Encoder::Impl::is_compression_better_than_uncompressed(BestAlgorithm& best_algorithm) {
+void Encoder::Impl::write_blk(const BitCompactorConfig& config, int blk, BitStream& blk_stream) const {
+    BlockParams block_params{};
+    BestAlgorithm best_algorithm = get_best_algorithm(config, blk, block_params);
+
+    if (is_compression_better_than_uncompressed(best_algorithm)) {
+        write_compressed_blk(config, using_dual_encoder(best_algorithm), blk_stream, block_params, best_algorithm);
+    } else {
+        write_uncompressed_blk(config, blk, blk_stream);
+    }
+}
+
+bool Encoder::Impl::is_compression_better_than_uncompressed(BestAlgorithm& best_algorithm) const {
     return best_algorithm.min_encoder_bits < MAX_BLOCK_COMPRESSION_BITS ||
            best_algorithm.dual_min_encoder_bits < MAX_BLOCK_COMPRESSION_BITS;
 }
 
-bool Encoder::Impl::using_dual_encoder(BestAlgorithm& best_algorithm) {
+bool Encoder::Impl::using_dual_encoder(BestAlgorithm& best_algorithm) const {
     return dual_encoder_enable_ && best_algorithm.dual_min_encoder_bits < best_algorithm.min_encoder_bits;
 }
 
-void Encoder::Impl::write_last_blk(uint32_t input_blocks, std::vector<BitStream>& block_stream,
-                                   unsigned last_block_elements) {
-    auto& last_blk_stream{block_stream[input_blocks]};
-    last_blk_stream.allocate_bits((last_block_elements + 1u) << 3);
-
+void Encoder::Impl::write_last_blk(uint32_t input_blocks, BitStream& last_blk_stream,
+                                   unsigned last_block_elements) const {
     LastBlockHeader header{};
     header.compression_type = static_cast<uint32_t>(CompressionType::lastblk);
     header.block_length = last_block_elements;
@@ -757,31 +741,44 @@ void Encoder::Impl::encode(const BitCompactorConfig& config, const std::vector<u
     const auto last_block_elements{input_bytes - (input_blocks << 6)};
     uint32_t last_block{static_cast<uint32_t>(last_block_elements > 0u)};
 
-    std::vector<AlgorithmParam> block_params(input_blocks * ALGORITHMS);
-    std::vector<BitStream> block_stream(input_blocks + last_block);
-
     if (config.mode_fp16_enable) {
         fp16_preprocess(bit_stream_in_.source_stream_length());
     }
 
-    for (int blk = 0; blk < static_cast<int>(input_blocks); ++blk) {
-        BestAlgorithm best_algorithm = get_best_algorithm(config, blk, block_params);
+    // Blocks are independent: each chunk of blocks is encoded into its own stream and the streams are concatenated.
+    // A block never takes more than MAX_BLOCK_COMPRESSION_BITS, since it's stored uncompressed otherwise
+    const auto input_chunks{(input_blocks + BLOCKS_PER_CHUNK - 1u) / BLOCKS_PER_CHUNK};
+    std::vector<BitStream> block_stream(input_chunks + last_block);
 
-        if (is_compression_better_than_uncompressed(best_algorithm)) {
-            write_compressed_blk(config, blk, using_dual_encoder(best_algorithm), block_stream, block_params,
-                                 best_algorithm);
-        } else {
-            write_uncompressed_blk(config, blk, block_stream, block_params);
+    const auto encode_chunk = [&](size_t chunk) {
+        const auto first_blk{static_cast<uint32_t>(chunk) * BLOCKS_PER_CHUNK};
+        const auto last_blk{std::min(first_blk + BLOCKS_PER_CHUNK, input_blocks)};
+
+        auto& chunk_stream{block_stream[chunk]};
+        chunk_stream.allocate_bits((last_blk - first_blk) * MAX_BLOCK_COMPRESSION_BITS);
+        for (auto blk{first_blk}; blk < last_blk; ++blk) {
+            write_blk(config, static_cast<int>(blk), chunk_stream);
+        }
+    };
+
+    if (parallel_for_ && input_chunks > 1) {
+        parallel_for_(input_chunks, encode_chunk);
+    } else {
+        for (size_t chunk = 0; chunk < input_chunks; ++chunk) {
+            encode_chunk(chunk);
         }
     }
 
     if (last_block) {
-        write_last_blk(input_blocks, block_stream, last_block_elements);
+        auto& last_blk_stream{block_stream[input_chunks]};
+        last_blk_stream.allocate_bits((last_block_elements + 1u) << 3);
+        write_last_blk(input_blocks, last_blk_stream, last_block_elements);
     }
     write_to_output(out, block_stream);
 }
 
-void Encoder::Impl::write_residual(const BitCompactorConfig& config, BitStream& stream, const AlgorithmParam& param) {
+void Encoder::Impl::write_residual(const BitCompactorConfig& config, BitStream& stream,
+                                   const AlgorithmParam& param) const {
     uint64_t bits{};
     uint32_t bit_count{};
     uint64_t total_bit_count{};
@@ -0,0 +1,370 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/compilation_cache.hpp"
+
+#include "vpux/compiler/compiler_version.hpp"
+
+#include "intel_npu/al/config/common.hpp"
+#include "intel_npu/al/config/compiler.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/env.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SHA256.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <openvino/pass/manager.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/intel_npu/properties.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <streambuf>
+
+using namespace vpux;
+
+namespace {
+
+constexpr StringLiteral ENTRY_EXTENSION = ".blob";
+constexpr StringLiteral TEMPORARY_MARKER = ".blob.tmp-";
+constexpr char ENTRY_MAGIC[8] = {'N', 'P', 'U', 'C', 'A', 'C', 'H', '1'};
+
+constexpr uint64_t DEFAULT_MAX_SIZE_MB = 4096;
+constexpr uint64_t DEFAULT_MAX_AGE_HOURS = 168;
+
+struct EntryHeader final {
+    char magic[sizeof(ENTRY_MAGIC)];
+    uint64_t blobSize;
+};
+
+std::atomic<size_t> hitsCount{0};
+std::atomic<size_t> missesCount{0};
+std::atomic<size_t> storesCount{0};
+std::atomic<size_t> evictionsCount{0};
+
+//
+// HashingStreamBuf
+//
+
+// Feeds everything written into the stream directly into the digest, so the serialized model
+// is never materialized in memory
+class HashingStreamBuf final : public std::streambuf {
+public:
+    explicit HashingStreamBuf(llvm::SHA256& hasher): _hasher(hasher) {
+    }
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize count) override {
+        _hasher.update(llvm::ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(count)));
+        return count;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            const auto byte = static_cast<uint8_t>(ch);
+            _hasher.update(llvm::ArrayRef<uint8_t>(&byte, 1));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    llvm::SHA256& _hasher;
+};
+
+//
+// Key fields
+//
+
+// Each field is prefixed with its length, so different splits of the same bytes give different keys
+void hashField(llvm::SHA256& hasher, StringRef field) {
+    const auto size = static_cast<uint64_t>(field.size());
+    hasher.update(llvm::ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(&size), sizeof(size)));
+    hasher.update(field);
+}
+
+template <class Opt>
+void hashOption(llvm::SHA256& hasher, const intel_npu::Config& config) {
+    hashField(hasher, Opt::key());
+    if (!config.has<Opt>()) {
+        hashField(hasher, "");
+        return;
+    }
+
+    std::ostringstream value;
+    value << config.get<Opt>();
+    hashField(hasher, value.str());
+}
+
+// Only the options which affect the compiled blob are hashed, the runtime-only ones (log level, number of
+// compilation threads, inference settings) would only cause needless misses
+void hashCompileOptions(llvm::SHA256& hasher, const intel_npu::Config& config) {
+    hashOption<intel_npu::PLATFORM>(hasher, config);
+    hashOption<intel_npu::STEPPING>(hasher, config);
+    hashOption<intel_npu::MAX_TILES>(hasher, config);
+    hashOption<intel_npu::TILES>(hasher, config);
+    hashOption<intel_npu::DPU_GROUPS>(hasher, config);
+    hashOption<intel_npu::DMA_ENGINES>(hasher, config);
+    hashOption<intel_npu::COMPILATION_MODE>(hasher, config);
+    hashOption<intel_npu::COMPILATION_MODE_PARAMS>(hasher, config);
+    hashOption<intel_npu::BACKEND_COMPILATION_PARAMS>(hasher, config);
+    hashOption<intel_npu::USE_ELF_COMPILER_BACKEND>(hasher, config);
+    hashOption<intel_npu::DYNAMIC_SHAPE_TO_STATIC>(hasher, config);
+    hashOption<intel_npu::PERFORMANCE_HINT>(hasher, config);
+    hashOption<intel_npu::BATCH_MODE>(hasher, config);
+    hashOption<intel_npu::PERF_COUNT>(hasher, config);
+}
+
+uint64_t parseEnvNumber(const char* name, uint64_t defaultValue, Logger log) {
+    const auto value = env::getEnvVar(name);
+    if (!value.has_value()) {
+        return defaultValue;
+    }
+
+    uint64_t result = 0;
+    if (StringRef(value.value()).getAsInteger(10, result)) {
+        log.warning("Invalid value '{0}' of {1}, using the default {2}", value.value(), name, defaultValue);
+        return defaultValue;
+    }
+    return result;
+}
+
+void touchEntry(StringRef path) {
+    int fd = -1;
+    if (llvm::sys::fs::openFileForWrite(path, fd, llvm::sys::fs::CD_OpenExisting, llvm::sys::fs::OF_Append)) {
+        return;
+    }
+    const auto now = std::chrono::system_clock::now();
+    std::ignore = llvm::sys::fs::setLastAccessAndModificationTime(fd, now, now);
+    std::ignore = llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+}
+
+}  // namespace
+
+//
+// CompilationCache
+//
+
+std::optional<CompilationCache> vpux::CompilationCache::fromEnv(Logger log) {
+    const auto directory = env::getEnvVar("IE_NPU_COMPILATION_CACHE_DIR");
+    if (!directory.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto maxSizeMB = parseEnvNumber("IE_NPU_COMPILATION_CACHE_MAX_SIZE_MB", DEFAULT_MAX_SIZE_MB, log);
+    const auto maxAgeHours = parseEnvNumber("IE_NPU_COMPILATION_CACHE_MAX_AGE_HOURS", DEFAULT_MAX_AGE_HOURS, log);
+
+    if (const auto errc = llvm::sys::fs::create_directories(directory.value())) {
+        log.warning("Failed to create compilation cache directory '{0}' : {1}", directory.value(), errc.message());
+        return std::nullopt;
+    }
+
+    const auto maxSize = MB(checked_cast<int64_t>(maxSizeMB)).to<Byte>();
+    return CompilationCache(directory.value(), checked_cast<uint64_t>(maxSize.count()),
+                            std::chrono::hours(maxAgeHours), log);
+}
+
+vpux::CompilationCache::CompilationCache(StringRef directory, uint64_t maxSize, std::chrono::seconds maxAge,
+                                         Logger log)
+        : _directory(directory), _maxSize(maxSize), _maxAge(maxAge), _log(log.nest("compilation-cache")) {
+}
+
+std::string vpux::CompilationCache::computeKey(const std::shared_ptr<ov::Model>& model,
+                                               const intel_npu::Config& config, VPU::ArchKind arch) {
+    llvm::SHA256 hasher;
+
+    hashField(hasher, VPUX_COMPILER_VERSION);
+    hashField(hasher, stringifyEnum(arch));
+    hashCompileOptions(hasher, config);
+
+    HashingStreamBuf xmlBuf(hasher);
+    HashingStreamBuf binBuf(hasher);
+    std::ostream xmlStream(&xmlBuf);
+    std::ostream binStream(&binBuf);
+
+    // Serialize pass only reads the model, the topology and the weights go straight into the digest
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::Serialize>(xmlStream, binStream);
+    manager.run_passes(model);
+
+    const auto digest = hasher.final();
+    return llvm::toHex(digest, /*LowerCase=*/true);
+}
+
+llvm::SmallString<128> vpux::CompilationCache::getEntryPath(StringRef key) const {
+    llvm::SmallString<128> path(_directory);
+    llvm::sys::path::append(path, key + ENTRY_EXTENSION);
+    return path;
+}
+
+std::optional<std::vector<uint8_t>> vpux::CompilationCache::lookup(StringRef key) const {
+    const auto path = getEntryPath(key);
+
+    auto buffer = llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    if (!buffer) {
+        ++missesCount;
+        _log.info("Miss for key {0} ({1} hits / {2} misses)", key, hitsCount.load(), missesCount.load());
+        return std::nullopt;
+    }
+
+    const auto data = buffer.get()->getBuffer();
+    EntryHeader header;
+    if (data.size() < sizeof(header)) {
+        ++missesCount;
+        _log.warning("Entry '{0}' is truncated, ignoring it", path);
+        return std::nullopt;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) != 0 ||
+        header.blobSize != data.size() - sizeof(header)) {
+        ++missesCount;
+        _log.warning("Entry '{0}' is corrupted, ignoring it", path);
+        return std::nullopt;
+    }
+
+    const auto blobBegin = reinterpret_cast<const uint8_t*>(data.data()) + sizeof(header);
+    std::vector<uint8_t> blob(blobBegin, blobBegin + header.blobSize);
+
+    // The modification time is used as the recency of the entry for eviction
+    touchEntry(path);
+
+    ++hitsCount;
+    _log.info("Hit for key {0} ({1} hits / {2} misses)", key, hitsCount.load(), missesCount.load());
+    return blob;
+}
+
+void vpux::CompilationCache::store(StringRef key, const std::vector<uint8_t>& blob) const {
+    const auto path = getEntryPath(key);
+
+    // Write into a unique temporary file first and publish it with an atomic rename,
+    // so concurrent readers either see the complete entry or none at all
+    llvm::SmallString<128> tmpModel(_directory);
+    llvm::sys::path::append(tmpModel, key + TEMPORARY_MARKER + "%%%%%%%%");
+
+    int fd = -1;
+    llvm::SmallString<128> tmpPath;
+    if (const auto errc = llvm::sys::fs::createUniqueFile(tmpModel, fd, tmpPath)) {
+        _log.warning("Failed to create temporary file for key {0} : {1}", key, errc.message());
+        return;
+    }
+
+    {
+        llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+
+        EntryHeader header;
+        std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+        header.blobSize = blob.size();
+
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+        os.close();
+
+        if (os.has_error()) {
+            _log.warning("Failed to write entry for key {0} : {1}", key, os.error().message());
+            os.clear_error();
+            std::ignore = llvm::sys::fs::remove(tmpPath);
+            return;
+        }
+    }
+
+    if (const auto errc = llvm::sys::fs::rename(tmpPath, path)) {
+        _log.warning("Failed to publish entry for key {0} : {1}", key, errc.message());
+        std::ignore = llvm::sys::fs::remove(tmpPath);
+        return;
+    }
+
+    ++storesCount;
+    _log.debug("Stored {0} bytes for key {1}", blob.size(), key);
+
+    evict();
+}
+
+void vpux::CompilationCache::evict() const {
+    struct Entry final {
+        std::string path;
+        uint64_t size;
+        llvm::sys::TimePoint<> lastUse;
+    };
+
+    const auto now = std::chrono::system_clock::now();
+
+    SmallVector<Entry> entries;
+    uint64_t totalSize = 0;
+
+    std::error_code errc;
+    for (llvm::sys::fs::directory_iterator it(_directory, errc), end; it != end && !errc; it.increment(errc)) {
+        const auto& path = it->path();
+        const auto status = it->status();
+        if (!status) {
+            continue;
+        }
+
+        // The directory may be shared with other applications, only the files created by the cache are touched
+        const auto fileName = llvm::sys::path::filename(path);
+        const auto isEntry = llvm::sys::path::extension(fileName) == ENTRY_EXTENSION;
+        const auto isTemporary = fileName.contains(TEMPORARY_MARKER);
+        if (!isEntry && !isTemporary) {
+            continue;
+        }
+
+        // Expired temporary files are leftovers of processes that died in the middle of a store
+        const auto lastUse = status->getLastModificationTime();
+        if (now - lastUse > _maxAge) {
+            if (!llvm::sys::fs::remove(path)) {
+                ++evictionsCount;
+                _log.debug("Evicted expired entry '{0}'", path);
+            }
+            continue;
+        }
+
+        if (!isEntry) {
+            continue;
+        }
+
+        entries.push_back(Entry{path, status->getSize(), lastUse});
+        totalSize += status->getSize();
+    }
+
+    if (totalSize <= _maxSize) {
+        return;
+    }
+
+    llvm::sort(entries, [](const Entry& lhs, const Entry& rhs) {
+        return lhs.lastUse < rhs.lastUse;
+    });
+
+    for (const auto& entry : entries) {
+        if (totalSize <= _maxSize) {
+            break;
+        }
+
+        // Another process might have evicted the same entry already, which is fine
+        if (!llvm::sys::fs::remove(entry.path)) {
+            ++evictionsCount;
+            _log.debug("Evicted least recently used entry '{0}' ({1} bytes)", entry.path, entry.size);
+        }
+        totalSize -= entry.size;
+    }
+}
+
+CompilationCache::Statistics vpux::CompilationCache::getStatistics() {
+    Statistics stats;
+    stats.hits = hitsCount.load();
+    stats.misses = missesCount.load();
+    stats.stores = storesCount.load();
+    stats.evictions = evictionsCount.load();
+    return stats;
+}
@@ -14,6 +14,7 @@
 #include "vpux/compiler/NPU40XX/dialect/ELF/export.hpp"
 #include "vpux/compiler/NPU40XX/pipeline_strategy.hpp"
 #include "vpux/compiler/NPU40XX/pipelines.hpp"
+#include "vpux/compiler/compilation_cache.hpp"
 #include "vpux/compiler/dialect/ELFNPU37XX/export.hpp"
 #include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
 #include "vpux/compiler/dialect/VPUIP/graph-schema/export.hpp"
@@ -123,6 +124,12 @@ public:
         return _crashReproducerFile.empty() && _irPrintingFilter.empty();
     }
 
+    // The debug outputs are produced by the compilation itself, a blob taken from the compilation cache has none
+    bool hasDebugOutputs() const {
+        return !_crashReproducerFile.empty() || !_irPrintingFilter.empty() ||
+               !_printAsTextualPipelineFilePath.empty() || !_printDotOptions.empty();
+    }
+
 private:
     Logger _log;
 
@@ -623,6 +630,7 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
 
     mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
     addLogging(pm, log);
+    addParallelismReport(pm, log);
     devConf.setup(pm);
 
     auto pipelineFactory = createPipelineStrategy(arch);
@@ -692,6 +700,24 @@ NetworkDescription CompilerImpl::compile(const std::shared_ptr<ov::Model>& model
 
     DeveloperConfig devConf(log);
 
+    std::optional<CompilationCache> compilationCache;
+    if (devConf.hasDebugOutputs()) {
+        log.info("Compilation cache is bypassed, the developer options request debug outputs");
+    } else {
+        compilationCache = CompilationCache::fromEnv(log);
+    }
+
+    std::string cacheKey;
+    if (compilationCache.has_value()) {
+        OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompilationCache::lookup");
+
+        cacheKey = CompilationCache::computeKey(model, config, getArchKind(config));
+        if (auto cachedBlob = compilationCache->lookup(cacheKey)) {
+            auto meta = parse(cachedBlob.value(), config);
+            return NetworkDescription(std::move(cachedBlob.value()), std::move(meta));
+        }
+    }
+
     mlir::DefaultTimingManager tm;
     devConf.setup(tm);
 
@@ -777,6 +803,11 @@ NetworkDescription CompilerImpl::compile(const std::shared_ptr<ov::Model>& model
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "exportNetwork");
     auto networkDescription = exportNetwork(module.get(), rootTiming, log, model, config);
+
+    if (compilationCache.has_value()) {
+        OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "storeToCompilationCache");
+        compilationCache->store(cacheKey, networkDescription.compiledNetwork);
+    }
     OV_ITT_TASK_SKIP(COMPILER_IMPLEMENTATION);
 
     auto peakMemEnd = getPeakMemoryUsage();
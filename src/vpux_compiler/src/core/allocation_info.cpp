@@ -9,6 +9,7 @@
 #include "vpux/compiler/core/feasible_memory_scheduler_control_edges.hpp"
 
 #include "vpux/compiler/utils/analysis.hpp"
+#include "vpux/compiler/utils/offline_placement.hpp"
 
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
@@ -19,9 +20,47 @@ using namespace vpux;
 
 using LinearScanImpl = LinearScan<mlir::Value, LinearScanHandler>;
 
+namespace {
+
+// Places the buffers with the live ranges found by the linear scan once again, this time knowing all of them.
+// The handler is updated only if the new placement reduces the peak memory usage
+void applyOfflinePlacement(LinearScanHandler& handler, ArrayRef<mlir::Value> values,
+                           ArrayRef<OfflinePlacement::Buffer> buffers, AddressType totalSize,
+                           ArrayRef<std::pair<AddressType, AddressType>> reserved, Logger log) {
+    SmallVector<AddressType> scanAddresses;
+    for (auto val : values) {
+        scanAddresses.push_back(handler.getAddress(val));
+    }
+    const auto scanStatistics = OfflinePlacement::getStatistics(buffers, scanAddresses);
+
+    const auto addresses = OfflinePlacement(totalSize, reserved).place(buffers);
+    if (!addresses.has_value()) {
+        log.trace("Offline placement failed, keep the linear scan result");
+        return;
+    }
+    const auto statistics = OfflinePlacement::getStatistics(buffers, addresses.value());
+
+    log.info("Offline placement of {0} buffers: peak usage {1} -> {2}, fragmentation {3} -> {4}", buffers.size(),
+             scanStatistics.peakUsage, statistics.peakUsage, scanStatistics.fragmentation, statistics.fragmentation);
+    if (statistics.peakUsage >= scanStatistics.peakUsage) {
+        return;
+    }
+
+    SmallVector<std::pair<mlir::Value, AddressType>> newAddresses;
+    for (auto ind : irange(values.size())) {
+        if (!buffers[ind].fixedAddress.has_value()) {
+            newAddresses.emplace_back(values[ind], addresses.value()[ind]);
+        }
+    }
+    handler.relocate(newAddresses);
+}
+
+}  // namespace
+
 std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinearScan(
         mlir::func::FuncOp funcOp, MemLiveRangeInfo& liveRangeInfo, const AsyncDepsInfo& depsInfo,
-        VPU::MemoryKind memKind, Logger log, ArrayRef<std::pair<vpux::AddressType, vpux::AddressType>> vec) {
+        VPU::MemoryKind memKind, Logger log, ArrayRef<std::pair<vpux::AddressType, vpux::AddressType>> vec,
+        bool enableOfflinePlacement) {
     auto module = funcOp->getParentOfType<mlir::ModuleOp>();
     auto memKindAttr = mlir::SymbolRefAttr::get(funcOp.getContext(), stringifyEnum(memKind));
     auto availableMem = IE::getAvailableMemory(module, memKindAttr);
@@ -32,6 +71,12 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
 
     LinearScanImpl scan(maxMemSize.count(), vec, memDefaultAlignment);
 
+    // Live ranges of the allocated buffers for the offline placement, in terms of the processed tasks
+    size_t step = 0;
+    SmallVector<mlir::Value> placementValues;
+    SmallVector<OfflinePlacement::Buffer> placementBuffers;
+    DenseMap<mlir::Value, size_t> placementIndices;
+
     const auto getBuffersToAllocate = [&](const ValueOrderedSet& usedBufs) {
         log.trace("Locate new buffers");
         log = log.nest();
@@ -62,6 +107,22 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
         log.trace("Allocate memory for the new buffers");
         VPUX_THROW_UNLESS(scan.alloc(buffers, /*allowSpills*/ false), "Failed to statically allocate '{0}' memory",
                           memKind);
+
+        if (!enableOfflinePlacement) {
+            return;
+        }
+        for (auto val : buffers) {
+            OfflinePlacement::Buffer buf;
+            buf.size = scan.handler().getSize(val);
+            buf.alignment = scan.handler().getAlignment(val);
+            buf.begin = step;
+            if (LinearScanHandler::isFixedAlloc(val)) {
+                buf.fixedAddress = scan.handler().getAddress(val);
+            }
+            placementIndices[val] = placementBuffers.size();
+            placementValues.push_back(val);
+            placementBuffers.push_back(buf);
+        }
     };
 
     const auto freeDeadBuffers = [&](const ValueOrderedSet& usedBufs) {
@@ -71,6 +132,12 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
         for (auto val : usedBufs) {
             log.trace("Mark as dead buffer '{0}'", val);
             scan.handler().markAsDead(val);
+
+            // The buffer is released at its first free, the later ones don't extend the live range
+            const auto it = placementIndices.find(val);
+            if (it != placementIndices.end() && placementBuffers[it->second].end == 0) {
+                placementBuffers[it->second].end = step;
+            }
         }
 
         log.trace("Free memory for the dead buffers");
@@ -101,6 +168,10 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
 
     std::list<ScheduledOpOneResource> scheduledOpsResources;
 
+    // Buffers of the tasks for the control edges. They are collected after the allocation,
+    // since the offline placement may change the addresses
+    SmallVector<std::tuple<size_t, ValueOrderedSet, ValueOrderedSet>> scheduledOpsBuffers;
+
     // Store buffers with their end cycle
     std::map<size_t, ValueOrderedSet> freeBuffersCycleEnd;
 
@@ -148,12 +219,7 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
         allocNewBuffers(toAlloc);
 
         auto opIndex = depsInfo.getIndex(curExecOp);
-
-        // Check all operands of operation and prepare entries in scheduledOpsResources that will be used
-        // by control edge algorithm to generate new dependencies
-        // TODO: Replace below call with updateScheduledOpsResourcesForControlEdge which checks also subviews (E#106837)
-        updateScheduledOpsResourcesForControlEdgeBasic(scheduledOpsResources, scan, opIndex, inputBuffers,
-                                                       outputBuffers, log);
+        scheduledOpsBuffers.emplace_back(opIndex, std::move(inputBuffers), std::move(outputBuffers));
 
         // Store free buffers with cycle end
         auto consumedBuffers = getFreeBuffers(usedBufs, curExecOp);
@@ -163,6 +229,7 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
         }
         freeBuffersCycleEnd[cycleEnd] = std::move(consumedBuffers);
 
+        ++step;
         log = log.unnest();
     }
 
@@ -175,6 +242,24 @@ std::tuple<LinearScanHandler, std::list<ScheduledOpOneResource>> vpux::runLinear
         }
     }
 
+    if (enableOfflinePlacement && !placementBuffers.empty()) {
+        // Buffers which are never freed stay alive till the end of the schedule
+        for (auto& buf : placementBuffers) {
+            if (buf.end == 0) {
+                buf.end = step;
+            }
+        }
+        applyOfflinePlacement(scan.handler(), placementValues, placementBuffers, maxMemSize.count(), vec, log);
+    }
+
+    // Check all operands of operation and prepare entries in scheduledOpsResources that will be used
+    // by control edge algorithm to generate new dependencies
+    for (const auto& [opIndex, inputBuffers, outputBuffers] : scheduledOpsBuffers) {
+        // TODO: Replace below call with updateScheduledOpsResourcesForControlEdge which checks also subviews (E#106837)
+        updateScheduledOpsResourcesForControlEdgeBasic(scheduledOpsResources, scan, opIndex, inputBuffers,
+                                                       outputBuffers, log);
+    }
+
     return {scan.handler(), scheduledOpsResources};
 }
 
@@ -276,17 +276,17 @@ const llvm::SmallVector<size_t> vpux::AsyncDepsInfo::getConsumerOps(size_t opIdx
     return getDepsVec(_consumerMap[opIdx]);
 }
 
-std::unordered_map<size_t, size_t> vpux::AsyncDepsInfo::calculateOpInDegreeTable() const {
-    std::unordered_map<size_t, size_t> opInDegree;
+SmallVector<size_t> vpux::AsyncDepsInfo::calculateOpInDegreeTable() const {
+    SmallVector<size_t> opInDegree(_execOpCount);
     for (size_t i = 0; i < _execOpCount; ++i) {
         opInDegree[i] = static_cast<size_t>(_depsMap[i].size());
     }
     return opInDegree;
 }
 
-std::unordered_map<size_t, size_t> vpux::AsyncDepsInfo::calculateOpOutDegreeTable() const {
+SmallVector<size_t> vpux::AsyncDepsInfo::calculateOpOutDegreeTable() const {
     VPUX_THROW_WHEN(_consumerMap.empty(), "Consumer map was not build");
-    std::unordered_map<size_t, size_t> opOutDegree;
+    SmallVector<size_t> opOutDegree(_execOpCount);
     for (size_t i = 0; i < _execOpCount; ++i) {
         opOutDegree[i] = static_cast<size_t>(_consumerMap[i].size());
     }
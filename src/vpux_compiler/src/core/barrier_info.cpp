@@ -9,6 +9,8 @@
 #include "vpux/compiler/dialect/VPURT/utils/barrier_legalization_utils.hpp"
 #include "vpux/compiler/utils/attributes.hpp"
 #include "vpux/compiler/utils/dma.hpp"
+#include "vpux/compiler/utils/loop.hpp"
+#include "vpux/utils/core/dense_map.hpp"
 #include "vpux/utils/core/range.hpp"
 
 #include <llvm/ADT/SetOperations.h>
@@ -301,7 +303,8 @@ bool vpux::BarrierInfo::producersControlsAllConsumers(const TaskSet& origProduce
                                                       ArrayRef<TaskSet> origWaitBarriersMap) {
     // Get new consumers not in original consumers
 
-    auto consumersWithoutDirectControl = llvm::set_difference(newConsumers, origConsumers);
+    auto consumersWithoutDirectControl = newConsumers;
+    consumersWithoutDirectControl.subtract(origConsumers);
     if (consumersWithoutDirectControl.empty()) {
         return true;
     }
@@ -318,8 +321,7 @@ bool vpux::BarrierInfo::producersControlsAllConsumers(const TaskSet& origProduce
         return false;
     }
 
-    if (*std::max_element(origProducers.begin(), origProducers.end()) >=
-        *std::min_element(consumersWithoutDirectControl.begin(), consumersWithoutDirectControl.end())) {
+    if (origProducers.back() >= consumersWithoutDirectControl.front()) {
         return false;
     }
 
@@ -1344,36 +1346,79 @@ void vpux::BarrierInfo::optimizeBarriers(bool checkValidSlotCount) {
     // For update barriers and wait barriers we need to include sync points on both ends of the block
     // because tasks from within a given range can have updateBarriers whose consumer
     // is the upper bound sync point, and they can have waitBarriers whose producer is the lower bound sync point.
-    for (size_t taskBlockIndex = 0; taskBlockIndex < getControlGraphBlockCount(); ++taskBlockIndex) {
+    const auto numOfBlocks = getControlGraphBlockCount();
+    for (size_t taskBlockIndex = 0; taskBlockIndex < numOfBlocks; ++taskBlockIndex) {
         auto [blockStartInd, blockEndInd] = getControlGraphBlockTaskRange(taskBlockIndex);
         _log.trace("Block {0}, task range [{1}, {2}] ({3} tasks)", taskBlockIndex, blockStartInd, blockEndInd,
                    blockEndInd - blockStartInd + 1);
+    }
+
+    // Each step analyzes all the blocks in parallel and then updates the barriers block by block.
+    // A block only reads the barriers of its tasks and the sync points don't change the result of the
+    // neighbor block, so this gives the same result as optimizing the blocks one after another.
+    SmallVector<BlockTaskBarriers> blockBarriers(numOfBlocks);
 
-        // optimize producers
-        _log.trace("Optimize producers / update barriers");
-        optimizeBarrierProducers(taskBlockIndex);
+    // optimize producers
+    _log.trace("Optimize producers / update barriers");
+    forEachControlGraphBlock([&](size_t blockIdx) {
+        blockBarriers[blockIdx] = getOptimizedUpdateBarriers(blockIdx);
+    });
+    for (const auto& barriers : blockBarriers) {
+        setBlockUpdateBarriers(barriers);
+    }
 
-        // optimize barriers which have the same producers but different consumers
-        _log.trace("Optimize barriers / same producers, different consumers");
-        optimizeBarriersWithSameProducers(taskBlockIndex, checkValidSlotCount);
+    // optimize barriers which have the same producers but different consumers
+    _log.trace("Optimize barriers / same producers, different consumers");
+    SmallVector<BarrierMerges> blockMerges(numOfBlocks);
+    forEachControlGraphBlock([&](size_t blockIdx) {
+        blockMerges[blockIdx] = getBarriersWithSameProducers(blockIdx, checkValidSlotCount);
+    });
+    for (const auto& merges : blockMerges) {
+        mergeBarriers(merges);
+    }
 
-        // optimize consumers
-        _log.trace("Optimize consumers / wait barriers");
-        optimizeBarrierConsumers(taskBlockIndex);
+    // optimize consumers
+    _log.trace("Optimize consumers / wait barriers");
+    forEachControlGraphBlock([&](size_t blockIdx) {
+        blockBarriers[blockIdx] = getOptimizedWaitBarriers(blockIdx);
+    });
+    for (const auto& barriers : blockBarriers) {
+        setBlockWaitBarriers(barriers);
     }
 
     _log.trace("Total tasks count: {0}, total barrier count: {1}", _allTaskOps.size(), _allBarrierOps.size());
     _log = _log.unnest();
 }
 
+void vpux::BarrierInfo::forEachControlGraphBlock(FuncRef<void(size_t)> func) {
+    const auto numOfBlocks = getControlGraphBlockCount();
+    // test scenarios do not initialize FuncOp
+    if (_func == nullptr || numOfBlocks == 1) {
+        for (size_t blockIdx = 0; blockIdx < numOfBlocks; ++blockIdx) {
+            func(blockIdx);
+        }
+        return;
+    }
+
+    loop_1d(LoopExecPolicy::Parallel, _func.getContext(), checked_cast<int64_t>(numOfBlocks), [&](int64_t blockIdx) {
+        func(checked_cast<size_t>(blockIdx));
+    });
+}
+
 void vpux::BarrierInfo::optimizeBarrierProducers(size_t blockIdx) {
+    setBlockUpdateBarriers(getOptimizedUpdateBarriers(blockIdx));
+}
+
+vpux::BarrierInfo::BlockTaskBarriers vpux::BarrierInfo::getOptimizedUpdateBarriers(size_t blockIdx) {
     // TODO: E#79318 optimize loops
     auto [blockStartInd, blockEndInd] =
             getControlGraphBlockTaskRange(blockIdx, /* blockStartSyncPoint */ true, /* blockEndSyncPoint */ true);
     const auto barriersRangeVec = getBarriersForTaskBlock(blockIdx, /* blockStartSyncPoint */ true,
                                                           /* blockEndSyncPoint */ true, /* updateBarriers */ true);
+    BlockTaskBarriers blockBarriers;
+    blockBarriers.firstTaskInd = blockStartInd;
     if (barriersRangeVec.empty()) {
-        return;
+        return blockBarriers;
     }
     size_t barrierOffset = barriersRangeVec[0];
 
@@ -1409,6 +1454,7 @@ void vpux::BarrierInfo::optimizeBarrierProducers(size_t blockIdx) {
     }
 
     _log.nest().trace("Remove redundant dependencies");
+    blockBarriers.barriers.resize(blockSize);
     for (size_t taskInd = static_cast<unsigned>(blockStartInd); taskInd <= static_cast<unsigned>(blockEndInd);
          ++taskInd) {
         for (auto updateBarrierInd : _taskUpdateBarriers[taskInd]) {
@@ -1419,22 +1465,40 @@ void vpux::BarrierInfo::optimizeBarrierProducers(size_t blockIdx) {
                 }
             }
         }
-        TaskSet targetUpdateBarriers;
+        auto& targetUpdateBarriers = blockBarriers.barriers[taskInd - blockStartInd];
         for (auto bar : updateBarriers[taskInd - blockStartInd].set_bits()) {
             targetUpdateBarriers.insert(bar + barrierOffset);
         }
-        setUpdateBarriers(taskInd, targetUpdateBarriers);
+    }
+
+    return blockBarriers;
+}
+
+void vpux::BarrierInfo::setBlockUpdateBarriers(const BlockTaskBarriers& blockBarriers) {
+    for (const auto& p : blockBarriers.barriers | indexed) {
+        const auto taskInd = blockBarriers.firstTaskInd + p.index();
+        // update barriers of the upper bound sync point are optimized with the next block
+        if (taskInd != blockBarriers.firstTaskInd && isSyncPoint(taskInd)) {
+            continue;
+        }
+        setUpdateBarriers(taskInd, p.value());
     }
 }
 
 void vpux::BarrierInfo::optimizeBarrierConsumers(size_t blockIdx) {
+    setBlockWaitBarriers(getOptimizedWaitBarriers(blockIdx));
+}
+
+vpux::BarrierInfo::BlockTaskBarriers vpux::BarrierInfo::getOptimizedWaitBarriers(size_t blockIdx) {
     // TODO: E#79318 optimize loops
     auto [blockStartInd, blockEndInd] =
             getControlGraphBlockTaskRange(blockIdx, /* blockStartSyncPoint */ true, /* blockEndSyncPoint */ true);
     const auto barriersRangeVec = getBarriersForTaskBlock(blockIdx, /* blockStartSyncPoint  */ true,
                                                           /* blockEndSyncPoint */ true, /* updateBarriers */ false);
+    BlockTaskBarriers blockBarriers;
+    blockBarriers.firstTaskInd = blockStartInd;
     if (barriersRangeVec.empty()) {
-        return;
+        return blockBarriers;
     }
     size_t barrierOffset = barriersRangeVec[0];
 
@@ -1470,6 +1534,7 @@ void vpux::BarrierInfo::optimizeBarrierConsumers(size_t blockIdx) {
         }
     }
 
+    blockBarriers.barriers.resize(blockSize);
     for (auto taskInd = blockEndInd + 1; taskInd-- > blockStartInd;) {
         for (auto waitBarrierInd : _taskWaitBarriers[taskInd]) {
             for (auto parentTaskInd : _barrierProducerMap[waitBarrierInd]) {
@@ -1480,15 +1545,32 @@ void vpux::BarrierInfo::optimizeBarrierConsumers(size_t blockIdx) {
             }
         }
 
-        TaskSet targetWaitBarriers;
+        auto& targetWaitBarriers = blockBarriers.barriers[taskInd - blockStartInd];
         for (auto bar : waitBarriers[taskInd - blockStartInd].set_bits()) {
             targetWaitBarriers.insert(bar + barrierOffset);
         }
-        setWaitBarriers(taskInd, targetWaitBarriers);
+    }
+
+    return blockBarriers;
+}
+
+void vpux::BarrierInfo::setBlockWaitBarriers(const BlockTaskBarriers& blockBarriers) {
+    for (const auto& p : blockBarriers.barriers | indexed) {
+        const auto taskInd = blockBarriers.firstTaskInd + p.index();
+        // wait barriers of the lower bound sync point are optimized with the previous block
+        if (taskInd == blockBarriers.firstTaskInd && isSyncPoint(taskInd)) {
+            continue;
+        }
+        setWaitBarriers(taskInd, p.value());
     }
 }
 
 void vpux::BarrierInfo::optimizeBarriersWithSameProducers(size_t blockIdx, bool checkValidSlotCount) {
+    mergeBarriers(getBarriersWithSameProducers(blockIdx, checkValidSlotCount));
+}
+
+vpux::BarrierInfo::BarrierMerges vpux::BarrierInfo::getBarriersWithSameProducers(size_t blockIdx,
+                                                                                bool checkValidSlotCount) {
     // Collect a vector of barrier indexes for current task range.
     // If a new barrier is created between subsequent calls to optimizeBarrier (eg. during looped linearization),
     // iterating over barriersRangeVec will not imply iterating over largely overlapping barrier index ranges
@@ -1497,7 +1579,7 @@ void vpux::BarrierInfo::optimizeBarriersWithSameProducers(size_t blockIdx, bool
             getBarriersForTaskBlock(blockIdx, /* blockStartSyncPoint */ true, /* blockEndSyncPoint */ false);
 
     if (barriersRangeVec.empty()) {
-        return;
+        return {};
     }
     _log.nest().trace("Barrier range [{0}, {1}]", barriersRangeVec.front(), barriersRangeVec.back());
     VPUX_THROW_WHEN(barriersRangeVec.front() > _allBarrierOps.size() - 1,
@@ -1511,52 +1593,72 @@ void vpux::BarrierInfo::optimizeBarriersWithSameProducers(size_t blockIdx, bool
         return sum + getNumOfSlotsUsedByTask(getTaskOpAtIndex(taskInd));
     };
 
+    // copy barrier map onto vector for quicker comparisons between different producer sets
+    SmallVector<SmallVector<size_t>> blockBarrierProducerMap(barriersRangeVec.size());
+    for (size_t ind1 = 0; ind1 < barriersRangeVec.size(); ++ind1) {
+        size_t barInd = barriersRangeVec[ind1];
+        std::copy(_barrierProducerMap[barInd].begin(), _barrierProducerMap[barInd].end(),
+                  std::back_inserter(blockBarrierProducerMap[ind1]));
+    }
+
+    // The merges are applied to the barrier maps later, consumers of the merged barriers are tracked here
+    DenseMap<size_t, TaskSet> mergedBarrierConsumers;
+    const auto getConsumers = [&](size_t barInd) -> const TaskSet& {
+        const auto it = mergedBarrierConsumers.find(barInd);
+        return it != mergedBarrierConsumers.end() ? it->second : _barrierConsumerMap[barInd];
+    };
+
     // Check the slot count is valid or not if the two barriers are merged
-    auto legalMergeSlotCount = [&](const size_t& bar1, const size_t& bar2) {
+    auto legalMergeSlotCount = [&](size_t ind1, size_t ind2) {
         // Currently used by ReduceBArrierDependencies, this is possible to be done here because
         // SplitExceedingVariantCountBarrier will legalize this in barrierLegalizationPipeline
         if (!checkValidSlotCount) {
             return true;
         }
-        size_t slotCount = std::accumulate(_barrierProducerMap[bar1].begin(), _barrierProducerMap[bar1].end(),
+        size_t slotCount = std::accumulate(blockBarrierProducerMap[ind1].begin(), blockBarrierProducerMap[ind1].end(),
                                            static_cast<size_t>(0), addFunc);
-        BarrierInfo::TaskSet consumers = _barrierConsumerMap[bar1];
+        BarrierInfo::TaskSet consumers = getConsumers(barriersRangeVec[ind1]);
         // Use set operation to remove duplicated consumers
-        llvm::set_union(consumers, _barrierConsumerMap[bar2]);
+        consumers.merge(getConsumers(barriersRangeVec[ind2]));
         slotCount = std::accumulate(consumers.begin(), consumers.end(), slotCount, addFunc);
         return slotCount <= maxVariantCount;
     };
 
-    // copy barrier map onto vector for quicker comparisons between different producer sets
-    SmallVector<SmallVector<size_t>> blockBarrierProducerMap(barriersRangeVec.size());
-    for (size_t ind1 = 0; ind1 < barriersRangeVec.size(); ++ind1) {
-        size_t barInd = barriersRangeVec[ind1];
-        std::copy(_barrierProducerMap[barInd].begin(), _barrierProducerMap[barInd].end(),
-                  std::back_inserter(blockBarrierProducerMap[ind1]));
-    }
-    _log = _log.nest();
-
+    BarrierMerges merges;
     for (size_t ind1 = 0; ind1 < barriersRangeVec.size(); ++ind1) {
         size_t barInd = barriersRangeVec[ind1];
         for (size_t ind2 = ind1 + 1; ind2 < barriersRangeVec.size(); ++ind2) {
             size_t childBarInd = barriersRangeVec[ind2];
             if (blockBarrierProducerMap[ind1] == blockBarrierProducerMap[ind2]) {
-                _log.trace("Same producers for barId '{0}' '{1}'", barInd, childBarInd);
-                if (legalMergeSlotCount(barInd, childBarInd)) {
-                    for (auto consumerInd : _barrierConsumerMap[childBarInd]) {
-                        // move all consumers to one barrier
-                        addConsumer(barInd, static_cast<size_t>(consumerInd));
-                    }
-                    if (_func != nullptr) {  // test scenarios do not initialize FuncOp
-                        _log.trace("New consumers number - {0}", getConsumerSlotCount(getBarrierOpAtIndex(barInd)));
-                    }
-                    resetBarrier(childBarInd);
+                _log.nest().trace("Same producers for barId '{0}' '{1}'", barInd, childBarInd);
+                if (legalMergeSlotCount(ind1, ind2)) {
+                    // move all consumers to one barrier
+                    BarrierInfo::TaskSet consumers = getConsumers(barInd);
+                    consumers.merge(getConsumers(childBarInd));
+                    mergedBarrierConsumers[childBarInd] = {};
+                    mergedBarrierConsumers[barInd] = std::move(consumers);
+
+                    merges.emplace_back(barInd, childBarInd);
                     blockBarrierProducerMap[ind2].clear();
                 }
             }
         }
     }
-    _log = _log.unnest();
+
+    return merges;
+}
+
+void vpux::BarrierInfo::mergeBarriers(const BarrierMerges& merges) {
+    for (const auto& [barInd, childBarInd] : merges) {
+        for (auto consumerInd : _barrierConsumerMap[childBarInd]) {
+            // move all consumers to one barrier
+            addConsumer(barInd, static_cast<size_t>(consumerInd));
+        }
+        if (_func != nullptr) {  // test scenarios do not initialize FuncOp
+            _log.nest().trace("New consumers number - {0}", getConsumerSlotCount(getBarrierOpAtIndex(barInd)));
+        }
+        resetBarrier(childBarInd);
+    }
 }
 
 bool vpux::BarrierInfo::canMergeBarriersForTasks(const BarrierInfo::TaskSet& producers, size_t availableSlots) {
@@ -1588,7 +1690,7 @@ bool vpux::BarrierInfo::mergeParallelWaitBarriers(size_t taskInd, size_t availab
         for (auto& waitBarrierInd : waitBarriers) {
             // merge all producers
             const auto& barrierProducers = getBarrierProducers(waitBarrierInd);
-            llvm::set_union(newBarrierProducers, barrierProducers);
+            newBarrierProducers.merge(barrierProducers);
         }
 
         return newBarrierProducers;
@@ -1596,7 +1698,7 @@ bool vpux::BarrierInfo::mergeParallelWaitBarriers(size_t taskInd, size_t availab
 
     BarrierInfo::TaskSet parallelConsumers;
     for (auto& waitBarrier : waitBarriers) {
-        llvm::set_union(parallelConsumers, getBarrierConsumers(waitBarrier));
+        parallelConsumers.merge(getBarrierConsumers(waitBarrier));
     }
 
     auto getBarriersConsumerTasks = [&](const BarrierInfo::TaskSet& waitBarriers, size_t availableSlotsForConsumer) {
@@ -1686,7 +1788,39 @@ bool vpux::BarrierInfo::mergeParallelWaitBarriers(size_t taskInd, size_t availab
     return true;
 }
 
-SmallVector<BarrierInfo::TaskSet> BarrierInfo::createProducerBatches(const BarrierInfo::TaskSet& waitBarriers,
+/*
+    Get the barriers of the set in the order of the IR operands. TaskSet iterates in the index order, so the barriers
+    which are operands already keep their position and the new ones are appended in the index order.
+    The tasks whose barriers are not changed keep their operand order in the IR
+*/
+SmallVector<size_t> BarrierInfo::getBarriersInIROrder(const BarrierInfo::TaskSet& barriers,
+                                                      mlir::ValueRange irBarriers) const {
+    SmallVector<size_t> orderedBarriers;
+    orderedBarriers.reserve(barriers.size());
+
+    BarrierInfo::TaskSet irBarrierInds;
+    for (auto barrier : irBarriers) {
+        auto barrierOp = barrier.getDefiningOp<VPURT::DeclareVirtualBarrierOp>();
+        if (barrierOp == nullptr || !barrierOp->hasAttr(_barrierIndexAttrName)) {
+            continue;
+        }
+
+        const auto barrierInd = static_cast<size_t>(getIndex(barrierOp));
+        if (barriers.contains(barrierInd) && irBarrierInds.insert(barrierInd).second) {
+            orderedBarriers.push_back(barrierInd);
+        }
+    }
+
+    for (auto barrierInd : barriers) {
+        if (!irBarrierInds.contains(barrierInd)) {
+            orderedBarriers.push_back(barrierInd);
+        }
+    }
+
+    return orderedBarriers;
+}
+
+SmallVector<BarrierInfo::TaskSet> BarrierInfo::createProducerBatches(ArrayRef<size_t> waitBarriers,
                                                                      size_t availableSlots) {
     // try to create batches of producers using existing barriers if producers satisfy order constraint
     SmallVector<BarrierInfo::TaskSet> legalBatches;
@@ -1710,7 +1844,7 @@ SmallVector<BarrierInfo::TaskSet> BarrierInfo::createProducerBatches(const Barri
 
         prevLastUserInd = VPURT::getMaxEntry(barrierProducers);
         auto currentBatchPlusBarrierProducers = legalBatches.back();
-        llvm::set_union(currentBatchPlusBarrierProducers, barrierProducers);
+        currentBatchPlusBarrierProducers.merge(barrierProducers);
 
         if (canMergeBarriersForTasks(currentBatchPlusBarrierProducers, availableSlots)) {
             // can add to the same batch
@@ -1745,7 +1879,9 @@ void vpux::BarrierInfo::linearizeLegalParallelProducers(size_t taskInd, const Ba
                                                         const BarrierInfo::TaskSet& parallelConsumers,
                                                         size_t availableSlots) {
     // create legal batches of barrier producers
-    auto legalBatches = createProducerBatches(getWaitBarriers(taskInd), availableSlots);
+    auto legalBatches = createProducerBatches(
+            getBarriersInIROrder(getWaitBarriers(taskInd), getTaskOpAtIndex(taskInd).getWaitBarriers()),
+            availableSlots);
     if (legalBatches.empty()) {
         // create new batches of producers that satisfy order constraint
         legalBatches = createLegalVariantBatches(parallelProducers, availableSlots);
@@ -1982,6 +2118,48 @@ bool vpux::BarrierInfo::controlPathExistsBetweenTasksInSameBlock(const SmallVect
     return taskControlMap[taskAInd][taskBInd];
 }
 
+//
+// updateTaskControlMap
+//
+
+// Update of the task control map built with buildTaskControlMap() after a new dependency from producers to consumers.
+// Every task which controls any of the producers (as well as the producers) now controls the consumers and all tasks
+// controlled by them, so there is no need to build the map again after each change in barriers.
+// Tasks from outside of the block covered by the map are ignored.
+void vpux::BarrierInfo::updateTaskControlMap(SmallVector<llvm::BitVector>& taskControlMap, size_t controlMapOffset,
+                                             const TaskSet& producers, const TaskSet& consumers) const {
+    VPUX_THROW_WHEN(taskControlMap.empty(), "Task control map not initialized");
+
+    const auto mapSize = taskControlMap.size();
+    const auto inMap = [&](size_t taskInd) {
+        return taskInd >= controlMapOffset && taskInd - controlMapOffset < mapSize;
+    };
+
+    llvm::BitVector newControlledTasks(checked_cast<uint32_t>(mapSize));
+    for (auto consumerInd : consumers) {
+        if (inMap(consumerInd)) {
+            newControlledTasks.set(consumerInd - controlMapOffset);
+            newControlledTasks |= taskControlMap[consumerInd - controlMapOffset];
+        }
+    }
+
+    llvm::BitVector producersMask(checked_cast<uint32_t>(mapSize));
+    for (auto producerInd : producers) {
+        if (inMap(producerInd)) {
+            producersMask.set(producerInd - controlMapOffset);
+        }
+    }
+    if (newControlledTasks.none() || producersMask.none()) {
+        return;
+    }
+
+    for (size_t taskInd = 0; taskInd < mapSize; ++taskInd) {
+        if (producersMask.test(taskInd) || taskControlMap[taskInd].anyCommon(producersMask)) {
+            taskControlMap[taskInd] |= newControlledTasks;
+        }
+    }
+}
+
 //
 // updateIR
 //
@@ -1991,14 +2169,16 @@ void vpux::BarrierInfo::updateIR() {
     for (size_t taskInd = 0; taskInd < _allTaskOps.size(); ++taskInd) {
         auto taskOp = getTaskOpAtIndex(taskInd);
 
+        const auto waitBarriers = getBarriersInIROrder(_taskWaitBarriers[taskInd], taskOp.getWaitBarriers());
         taskOp.getWaitBarriersMutable().clear();
-        for (auto barrierInd : _taskWaitBarriers[taskInd]) {
+        for (auto barrierInd : waitBarriers) {
             auto barrierOp = getBarrierOpAtIndex(static_cast<size_t>(barrierInd));
             taskOp.getWaitBarriersMutable().append(barrierOp.getBarrier());
         }
 
+        const auto updateBarriers = getBarriersInIROrder(_taskUpdateBarriers[taskInd], taskOp.getUpdateBarriers());
         taskOp.getUpdateBarriersMutable().clear();
-        for (auto barrierInd : _taskUpdateBarriers[taskInd]) {
+        for (auto barrierInd : updateBarriers) {
             auto barrierOp = getBarrierOpAtIndex(static_cast<size_t>(barrierInd));
             taskOp.getUpdateBarriersMutable().append(barrierOp.getBarrier());
         }
@@ -754,7 +754,8 @@ size_t vpux::getDPUTaskOpCost(VPUIP::DPUTaskOp dpuTaskOp, const std::shared_ptr<
 
     // TODO: Should RUNTIME_OVERHEAD_PER_WORKLOAD be added?
     std::string vpunnInputCheckInfo;
-    auto cost = VPU::checkAndReturnCost(costModel->DPU(vpunnDPUWorkload, vpunnInputCheckInfo), log, true);
+    auto cost = VPU::checkAndReturnCost(VPU::getDPUWorkloadCost(*costModel, vpunnDPUWorkload, vpunnInputCheckInfo),
+                                        log, true);
     const auto logCb = [&](const formatv_object_base& msg) {
         log.trace("{0}", msg.str());
     };
@@ -139,7 +139,9 @@ void FeasibleMemoryScheduler::moveFromCycleBeginToCycleEndHeap() {
         // add op to ScheduledOpVec
         populateScheduledOps(nextOp);
         // move to cycle end heap
-        _cycleEndHeap.insert(nextOp);
+        if (_cycleEndHeap.insert(nextOp).second) {
+            ++_cycleEndHeapQueueSize[nextOp.queueType_];
+        }
         // decrease outputs if output operation scheduled
         if (_outputOps.find(nextOp.op_) != _outputOps.end()) {
             _outputOps.erase(nextOp.op_);
@@ -314,7 +316,7 @@ FeasibleMemoryScheduler::QueueAndCycleType FeasibleMemoryScheduler::getCurrentCy
 
     // check if operation cycle begin delayed by dependencies
     for (const auto& dep : _depsInfo.getOpDeps(opIdx)) {
-        earliestBeginCycle = std::max(earliestBeginCycle, _opIdxEndCycleMap[dep]);
+        earliestBeginCycle = std::max(earliestBeginCycle, getOpIdxCycleEnd(dep));
     }
     return QueueAndCycleType{queueType, std::move(executorInstanceMask), earliestBeginCycle};
 }
@@ -455,14 +457,9 @@ bool FeasibleMemoryScheduler::freeMemoryResources(const HeapElement& hElement) {
 }
 
 bool FeasibleMemoryScheduler::unscheduledOpsOnQueue(const QueueType& queueType) {
-    for (auto& op : _cycleEndHeap) {
-        if (op.queueType_ != queueType) {
-            continue;
-        }
-        // queue type exists in cycle end heap
-        return false;
-    }
-    return true;
+    // queue type exists in cycle end heap
+    const auto queueSize = _cycleEndHeapQueueSize.find(queueType);
+    return queueSize == _cycleEndHeapQueueSize.end() || queueSize->second == 0;
 }
 
 void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType> readyOps) {
@@ -471,7 +468,7 @@ void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType
     _log = _log.nest();
     for (auto& readyOpIdx : readyOps) {
         if (_isDataOp[readyOpIdx]) {
-            VPUX_THROW_UNLESS(_readyDataOps.find(readyOpIdx) == _readyDataOps.end(),
+            VPUX_THROW_UNLESS(!_readyDataOps.contains(readyOpIdx),
                               "Operation already in the ready data list '{0}'", readyOpIdx);
             _log.nest().trace("Add to ready data ops '{0}'", readyOpIdx);
             _readyDataOps.insert(readyOpIdx);
@@ -480,12 +477,12 @@ void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType
         } else {
             const auto queueType = getQueueType(readyOpIdx);
             if (VPUIP::VPUIPDialect::isComputeExecutorKind(queueType.execKind)) {
-                VPUX_THROW_UNLESS(_readyComputeOps.find(readyOpIdx) == _readyComputeOps.end(),
+                VPUX_THROW_UNLESS(!_readyComputeOps.contains(readyOpIdx),
                                   "Operation already in ready compute list '{0}'", readyOpIdx);
                 _log.nest().trace("Add to ready compute ops '{0}'", readyOpIdx);
                 _readyComputeOps.insert(readyOpIdx);
             } else {
-                VPUX_THROW_UNLESS(_readyDMAOps.find(readyOpIdx) == _readyDMAOps.end(),
+                VPUX_THROW_UNLESS(!_readyDMAOps.contains(readyOpIdx),
                                   "Operation already in ready compute DMA list '{0}'", readyOpIdx);
                 _log.nest().trace("Add to ready DMA ops '{0}'", readyOpIdx);
                 _readyDMAOps.insert(readyOpIdx);
@@ -531,6 +528,7 @@ void FeasibleMemoryScheduler::unscheduleAllCompletingOps() {
         readyOps.insert(readyOps.end(), newReadyOps.begin(), newReadyOps.end());
 
         // remove op from heap
+        --_cycleEndHeapQueueSize[nextOp.queueType_];
         _cycleEndHeap.erase(nextOp);
     }
 
@@ -544,7 +542,7 @@ SmallVector<operationIdxType> FeasibleMemoryScheduler::reduceInDegreeOfAdjacentO
     for (const auto& consumer : _depsInfo.getConsumerOps(opIdx)) {
         if (_inDegreeTable[consumer] < 2) {
             zeroInDegreeOps.push_back(consumer);
-            _inDegreeTable.erase(consumer);
+            _inDegreeTable[consumer] = 0;
         } else {
             VPUX_THROW_UNLESS(_inDegreeTable[consumer] > 0, "Invalid in-degree");
             _inDegreeTable[consumer]--;
@@ -557,9 +555,9 @@ void FeasibleMemoryScheduler::initializeReadyLists() {
     // populate ready lists with operations without dependencies
     SmallVector<operationIdxType> operationsWithNoDependencies;
 
-    for (auto& entry : _inDegreeTable) {
-        if (entry.second == 0) {
-            operationsWithNoDependencies.push_back(entry.first);
+    for (auto opIdx : irange(_inDegreeTable.size())) {
+        if (_inDegreeTable[opIdx] == 0) {
+            operationsWithNoDependencies.push_back(opIdx);
         }
     }
 
@@ -657,13 +655,12 @@ mlir::DenseSet<mlir::Value> FeasibleMemoryScheduler::getBuffersToAllocateForOp(o
 
     mlir::DenseSet<mlir::Value> buffersToAllocate(usedBuffers.begin(), usedBuffers.end());
     for (const auto& dep : _depsInfo.getOpDeps(opIdx)) {
-        if (_opIdxEndCycleMap.find(dep) != _opIdxEndCycleMap.end()) {
+        if (hasOpIdxCycleEnd(dep)) {
             // op was scheduled
             continue;
         }
 
-        VPUX_THROW_UNLESS(_readyDataOps.find(dep) != _readyDataOps.end(),
-                          "Failed to get buffers - operation not ready '{0}'", dep);
+        VPUX_THROW_UNLESS(_readyDataOps.contains(dep), "Failed to get buffers - operation not ready '{0}'", dep);
         auto depBuffers = getBuffersToAllocateForOp(dep);
         buffersToAllocate.insert(depBuffers.begin(), depBuffers.end());
     }
@@ -687,12 +684,12 @@ size_t FeasibleMemoryScheduler::scheduleDependencies(operationIdxType opIdx) {
     // schedule required dependencies order based on earliest scheduling cycle and IR order
     std::map<size_t, std::set<operationIdxType>> sortedDemandList;
     for (const auto& depIdx : _depsInfo.getOpDeps(opIdx)) {
-        if (_opIdxEndCycleMap.find(depIdx) != _opIdxEndCycleMap.end()) {
+        if (hasOpIdxCycleEnd(depIdx)) {
             // op was scheduled
             continue;
         }
 
-        VPUX_THROW_UNLESS(_readyDataOps.find(depIdx) != _readyDataOps.end(),
+        VPUX_THROW_UNLESS(_readyDataOps.contains(depIdx),
                           "Failed to schedule dependencies - operation not ready '{0}'", depIdx);
         const auto cycleBegin = getCurrentCycleAndExecutorInstanceMask(depIdx).cycle;
         sortedDemandList[cycleBegin].insert(depIdx);
@@ -731,7 +728,7 @@ size_t FeasibleMemoryScheduler::getOperationLevel(operationIdxType opIdx, bool i
     // original consumer(s) could have been already scheduled
     auto minRemainingConsumerLevel = std::numeric_limits<size_t>::max();
     for (const auto& consumerIdx : _depsInfo.getConsumerOps(opIdx)) {
-        if (_opIdxEndCycleMap.find(consumerIdx) != _opIdxEndCycleMap.end()) {
+        if (hasOpIdxCycleEnd(consumerIdx)) {
             // consumer scheduled
             continue;
         }
@@ -783,7 +780,7 @@ void FeasibleMemoryScheduler::prefetchOps(ArrayRef<std::pair<operationIdxType, s
     // find data ops before last scheduled op, IR is reordered such that
     // prefetch data ops are before compute op, sort prefetch candidates based on level
     std::map<size_t, std::set<operationIdxType>> sortedCandidates;
-    for (auto& dataOp : _readyDataOps) {
+    for (auto dataOp : _readyDataOps) {
         if (dataOp > lastScheduledOp) {
             continue;
         }
@@ -810,7 +807,7 @@ void FeasibleMemoryScheduler::prefetchOps(ArrayRef<std::pair<operationIdxType, s
         for (const auto& opIdx : entry.second) {
             mlir::DenseSet<mlir::Value> operationBuffers;
             size_t scheduleCycle = 0;
-            if (_readyDataOps.find(opIdx) != _readyDataOps.end()) {
+            if (_readyDataOps.contains(opIdx)) {
                 operationBuffers = getBuffersToAllocateForOp(opIdx);
                 scheduleCycle = getCurrentCycleAndExecutorInstanceMask(opIdx).cycle;
             } else {
@@ -845,7 +842,7 @@ void FeasibleMemoryScheduler::prefetchOps(ArrayRef<std::pair<operationIdxType, s
             // need to allocate more buffers
             buffersToAllocate = std::move(operationBuffers);
 
-            if (_readyDataOps.find(opIdx) != _readyDataOps.end()) {
+            if (_readyDataOps.contains(opIdx)) {
                 // schedule prefetch op
                 _log.nest().trace("Scheduling prefetch op: '{0}'", opIdx);
                 scheduleOp(opIdx, EOpType::ORIGINAL_PREFETCHED_OP);
@@ -903,7 +900,7 @@ void FeasibleMemoryScheduler::scheduleComputeOps() {
             // no ops on queue left
             continue;
         }
-        if (_readyComputeOps.find(*firstOpInQueue) == _readyComputeOps.end()) {
+        if (!_readyComputeOps.contains(*firstOpInQueue)) {
             // operation not ready
             continue;
         }
@@ -945,7 +942,7 @@ void FeasibleMemoryScheduler::scheduleComputeOps() {
 
     // find DMA ops to schedule
     SmallVector<operationIdxType> DMAOpIdxToSchedule;
-    for (auto& readyOpIdx : _readyDMAOps) {
+    for (auto readyOpIdx : _readyDMAOps) {
         auto operationBuffers = getBuffersToAllocateForOp(readyOpIdx);
         operationBuffers.insert(buffersToAllocate.begin(), buffersToAllocate.end());
         if (!canAllocBuffers(operationBuffers)) {
@@ -989,7 +986,7 @@ void FeasibleMemoryScheduler::scheduleNonComputeOps() {
 
     // schedule operation not belonging to main network compute chain as soon as they become
     // ready so that they execute in the next available cycle since they are not prefetched
-    for (auto& readyOpIdx : llvm::make_early_inc_range(_nonComputeChainOps)) {
+    for (auto readyOpIdx : _nonComputeChainOps) {
         // Scheduling such operations can only happen once all input dependencies
         // (both data and compute ops) have already been executed. This is different
         // to standard compute op which as part of its scheduling can force scheduling
@@ -1024,10 +1021,23 @@ void FeasibleMemoryScheduler::scheduleNonComputeOps() {
 }
 
 void FeasibleMemoryScheduler::insertInOpIdxCycleEndMap(const operationIdxType& opIdx, const size_t& endCycle) {
-    auto mapItr = _opIdxEndCycleMap.find(opIdx);
-    if (mapItr == _opIdxEndCycleMap.end() || mapItr->second < endCycle) {
-        _opIdxEndCycleMap[opIdx] = endCycle;
+    auto& opCycleEnd = _opIdxEndCycle[opIdx];
+    if (!opCycleEnd.has_value() || opCycleEnd.value() < endCycle) {
+        opCycleEnd = endCycle;
+    }
+}
+
+bool FeasibleMemoryScheduler::hasOpIdxCycleEnd(operationIdxType opIdx) const {
+    return _opIdxEndCycle[opIdx].has_value();
+}
+
+size_t FeasibleMemoryScheduler::getOpIdxCycleEnd(operationIdxType opIdx) {
+    // matches the former map lookup by operator[], which inserted a zero cycle end for the operation
+    auto& opCycleEnd = _opIdxEndCycle[opIdx];
+    if (!opCycleEnd.has_value()) {
+        opCycleEnd = 0;
     }
+    return opCycleEnd.value();
 }
 
 size_t FeasibleMemoryScheduler::getEarliestComputeBeginCycle(operationIdxType opIdx) {
@@ -1039,14 +1049,14 @@ size_t FeasibleMemoryScheduler::getEarliestComputeBeginCycle(operationIdxType op
     for (auto& buffer : usedBufs) {
         if (_bufferProducer.find(buffer) != _bufferProducer.end()) {
             // use cycle end of latest writing op
-            earliestComputeBeginCycle = std::max(_opIdxEndCycleMap[_bufferProducer[buffer]], earliestComputeBeginCycle);
+            earliestComputeBeginCycle = std::max(getOpIdxCycleEnd(_bufferProducer[buffer]), earliestComputeBeginCycle);
         }
     }
     return earliestComputeBeginCycle;
 }
 
 void FeasibleMemoryScheduler::evictActiveOp(EvictionCandidate evictionCandidate) {
-    VPUX_THROW_UNLESS(_opIdxEndCycleMap.find(evictionCandidate.bufferWriterIdx_) != _opIdxEndCycleMap.end(),
+    VPUX_THROW_UNLESS(hasOpIdxCycleEnd(evictionCandidate.bufferWriterIdx_),
                       "Attempt to evict a non-scheduled operation");
 
     _readySpilledOps[evictionCandidate.buffer_] = evictionCandidate.bufferWriterIdx_;
@@ -1117,7 +1127,7 @@ FeasibleMemoryScheduler::EvictionCandidate FeasibleMemoryScheduler::chooseCandid
             if (!VPUIP::VPUIPDialect::isComputeExecutorKind(getExecutorType(consumerIdx))) {
                 continue;
             }
-            if (_opIdxEndCycleMap.find(consumerIdx) != _opIdxEndCycleMap.end()) {
+            if (hasOpIdxCycleEnd(consumerIdx)) {
                 continue;
             }
 
@@ -1176,7 +1186,7 @@ void FeasibleMemoryScheduler::forceScheduleActiveOpEviction() {
         size_t freeCmx = _scan.totalFreeSize();
         bool spillingDueToFragmentation = false;
 
-        for (auto& readyOp : _readyComputeOps) {
+        for (auto readyOp : _readyComputeOps) {
             auto opTotalSize = getOpCmxDemand(readyOp);
             if (opTotalSize <= freeCmx) {
                 if (!spillingDueToFragmentation) {
@@ -1185,7 +1195,7 @@ void FeasibleMemoryScheduler::forceScheduleActiveOpEviction() {
                 }
             }
         }
-        for (auto& readyOp : _readyDMAOps) {
+        for (auto readyOp : _readyDMAOps) {
             auto opTotalSize = getOpCmxDemand(readyOp);
             if (opTotalSize <= freeCmx) {
                 if (!spillingDueToFragmentation) {
@@ -1213,27 +1223,27 @@ void FeasibleMemoryScheduler::forceScheduleActiveOpEviction() {
             _log.nest().error("opIdx: {0}, on: {1}", *nextOp.second.begin(), nextOp.first.execKind);
         }
         _log.error("Ready operations:");
-        for (auto& readyOp : _readyComputeOps) {
+        for (auto readyOp : _readyComputeOps) {
             auto opTotalSize = getOpCmxDemand(readyOp);
             auto execOp = _depsInfo.getExecuteOpAtIndex(readyOp);
             _log.nest().error(
                     "readyComputeOp: opIdx: {0}, size demand: {1}, available free CMX: {2}, name: {3}, op: {4}, ",
                     readyOp, opTotalSize, freeCmx, execOp.getLoc(), execOp);
         }
-        for (auto& readyOp : _readyDMAOps) {
+        for (auto readyOp : _readyDMAOps) {
             auto opTotalSize = getOpCmxDemand(readyOp);
             auto execOp = _depsInfo.getExecuteOpAtIndex(readyOp);
             _log.nest().error("readyDMAOp: opIdx: {0}, size demand: {1}, available free CMX: {2}, name: {3}, op: {4}, ",
                               readyOp, opTotalSize, freeCmx, execOp.getLoc(), execOp);
         }
-        for (auto& readyOp : _readyDataOps) {
+        for (auto readyOp : _readyDataOps) {
             auto opTotalSize = getOpCmxDemand(readyOp);
             auto execOp = _depsInfo.getExecuteOpAtIndex(readyOp);
             _log.nest().error(
                     "readyDataOp: opIdx: {0}, size demand: {1}, available free CMX: {2}, name: {3}, op: {4}, ", readyOp,
                     opTotalSize, freeCmx, execOp.getLoc(), execOp);
         }
-        for (auto& readyOp : _nonComputeChainOps) {
+        for (auto readyOp : _nonComputeChainOps) {
             auto opTotalSize = getOpCmxDemand(readyOp);
             auto execOp = _depsInfo.getExecuteOpAtIndex(readyOp);
             _log.nest().error(
@@ -1282,11 +1292,11 @@ void FeasibleMemoryScheduler::createBufferAsyncIdxMap() {
         }
         return true;
     };
-    for (auto& asyncDepsPair : _outDegreeTable) {
-        auto executeOp = _depsInfo.getExecuteOpAtIndex(asyncDepsPair.first);
+    for (auto opIdx : irange(_outDegreeTable.size())) {
+        auto executeOp = _depsInfo.getExecuteOpAtIndex(opIdx);
 
         for (auto& buffer : _liveRangeInfo.getOutputBuffers(executeOp)) {
-            if (!populateMap(buffer, asyncDepsPair.first, _bufferOpIdxMap)) {
+            if (!populateMap(buffer, opIdx, _bufferOpIdxMap)) {
                 continue;
             }
         }
@@ -1365,9 +1375,10 @@ void FeasibleMemoryScheduler::populateScheduledOps(const HeapElement& scheduledO
 }
 
 void FeasibleMemoryScheduler::clearLists() {
-    _readyComputeOps.clear();
-    _readyDMAOps.clear();
-    _readyDataOps.clear();
+    const auto opCount = _inDegreeTable.size();
+    _readyComputeOps.reset(opCount);
+    _readyDMAOps.reset(opCount);
+    _readyDataOps.reset(opCount);
 }
 
 bool FeasibleMemoryScheduler::init() {
@@ -1379,13 +1390,14 @@ bool FeasibleMemoryScheduler::init() {
     _outDegreeTable = _depsInfo.calculateOpOutDegreeTable();
 
     // retrieve output ops (ops with no out-degree)
-    for (auto& entry : _outDegreeTable) {
-        if (entry.second == 0) {
-            _outputOps.insert(entry.first);
+    for (auto opIdx : irange(_outDegreeTable.size())) {
+        if (_outDegreeTable[opIdx] == 0) {
+            _outputOps.insert(opIdx);
         }
     }
 
     identifyDataOps();
+    _opIdxEndCycle.assign(_inDegreeTable.size(), std::nullopt);
 
     size_t level = 0;
     _opLevelVec.resize(_inDegreeTable.size(), 0);
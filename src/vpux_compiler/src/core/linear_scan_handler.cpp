@@ -109,6 +109,24 @@ void LinearScanHandler::setAddress(mlir::Value val, AddressType address) {
     }
 }
 
+void LinearScanHandler::relocate(ArrayRef<std::pair<mlir::Value, AddressType>> addresses) {
+    for (const auto& [val, addr] : addresses) {
+        VPUX_THROW_WHEN(isFixedAlloc(val), "Value '{0}' has fixed address", val);
+        VPUX_THROW_UNLESS(addr != InvalidAddress, "Trying to assign invalid address");
+
+        const auto it = _valOffsets.find(val);
+        VPUX_THROW_UNLESS(it != _valOffsets.end(), "Value '{0}' was not allocated", val);
+        it->second = addr;
+    }
+
+    _maxAllocatedSize = Byte(0);
+    for (const auto& valOffset : _valOffsets) {
+        const auto endAddr = alignValUp<int64_t>(valOffset.second + getSize(valOffset.first),
+                                                 getAlignment(valOffset.first));
+        _maxAllocatedSize = Byte(std::max(_maxAllocatedSize.count(), endAddr));
+    }
+}
+
 void LinearScanHandler::allocated(mlir::Value val, AddressType addr) {
     VPUX_THROW_UNLESS(addr != InvalidAddress, "Trying to assign invalid address");
     VPUX_THROW_UNLESS(_valOffsets.count(val) == 0, "Value '{0}' was already allocated", val);
@@ -4,39 +4,8 @@
 //
 
 #include "vpux/compiler/dialect/ELFNPU37XX/utils.hpp"
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
 
-std::pair<const uint8_t*, size_t> vpux::ELFNPU37XX::getDataAndSizeOfElfSection(
-        llvm::ArrayRef<uint8_t> elfBlob, const std::vector<std::string> possibleSecNames) {
-    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
-    auto elf_reader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
-
-    const uint8_t* secData = nullptr;
-    uint32_t secSize = 0;
-
-    bool secFound = false;
-
-    for (size_t i = 0; i < elf_reader.getSectionsNum(); ++i) {
-        auto section = elf_reader.getSection(i);
-        const auto secName = section.getName();
-        const auto sectionHeader = section.getHeader();
-
-        for (auto possibleSecName : possibleSecNames) {
-            if (strcmp(secName, possibleSecName.c_str()) == 0) {
-                secSize = sectionHeader->sh_size;
-                secData = section.getData<uint8_t>();
-                secFound = true;
-                break;
-            }
-        }
-    }
-    VPUX_THROW_UNLESS(secFound, "Section {0} not found in ELF", possibleSecNames);
-
-    return {secData, secSize};
-}
-
 size_t vpux::ELFNPU37XX::getOffsetOfOpInSection(mlir::Value op, mlir::Value section, ELFNPU37XX::OffsetCache& cache) {
     // specific case of uninitialized buffer where the offset to it is actually specified as an op attribute and there
     // is no need for any computation
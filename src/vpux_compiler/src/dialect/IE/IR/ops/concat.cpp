@@ -418,10 +418,13 @@ mlir::LogicalResult FuseConstConcat::matchAndRewrite(IE::ConcatOp origOp, mlir::
         const auto bufSize = checked_cast<size_t>(content.getType().getTotalAllocSize().count());
         std::vector<char> inBuf(bufSize);
         content.copyTo(MutableArrayRef(inBuf.data(), bufSize));
-        loop_1d(LoopExecPolicy::Parallel, getContext(), preDims, [&](uint64_t n) {
-            std::copy_n(inBuf.data() + (n * singleCopyBytes), singleCopyBytes,
-                        outBuf.data() + ((n * planeSizeInBytes) + planeOffset));
-        });
+        loop_1d(
+                LoopExecPolicy::Parallel, getContext(), preDims,
+                [&](uint64_t n) {
+                    std::copy_n(inBuf.data() + (n * singleCopyBytes), singleCopyBytes,
+                                outBuf.data() + ((n * planeSizeInBytes) + planeOffset));
+                },
+                /*costHint=*/singleCopyBytes);
     });
 
     const auto contentElemType = outNdInterface.getElementType();
@@ -71,10 +71,10 @@ public:
     }
 
 private:
-    void safeRunOnModule() final;
+    void safeRunOnFunc() final;
 };
 
-void AdjustNCEOpsWithI32InputsPass::safeRunOnModule() {
+void AdjustNCEOpsWithI32InputsPass::safeRunOnFunc() {
     auto& ctx = getContext();
 
     const auto isLegalOp = [](mlir::Operation* op) {
@@ -101,8 +101,8 @@ void AdjustNCEOpsWithI32InputsPass::safeRunOnModule() {
     patterns.add<ConvertPrecisionToFP16<IE::ConvolutionOp>>(&ctx, _log);
     patterns.add<ConvertPrecisionToFP16<IE::GroupConvolutionOp>>(&ctx, _log);
 
-    auto module = getOperation();
-    if (mlir::failed(mlir::applyPartialConversion(module, target, std::move(patterns)))) {
+    auto func = getOperation();
+    if (mlir::failed(mlir::applyPartialConversion(func, target, std::move(patterns)))) {
         signalPassFailure();
     }
 }
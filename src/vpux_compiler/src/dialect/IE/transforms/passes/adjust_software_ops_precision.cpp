@@ -73,10 +73,10 @@ public:
     }
 
 private:
-    void safeRunOnModule() final;
+    void safeRunOnFunc() final;
 };
 
-void AdjustSoftwareOpsPrecisionPass::safeRunOnModule() {
+void AdjustSoftwareOpsPrecisionPass::safeRunOnFunc() {
     auto& ctx = getContext();
 
     const auto isLegalTopKOp = [](IE::TopKOp op) {
@@ -94,8 +94,8 @@ void AdjustSoftwareOpsPrecisionPass::safeRunOnModule() {
     mlir::RewritePatternSet patterns(&ctx);
     patterns.add<PrecisionConverter>(&ctx, _log);
 
-    auto module = getOperation();
-    if (mlir::failed(mlir::applyPartialConversion(module, target, std::move(patterns)))) {
+    auto func = getOperation();
+    if (mlir::failed(mlir::applyPartialConversion(func, target, std::move(patterns)))) {
         signalPassFailure();
     }
 }
@@ -6,6 +6,7 @@
 #include "vpux/compiler/dialect/IE/utils/fake_quantize_utils.hpp"
 
 #include "vpux/compiler/utils/loop.hpp"
+#include "vpux/compiler/utils/types.hpp"
 #include "vpux/utils/core/numeric.hpp"
 
 namespace vpux {
@@ -251,6 +252,15 @@ mlir::LogicalResult WeightsDequantizeStructureInfo::initializeStructure(Const::D
     inputElemBaseType = initialInputElemStorageType = inputElemConvertType =
             inputAttr.getBaseContent().getShapedType().getElementType();
 
+    // Shared U4 and I4 constants refer to the packed OV buffer with the 4-bit base type, it is unpacked into the same
+    // 8-bit storage the copied constants have
+    if (inputElemBaseType.isInteger(4)) {
+        inputVirtualI4ElemType = inputElemBaseType;
+        inputElemBaseType = initialInputElemStorageType = inputElemConvertType =
+                inputElemBaseType.isSignedInteger() ? getSInt8Type(declareOp.getContext())
+                                                    : getUInt8Type(declareOp.getContext());
+    }
+
     // since U4 and I4 aren't aren't fully supported, they are represented through ConvertElemType transforms
     for (const auto& attr : inputAttr.getTransformations()) {
         if (auto convert = attr.dyn_cast_or_null<Const::ConvertElemTypeAttr>()) {
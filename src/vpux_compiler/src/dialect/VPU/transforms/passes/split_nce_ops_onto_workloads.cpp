@@ -96,29 +96,29 @@ void generateWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp,
     auto splitPool = to_std_vector(splitPoolSet);
     VPUX_THROW_WHEN(splitPool.empty(), "Workload split pool is empty");
 
-    std::vector<int64_t> splitPoolCosts(splitPool.size(), 0);
-    for (const auto ind : irange(splitPool.size())) {
-        auto& curSplit = splitPool[ind];
-
-        if (clusterId != nullptr) {
+    if (clusterId != nullptr) {
+        for (auto& curSplit : splitPool) {
             for (auto& wl : curSplit) {
                 auto& outTile = std::get<0>(wl);
                 addSubTensorOffset(outTile, subTensorOffset);
             }
         }
-        const auto logCb = [&](const formatv_object_base& msg) {
-            log.trace("{0}", msg.str());
-        };
-        auto computeSplitCostByArch = VPUIP::getSplitCostCb(costParams.arch);
-        splitPoolCosts[ind] = computeSplitCostByArch(curSplit, costParams, costModel, logCb);
     }
 
+    // All the candidate splits are evaluated at once, so that the workloads they share are queried only once
+    const auto logCb = [&](const formatv_object_base& msg) {
+        log.trace("{0}", msg.str());
+    };
+    auto computeSplitPoolCostsByArch = VPUIP::getSplitPoolCostCb(costParams.arch);
+    const auto splitPoolCosts = computeSplitPoolCostsByArch(splitPool, costParams, costModel, logCb);
+
     const auto bestSplitInd = std::min_element(splitPoolCosts.begin(), splitPoolCosts.end()) - splitPoolCosts.begin();
     if (splitPoolCosts[bestSplitInd] >= VPU::INVALID_COST_BASE) {
         log.setName("GenerateWorkloads");
         log.warning(
                 "An INVALID_COST is caught for bestSplit when calling VPUNN. You can pass a logCb with LOG_ERROR "
-                "level to print debug info in `computeSplitCostByArch` function and report to E#83609 if necessary");
+                "level to print debug info in `computeSplitPoolCostsByArch` function and report to E#83609 if "
+                "necessary");
         log.nest().warning("bestSplit cost value: {0}", splitPoolCosts[bestSplitInd]);
     }
     const auto& bestSplit = splitPool[bestSplitInd];
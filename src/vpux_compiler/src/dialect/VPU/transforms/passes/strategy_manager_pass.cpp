@@ -13,12 +13,21 @@
 #include "vpux/compiler/dialect/VPU/utils/generate_tiling.hpp"
 #include "vpux/compiler/dialect/VPU/utils/manual_strategy_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/multi_cluster_strategy_utils.hpp"
+#include "vpux/compiler/dialect/VPU/utils/strategy_database.hpp"
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/operation_strategies.hpp"
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_opt_alg.hpp"
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_state_provider.hpp"
+#include "vpux/compiler/utils/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
 
 #include <llvm/ADT/TypeSwitch.h>
 
+#if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+
+#include "vpux/compiler/core/developer_build_utils.hpp"
+
+#endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+
 namespace vpux::VPU {
 namespace {
 
@@ -28,8 +37,11 @@ namespace {
 
 class StrategyManagerImplPass final : public StrategyManagerImplBase<StrategyManagerImplPass> {
 public:
-    explicit StrategyManagerImplPass(bool enablePrefetchTiling, Logger log)
-            : _enablePrefetchTiling(enablePrefetchTiling) {
+    explicit StrategyManagerImplPass(bool enablePrefetchTiling, int64_t numStrategyReplicas,
+                                     bool enableExactStrategySolver, Logger log)
+            : _enablePrefetchTiling(enablePrefetchTiling),
+              _numStrategyReplicas(numStrategyReplicas),
+              _enableExactStrategySolver(enableExactStrategySolver) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
@@ -38,22 +50,35 @@ public:
 private:
     void safeRunOnFunc() final;
 
-    SmallVector<std::pair<Strategy, StrategyCost>> getOperationOptions(mlir::Operation* operation, size_t numTiles);
+    SmallVector<std::pair<Strategy, VPUNNCostParameters>> getOperationOptions(mlir::Operation* operation,
+                                                                              size_t numTiles);
+    SmallVector<StrategyCost> getOptionCosts(mlir::Operation* operation,
+                                             ArrayRef<std::pair<Strategy, VPUNNCostParameters>> options,
+                                             const LayerVPUNNCost& costModel) const;
     SmallVector<VPU::MultiClusterStrategy> getAvailiableStrategies(ArchKind arch) const;
     bool checkDefaultStrategy(MultiClusterStrategy strategy) const;
     void fillInOptions(TilingOptions& options) const;
     bool mcTilingNeeded() const;
     bool hasNoUsersOrAllViewLike(mlir::Operation* op) const;
     bool lastOpExceptionCase(mlir::Operation* operation, MultiClusterStrategy strategy) const;
+    std::optional<std::pair<Strategy, VPUNNCostParameters>> getKnownStrategy(mlir::Operation* operation,
+                                                                             StringRef key) const;
+    void applyStrategy(mlir::Operation* operation, const Strategy& strategy) const;
 
     std::shared_ptr<LayerVPUNNCost> _costModel;
+    std::shared_ptr<StrategyDatabase> _database;
+    std::string _databaseContext;
     SmallVector<VPU::MultiClusterStrategy> _archStrategies;
     bool _enablePrefetchTiling = true;
+    int64_t _numStrategyReplicas = 1;
+    bool _enableExactStrategySolver = false;
     int64_t _numTiles;
 };
 
 void StrategyManagerImplPass::fillInOptions(TilingOptions& options) const {
     options.enablePrefetchTiling = _enablePrefetchTiling;
+    options.numStrategyReplicas = _numStrategyReplicas;
+    options.enableExactStrategySolver = _enableExactStrategySolver;
 }
 
 bool StrategyManagerImplPass::mcTilingNeeded() const {
@@ -100,17 +125,93 @@ mlir::LogicalResult StrategyManagerImplPass::initialize(mlir::MLIRContext* ctx)
         _log.trace("Overloading enablePrefetchTiling with an MLIR variable");
         _enablePrefetchTiling = tilingMode.getValue() == "PREFETCH";
     }
+    if (numReplicas.hasValue()) {
+        _log.trace("Overloading numStrategyReplicas with an MLIR variable");
+        _numStrategyReplicas = numReplicas.getValue();
+    }
+    if (exactSolver.hasValue()) {
+        _log.trace("Overloading enableExactStrategySolver with an MLIR variable");
+        _enableExactStrategySolver = exactSolver.getValue();
+    }
+
+    std::string databaseFileName = strategyDatabase.getValue();
+#if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+    parseEnv("IE_NPU_STRATEGY_DATABASE", databaseFileName);
+#endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+    if (!databaseFileName.empty()) {
+        _database = StrategyDatabase::get(databaseFileName, _log);
+    }
     return mlir::success();
 }
 
+std::optional<std::pair<Strategy, VPUNNCostParameters>> StrategyManagerImplPass::getKnownStrategy(
+        mlir::Operation* operation, StringRef key) const {
+    const auto record = _database->lookup(key);
+    if (!record.has_value() || !record->mcStrategy.has_value()) {
+        return std::nullopt;
+    }
+
+    // The key covers everything the strategy depends on, the check guards against stale or edited entries
+    const auto mcStrategy = record->mcStrategy.value();
+    if (llvm::find(_archStrategies, mcStrategy) == _archStrategies.end()) {
+        return std::nullopt;
+    }
+    if (auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(operation)) {
+        if (!clusteredOp.checkStrategyCompatibility(mcStrategy, _numTiles)) {
+            return std::nullopt;
+        }
+    } else if (!checkDefaultStrategy(mcStrategy)) {
+        return std::nullopt;
+    }
+
+    // The tiles are checked for the stored multi-cluster strategy, the same way the options are generated. The
+    // strategy the operation had before is restored afterwards
+    const auto previousStrategy = operation->getAttr(multiClusterStrategy);
+    auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(operation);
+    if (clusteredOp != nullptr) {
+        clusteredOp.setMultiClusterStrategy(mcStrategy);
+    }
+    const auto tiles = getRecordTiling(operation, record.value(), _log.nest());
+    if (previousStrategy != nullptr) {
+        operation->setAttr(multiClusterStrategy, previousStrategy);
+    } else if (operation->hasAttr(multiClusterStrategy)) {
+        operation->removeAttr(multiClusterStrategy);
+    }
+    if (mlir::failed(tiles)) {
+        return std::nullopt;
+    }
+
+    mlir::ArrayAttr tilingStrategyAttr = nullptr;
+    if (!record->tilingStrategy.empty()) {
+        tilingStrategyAttr = getIntArrayAttr(operation->getContext(), record->tilingStrategy);
+    }
+
+    return std::make_pair(Strategy(mcStrategy, tilingStrategyAttr, record->tilingMode),
+                          VPUNNCostParameters(mcStrategy, tiles.value(), record->tilingMode));
+}
+
+void StrategyManagerImplPass::applyStrategy(mlir::Operation* operation, const Strategy& strategy) const {
+    if (auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(operation)) {
+        if (mcTilingNeeded()) {
+            clusteredOp.setMultiClusterStrategy(strategy.getMCStrategy());
+        }
+    }
+
+    if (strategy.getTilingStrategy() != nullptr) {
+        if (auto tilingOp = mlir::dyn_cast<VPU::TilingBuilderOpInterface>(operation)) {
+            tilingOp->setAttr(tilingStrategy, strategy.getTilingStrategy());
+        }
+    }
+}
+
 bool StrategyManagerImplPass::checkDefaultStrategy(MultiClusterStrategy strategy) const {
     // check if strategy is default
     return strategy == MultiClusterStrategy::Clustering;
 }
 
-SmallVector<std::pair<Strategy, StrategyCost>> StrategyManagerImplPass::getOperationOptions(mlir::Operation* operation,
-                                                                                            size_t numTiles) {
-    SmallVector<std::pair<Strategy, StrategyCost>> strategies;
+SmallVector<std::pair<Strategy, VPUNNCostParameters>> StrategyManagerImplPass::getOperationOptions(
+        mlir::Operation* operation, size_t numTiles) {
+    SmallVector<std::pair<Strategy, VPUNNCostParameters>> strategies;
     auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(operation);
 
     auto tilingBuilderOp = mlir::dyn_cast<VPU::TilingBuilderOpInterface>(operation);
@@ -182,13 +283,8 @@ SmallVector<std::pair<Strategy, StrategyCost>> StrategyManagerImplPass::getOpera
                 continue;
             }
 
-            const auto cost =
-                    _costModel->getStrategyCost(operation, VPUNNCostParameters(strategy, operationTiling, mode));
-
-            _log.trace("For operation {0} with MC strategy {1}-{2} vpunn returns cost {3}", operation->getLoc(),
-                       strategy, tilingStrategy, cost);
-
-            strategies.emplace_back(Strategy(strategy, tilingStrategy, mode), cost);
+            strategies.emplace_back(Strategy(strategy, tilingStrategy, mode),
+                                    VPUNNCostParameters(strategy, operationTiling, mode));
 
         } while (hasPrefetch);
     }
@@ -196,6 +292,22 @@ SmallVector<std::pair<Strategy, StrategyCost>> StrategyManagerImplPass::getOpera
     return strategies;
 }
 
+SmallVector<StrategyCost> StrategyManagerImplPass::getOptionCosts(
+        mlir::Operation* operation, ArrayRef<std::pair<Strategy, VPUNNCostParameters>> options,
+        const LayerVPUNNCost& costModel) const {
+    SmallVector<StrategyCost> costs;
+    costs.reserve(options.size());
+    for (const auto& [strategy, parameters] : options) {
+        const auto cost = costModel.getStrategyCost(operation, parameters);
+
+        _log.trace("For operation {0} with MC strategy {1}-{2} vpunn returns cost {3}", operation->getLoc(),
+                   strategy.getMCStrategy(), strategy.getTilingStrategy(), cost);
+
+        costs.push_back(cost);
+    }
+    return costs;
+}
+
 SmallVector<VPU::MultiClusterStrategy> StrategyManagerImplPass::getAvailiableStrategies(ArchKind arch) const {
     auto mcListGetter = createMCStrategyGetter(arch, _numTiles);
 
@@ -210,40 +322,70 @@ void StrategyManagerImplPass::safeRunOnFunc() {
     _costModel = std::make_shared<LayerVPUNNCost>(func);
     _numTiles = IE::getTileExecutor(module).getCount();
     _archStrategies = getAvailiableStrategies(VPU::getArch(module));
+    _databaseContext = llvm::formatv("strategy-manager:{0}:{1}:{2}", stringifyEnum(VPU::getArch(module)), _numTiles,
+                                     _enablePrefetchTiling ? "PREFETCH" : "ISOLATED")
+                               .str();
 
     // calculate cost for all possible strategies
     // assign strategy with min cost
     auto operationStrategies = std::make_shared<OperationStrategies>();
 
-    const auto findStrategyCallback = [&](mlir::Operation* operation) {
-        auto strategies = getOperationOptions(operation, _numTiles);
+    // operations found in the strategy database get their known strategy as the only option,
+    // so the search keeps the real costs of the transitions to them
+    size_t numKnownStrategies = 0;
+    llvm::DenseMap<mlir::Operation*, std::string> databaseKeys;
+    SmallVector<std::pair<mlir::Operation*, SmallVector<std::pair<Strategy, VPUNNCostParameters>>>> operationOptions;
 
-        if (strategies.empty()) {
-            return;
+    const auto findStrategyCallback = [&](mlir::Operation* operation) {
+        if (_database != nullptr && mlir::isa<VPU::ClusteredOpInterface, VPU::TilingBuilderOpInterface>(operation)) {
+            auto key = getStrategyDatabaseKey(operation, _databaseContext);
+            if (auto knownStrategy = getKnownStrategy(operation, key)) {
+                SmallVector<std::pair<Strategy, VPUNNCostParameters>> options;
+                options.push_back(std::move(knownStrategy.value()));
+                operationOptions.emplace_back(operation, std::move(options));
+                ++numKnownStrategies;
+                return;
+            }
+            databaseKeys[operation] = std::move(key);
         }
 
-        for (auto& [strategy, cost] : strategies) {
-            auto operationStrategy = std::make_pair(operation, strategy);
-            operationStrategies->addStrategy(operationStrategy, cost);
+        auto options = getOperationOptions(operation, _numTiles);
+        if (!options.empty()) {
+            operationOptions.emplace_back(operation, std::move(options));
         }
+    };
 
-        // set current and best one
-        auto maxCostIt = std::max_element(strategies.begin(), strategies.end(), [](auto lhs, auto rhs) {
-            return lhs.second < rhs.second;
-        });
+    func.walk(findStrategyCallback);
 
-        if (maxCostIt == strategies.end()) {
-            return;
+    // The costs are evaluated without changing the IR, so the operations are processed concurrently.
+    // VPUNN models can't be shared between threads, each worker takes the cost model of its own thread
+    SmallVector<SmallVector<StrategyCost>> optionCosts(operationOptions.size());
+    loop_1d(LoopExecPolicy::Parallel, func.getContext(), checked_cast<int64_t>(operationOptions.size()),
+            [&](int64_t ind) {
+                const LayerVPUNNCost costModel(func, _log);
+                const auto& [operation, options] = operationOptions[ind];
+                optionCosts[ind] = getOptionCosts(operation, options, costModel);
+            });
+
+    for (auto ind : irange(operationOptions.size())) {
+        const auto& [operation, options] = operationOptions[ind];
+        const auto& costs = optionCosts[ind];
+        for (auto optionInd : irange(options.size())) {
+            operationStrategies->addStrategy(std::make_pair(operation, options[optionInd].first), costs[optionInd]);
         }
 
-        const auto maxCostStrategy = std::make_pair(operation, maxCostIt->first);
+        // set current and best one
+        const auto maxCostInd = std::distance(costs.begin(), std::max_element(costs.begin(), costs.end()));
+        const auto maxCostStrategy = std::make_pair(operation, options[maxCostInd].first);
         operationStrategies->setCurrentStrategy(maxCostStrategy);
         operationStrategies->setBestStrategy(maxCostStrategy);
-    };
-
-    func.walk(findStrategyCallback);
+    }
 
     auto operations = operationStrategies->getAllOperations();
+    if (_database != nullptr) {
+        _log.trace("Strategy database: {0} operations are known, {1} are searched", numKnownStrategies,
+                   operations.size() - numKnownStrategies);
+    }
     if (operations.empty()) {
         return;
     }
@@ -254,7 +396,17 @@ void StrategyManagerImplPass::safeRunOnFunc() {
     if (operations.size() > 1) {
         TilingOptions options;
         fillInOptions(options);
-        const auto optAlgorithm = createAlgorithm(options, stateProvider, operationStrategies);
+
+        StateProviderFactory replicaFactory = nullptr;
+        if (options.numStrategyReplicas > 1) {
+            // The replicas only read the costs, so all of them are calculated in advance on this thread
+            stateProvider->fillInTransitionCosts();
+            replicaFactory = [&](const std::shared_ptr<OperationStrategies>& view, uint32_t seed) {
+                return std::make_shared<DefaultStateProvider>(view, _costModel, seed);
+            };
+        }
+
+        const auto optAlgorithm = createAlgorithm(options, stateProvider, operationStrategies, replicaFactory);
         optAlgorithm->optimize();
     } else {
         auto* operation = operationStrategies->getAllOperations().front();
@@ -279,21 +431,25 @@ void StrategyManagerImplPass::safeRunOnFunc() {
         }
 
         const auto bestResult = operationStrategies->getBestStrategy(operation);
-
-        if (auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(operation)) {
-            if (mcTilingNeeded()) {
-                clusteredOp.setMultiClusterStrategy(bestResult.getMCStrategy());
-            }
-        }
-
-        if (bestResult.getTilingStrategy() != nullptr) {
-            if (auto tilingOp = mlir::dyn_cast<VPU::TilingBuilderOpInterface>(operation)) {
-                tilingOp->setAttr(tilingStrategy, bestResult.getTilingStrategy());
+        applyStrategy(operation, bestResult);
+
+        const auto keyIt = databaseKeys.find(operation);
+        if (keyIt != databaseKeys.end()) {
+            StrategyRecord record;
+            record.mcStrategy = bestResult.getMCStrategy();
+            if (bestResult.getTilingStrategy() != nullptr) {
+                record.tilingStrategy = parseIntArrayAttr<int64_t>(bestResult.getTilingStrategy());
             }
+            record.tilingMode = bestResult.getTilingMode();
+            _database->record(keyIt->second, record);
         }
     };
 
     func.walk(setStrategyCallback);
+
+    if (_database != nullptr) {
+        _database->save();
+    }
 }
 
 }  // namespace
@@ -302,8 +458,10 @@ void StrategyManagerImplPass::safeRunOnFunc() {
 // createStrategyManagerImplPass
 //
 
-std::unique_ptr<mlir::Pass> createStrategyManagerImplPass(bool enablePrefetchTiling, Logger log) {
-    return std::make_unique<StrategyManagerImplPass>(enablePrefetchTiling, log);
+std::unique_ptr<mlir::Pass> createStrategyManagerImplPass(bool enablePrefetchTiling, int64_t numStrategyReplicas,
+                                                          bool enableExactStrategySolver, Logger log) {
+    return std::make_unique<StrategyManagerImplPass>(enablePrefetchTiling, numStrategyReplicas,
+                                                     enableExactStrategySolver, log);
 }
 
 }  // namespace vpux::VPU
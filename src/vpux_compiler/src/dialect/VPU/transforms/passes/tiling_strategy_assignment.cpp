@@ -4,13 +4,21 @@
 //
 
 #include "vpux/compiler/core/tiling.hpp"
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
 #include "vpux/compiler/dialect/VPU/IR/ops.hpp"
 #include "vpux/compiler/dialect/VPU/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPU/utils/generate_tiling.hpp"
 #include "vpux/compiler/dialect/VPU/utils/manual_strategy_utils.hpp"
+#include "vpux/compiler/dialect/VPU/utils/strategy_database.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
+#if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+
+#include "vpux/compiler/core/developer_build_utils.hpp"
+
+#endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+
 using namespace vpux;
 
 namespace {
@@ -55,6 +63,8 @@ private:
     bool _vpunnCost = false;
     VPU::EnableShaveDDRAccessOptimization _shaveDDRAccessOptimizationMode;
     std::shared_ptr<vpux::VPU::LayerCostModel> _costModel = nullptr;
+    std::shared_ptr<VPU::StrategyDatabase> _database = nullptr;
+    std::string _databaseContext;
 };
 
 mlir::LogicalResult TilingStrategyAssignmentPass::initialize(mlir::MLIRContext* ctx) {
@@ -77,12 +87,35 @@ mlir::LogicalResult TilingStrategyAssignmentPass::initialize(mlir::MLIRContext*
         _shaveDDRAccessOptimizationMode =
                 vpux::VPU::getShaveDDRAccessOptimizationMode(enableShaveDDRAccessOptimization);
     }
+
+    std::string databaseFileName = strategyDatabase.getValue();
+#if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+    parseEnv("IE_NPU_STRATEGY_DATABASE", databaseFileName);
+#endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+    if (!databaseFileName.empty()) {
+        _database = VPU::StrategyDatabase::get(databaseFileName, _log);
+    }
     return mlir::success();
 }
 
 void TilingStrategyAssignmentPass::assignStrategy(VPU::TilingBuilderOpInterface origOp) {
     _log.trace("Assign: '{0}' at '{1}'", origOp->getName(), origOp->getLoc());
     auto op = origOp.getOperation();
+
+    std::string databaseKey;
+    if (_database != nullptr) {
+        // The tiling is chosen for the multi-cluster strategy assigned before, so it's a part of the key
+        databaseKey = VPU::getStrategyDatabaseKey(op, _databaseContext, /*withMCStrategy=*/true);
+        const auto record = _database->lookup(databaseKey);
+        if (record.has_value() && !record->tilingStrategy.empty() &&
+            mlir::succeeded(VPU::getRecordTiling(op, record.value(), _log.nest()))) {
+            const auto tilingStrategyAttr = getIntArrayAttr(op->getContext(), record->tilingStrategy);
+            _log.nest().trace("Tiling strategy {0} is found in the strategy database", tilingStrategyAttr);
+            origOp->setAttr(tilingStrategy, tilingStrategyAttr);
+            return;
+        }
+    }
+
     auto defaultTilingMode = getTilingSupportedMode(origOp, _enablePrefetchTiling, _log);
 
     mlir::FailureOr<OutputTiling> tiles = mlir::failure();
@@ -95,10 +128,25 @@ void TilingStrategyAssignmentPass::assignStrategy(VPU::TilingBuilderOpInterface
     VPUX_THROW_WHEN(mlir::failed(tiles), "Invalid tiling strategy for {0}", origOp->getLoc());
 
     origOp->setAttr(tilingStrategy, getIntArrayAttr(op->getContext(), tiles.value()[0].axis));
+
+    if (_database != nullptr) {
+        VPU::StrategyRecord record;
+        record.tilingStrategy = to_small_vector(tiles.value()[0].axis.raw());
+        record.tilingMode = defaultTilingMode;
+        _database->record(databaseKey, record);
+    }
 }
 
 void TilingStrategyAssignmentPass::safeRunOnFunc() {
     auto func = getOperation();
+    if (_database != nullptr) {
+        auto module = func->getParentOfType<mlir::ModuleOp>();
+        _databaseContext = llvm::formatv("tiling-strategy-assignment:{0}:{1}:{2}:{3}:{4}",
+                                         stringifyEnum(VPU::getArch(module)), IE::getTileExecutor(module).getCount(),
+                                         _enablePrefetchTiling ? "PREFETCH" : "ISOLATED", _vpunnCost,
+                                         static_cast<int>(_shaveDDRAccessOptimizationMode))
+                                   .str();
+    }
     if (_vpunnCost) {
         _log.trace("Using VPUNN Cost to get best tiling strategy");
         _costModel = std::make_shared<vpux::VPU::LayerCostModel>(
@@ -125,6 +173,10 @@ void TilingStrategyAssignmentPass::safeRunOnFunc() {
     } else {
         func->walk(assignWithOnlyCMXAccessStrategy);
     }
+
+    if (_database != nullptr) {
+        _database->save();
+    }
 }
 }  // namespace
 
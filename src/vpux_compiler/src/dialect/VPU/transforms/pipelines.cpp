@@ -182,7 +182,8 @@ void vpux::VPU::buildSMPipeline(mlir::OpPassManager& pm, const vpux::MCAndTiling
     // TO DO - SM Assignment Optimization Pass
     // Keep enableSMpipleline Option - false till SM pipeline is built
 
-    pm.addPass(VPU::createStrategyManagerImplPass(options.enablePrefetching, log));
+    pm.addPass(VPU::createStrategyManagerImplPass(options.enablePrefetching, options.numStrategyReplicas,
+                                                  options.enableExactStrategySolver, log));
     pm.addPass(VPU::createEfficientIROrderPass(log));
     if (options.enableVerticalFusion) {
         VPU::buildVFPipeline(pm, VPU::TilingOptions(options), log);
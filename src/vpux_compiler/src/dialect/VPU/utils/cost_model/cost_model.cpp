@@ -9,6 +9,13 @@
 #include <llvm/ADT/TypeSwitch.h>
 #include <mlir/Dialect/Quant/QuantTypes.h>
 
+#include <array>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <sstream>
+#include <unordered_map>
+
 using namespace vpux;
 
 namespace {
@@ -26,22 +33,234 @@ ArrayRef<char> getCostModelData(VPU::ArchKind archKind, bool isFastModel) {
     }
 }
 
+//
+// ThreadCostModels
+//
+
+// Cost models created on the current thread. The models are kept alive until the thread exits, so that each of them
+// is deserialized only once and its internal VPUNN cache stays warm between the passes
+struct ThreadCostModels final {
+    std::map<VPU::ArchKind, std::shared_ptr<VPUNN::VPUCostModel>> costModels;
+    std::map<std::pair<VPU::ArchKind, bool>, std::shared_ptr<VPUNN::VPULayerCostModel>> layerCostModels;
+
+    // Maps the shared models to the name of the model data they were created from
+    std::unordered_map<const void*, StringRef> modelNames;
+};
+
+ThreadCostModels& getThreadCostModels() {
+    thread_local ThreadCostModels models;
+    return models;
+}
+
+StringRef getModelName(bool isFastModel) {
+    return isFastModel ? "fast" : "default";
+}
+
+std::optional<StringRef> getSharedModelName(const void* costModel) {
+    const auto& modelNames = getThreadCostModels().modelNames;
+    const auto it = modelNames.find(costModel);
+    if (it == modelNames.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+//
+// CostMemoTable
+//
+
+// Process-wide table of the VPUNN query results. The queries are keyed by their printed descriptors, which contain all
+// the parameters used by the inference. The table is split into shards to reduce the lock contention between threads
+class CostMemoTable final {
+public:
+    std::optional<VPUNN::CyclesInterfaceType> find(const std::string& key) {
+        auto& shard = getShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const auto it = shard.entries.find(key);
+        if (it == shard.entries.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void insert(std::string key, VPUNN::CyclesInterfaceType cost) {
+        auto& shard = getShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.entries.size() >= MAX_ENTRIES_PER_SHARD) {
+            return;
+        }
+        shard.entries.emplace(std::move(key), cost);
+    }
+
+private:
+    static constexpr size_t NUM_SHARDS = 64;
+    static constexpr size_t MAX_ENTRIES_PER_SHARD = 16 * 1024;
+
+    struct Shard final {
+        std::shared_mutex mutex;
+        std::unordered_map<std::string, VPUNN::CyclesInterfaceType> entries;
+    };
+
+    Shard& getShard(const std::string& key) {
+        return _shards[std::hash<std::string>{}(key) % NUM_SHARDS];
+    }
+
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+CostMemoTable& getCostMemoTable() {
+    static CostMemoTable table;
+    return table;
+}
+
+template <typename... Descriptors>
+std::string getQueryKey(StringRef queryName, StringRef modelName, const Descriptors&... descriptors) {
+    std::ostringstream stream;
+    stream << queryName.str() << '/' << modelName.str();
+    ((stream << '/' << descriptors), ...);
+    return stream.str();
+}
+
+template <typename QueryFunc>
+VPUNN::CyclesInterfaceType getMemoizedCost(std::string key, QueryFunc&& query) {
+    auto& table = getCostMemoTable();
+    if (const auto cost = table.find(key)) {
+        return cost.value();
+    }
+
+    const auto cost = query();
+    if (!VPUNN::Cycles::isErrorCode(cost)) {
+        table.insert(std::move(key), cost);
+    }
+    return cost;
+}
+
+// Runs each distinct query of a batch only once. Returns the costs in the order of the queries, `firstInds` receives
+// the index of the first identical query for each of them
+template <typename KeyFunc, typename QueryFunc>
+SmallVector<VPUNN::CyclesInterfaceType> getBatchCosts(size_t numQueries, bool isMemoized, KeyFunc&& getKey,
+                                                      QueryFunc&& runQuery, SmallVectorImpl<size_t>& firstInds) {
+    std::unordered_map<std::string, size_t> firstQueries;
+    SmallVector<VPUNN::CyclesInterfaceType> costs(numQueries);
+    firstInds.resize(numQueries);
+
+    for (const auto ind : irange(numQueries)) {
+        auto key = getKey(ind);
+        const auto res = firstQueries.emplace(key, ind);
+        firstInds[ind] = res.first->second;
+        if (!res.second) {
+            costs[ind] = costs[firstInds[ind]];
+            continue;
+        }
+
+        if (!isMemoized) {
+            costs[ind] = runQuery(ind);
+            continue;
+        }
+        costs[ind] = getMemoizedCost(std::move(key), [&]() {
+            return runQuery(ind);
+        });
+    }
+
+    return costs;
+}
+
 }  // namespace
 
 std::shared_ptr<VPUNN::VPUCostModel> vpux::VPU::createCostModel(ArchKind arch) {
-    // Track [E#70055]
-    // TODO: Do not switch vpunn model to FAST temporarily, need to investigate the impact for workloads generation pass
-    bool isFastModel = false;
-    const auto costModelData = getCostModelData(arch, isFastModel);
-    return std::make_shared<VPUNN::VPUCostModel>(costModelData.data(), costModelData.size(), false);
+    auto& models = getThreadCostModels();
+    auto& costModel = models.costModels[arch];
+    if (costModel == nullptr) {
+        // Track [E#70055]
+        // TODO: Do not switch vpunn model to FAST temporarily, need to investigate the impact for workloads generation
+        // pass
+        bool isFastModel = false;
+        const auto costModelData = getCostModelData(arch, isFastModel);
+        costModel = std::make_shared<VPUNN::VPUCostModel>(costModelData.data(), costModelData.size(), false);
+        models.modelNames[costModel.get()] = getModelName(isFastModel);
+    }
+    return costModel;
 }
 
 std::shared_ptr<VPUNN::VPULayerCostModel> vpux::VPU::createLayerCostModel(ArchKind arch, bool isFastModel) {
-    // VPUNN provides two models - default and fast.
-    // Currently use default model for workload generation. Ticket to explore moving to fast model [E#70055].
-    // Currently use fast model for per layer evaluation in multi-cluster strategy selection
-    const auto costModelData = getCostModelData(arch, isFastModel);
-    return std::make_shared<VPUNN::VPULayerCostModel>(costModelData.data(), costModelData.size(), false);
+    auto& models = getThreadCostModels();
+    auto& layerCostModel = models.layerCostModels[{arch, isFastModel}];
+    if (layerCostModel == nullptr) {
+        // VPUNN provides two models - default and fast.
+        // Currently use default model for workload generation. Ticket to explore moving to fast model [E#70055].
+        // Currently use fast model for per layer evaluation in multi-cluster strategy selection
+        const auto costModelData = getCostModelData(arch, isFastModel);
+        layerCostModel =
+                std::make_shared<VPUNN::VPULayerCostModel>(costModelData.data(), costModelData.size(), false);
+        models.modelNames[layerCostModel.get()] = getModelName(isFastModel);
+    }
+    return layerCostModel;
+}
+
+VPUNN::CyclesInterfaceType vpux::VPU::getDPUWorkloadCost(VPUNN::VPUCostModel& costModel,
+                                                         const VPUNN::DPUWorkload& workload, std::string& info) {
+    const auto modelName = getSharedModelName(&costModel);
+    if (!modelName.has_value()) {
+        return costModel.DPU(workload, info);
+    }
+
+    return getMemoizedCost(getQueryKey("dpu", modelName.value(), workload), [&]() {
+        return costModel.DPU(workload, info);
+    });
+}
+
+VPUNN::CyclesInterfaceType vpux::VPU::getDPULayerCost(VPUNN::VPULayerCostModel& costModel, VPUNN::DPULayer& layer,
+                                                      const VPUNN::VPULayerStrategy& strategy) {
+    const auto modelName = getSharedModelName(&costModel);
+    if (!modelName.has_value()) {
+        return costModel.Layer(layer, strategy);
+    }
+
+    return getMemoizedCost(getQueryKey("layer", modelName.value(), layer, strategy), [&]() {
+        return costModel.Layer(layer, strategy);
+    });
+}
+
+SmallVector<VPUNN::CyclesInterfaceType> vpux::VPU::getDPUWorkloadCosts(VPUNN::VPUCostModel& costModel,
+                                                                       ArrayRef<VPUNN::DPUWorkload> workloads,
+                                                                       SmallVectorImpl<std::string>& infos) {
+    const auto modelName = getSharedModelName(&costModel);
+    infos.assign(workloads.size(), std::string());
+
+    SmallVector<size_t> firstInds;
+    auto costs = getBatchCosts(
+            workloads.size(), modelName.has_value(),
+            [&](size_t ind) {
+                return getQueryKey("dpu", modelName.value_or("unshared"), workloads[ind]);
+            },
+            [&](size_t ind) {
+                return costModel.DPU(workloads[ind], infos[ind]);
+            },
+            firstInds);
+
+    for (const auto ind : irange(workloads.size())) {
+        if (firstInds[ind] != ind) {
+            infos[ind] = infos[firstInds[ind]];
+        }
+    }
+    return costs;
+}
+
+SmallVector<VPUNN::CyclesInterfaceType> vpux::VPU::getDPULayerCosts(VPUNN::VPULayerCostModel& costModel,
+                                                                    MutableArrayRef<VPUNN::DPULayer> layers,
+                                                                    const VPUNN::VPULayerStrategy& strategy) {
+    const auto modelName = getSharedModelName(&costModel);
+
+    SmallVector<size_t> firstInds;
+    return getBatchCosts(
+            layers.size(), modelName.has_value(),
+            [&](size_t ind) {
+                return getQueryKey("layer", modelName.value_or("unshared"), layers[ind], strategy);
+            },
+            [&](size_t ind) {
+                return costModel.Layer(layers[ind], strategy);
+            },
+            firstInds);
 }
 
 ///@brief Validate vpunn cost. If cost is not the defined error code then return it
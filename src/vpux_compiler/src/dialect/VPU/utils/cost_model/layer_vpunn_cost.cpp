@@ -112,11 +112,9 @@ StrategyCost LayerVPUNNCost::getSpillingReadCost(mlir::Operation* operation, con
                                          ? OutputTiling({TileInfo(getShape(operation->getResult(0)))})
                                          : parameters._tiling;
 
-        MultiClusterStrategySetter mcSetter(operation, parameters._strategy);
-
         readCost = std::accumulate(
                 std::begin(childTiling), std::end(childTiling), readCost, [&](StrategyCost cost, auto& tileInfo) {
-                    const auto childOperandsTiling = getTileTypes(operation, tileInfo);
+                    const auto childOperandsTiling = getTileTypesForStrategy(operation, tileInfo, parameters._strategy);
                     VPUX_THROW_WHEN(childOperandsTiling.size() <= operandInd,
                                     "Incorrect number of types {0} for operands of operation {1}",
                                     childOperandsTiling.size(), operation->getLoc());
@@ -160,14 +158,15 @@ StrategyCost LayerVPUNNCost::getNCELayerCost(VPU::NCEOpInterface nceOp, const VP
     _log.trace("Start calculating vpunn cost for Op {0} with strategy {1}", nceOp.getLoc(), parameters._strategy);
 
     const auto costParams = VPU::getWorkloadCostParam(nceOp, _arch, _numDPUs);
-    MultiClusterStrategySetter mcSetter(nceOp, parameters._strategy);
     // Set prefetching to be true to ignore the DMA cost and only get the execution DPU cost
     // According to the VPUNN API definition,
     //      when prefetching is false, the returned cost is the sum of DPU + weights DMA
     //      when prefetching is true, the returned cost is just DPU because it considers the weights are prefetched
     const auto vpunnStrategy = VPU::getVPULayerStrategy(parameters._strategy, _numDPUs, _numTiles, _numShaveActs, true);
+    // The tile types are built for the evaluated strategy, the operation itself isn't changed
     auto vpunnLayerDPUCosts = getDPUCostForNCEOp(nceOp, parameters._strategy, parameters._tiling, tilesTypes,
-                                                 costParams, vpunnStrategy, _vpunnCostModel, _log);
+                                                 costParams, vpunnStrategy, _vpunnCostModel, _log,
+                                                 /*tileTypesForStrategy=*/true);
     _log.trace("VPUNN DPU layer costs {0}", vpunnLayerDPUCosts);
 
     if (vpunnLayerDPUCosts.empty()) {
@@ -182,6 +181,10 @@ StrategyCost LayerVPUNNCost::getNCELayerCost(VPU::NCEOpInterface nceOp, const VP
     const auto getSpillingReadCost = [&](NDTypeInterface srcType) -> uint32_t {
         return checked_cast<uint32_t>(getDMACost(srcType, _vpuDevice, _vpunnCostModel, _numDMAPorts));
     };
+    if (tilesTypes.empty()) {
+        tilesTypes.push_back(getTileTypesForStrategy(nceOp, TileInfo(getShape(nceOp->getResult(0))),
+                                                     parameters._strategy));
+    }
     auto vpunnLayerWeightsCosts = getPerTileWeightsDMACosts(nceOp, tilesTypes, getSpillingReadCost);
     _log.trace("VPUNN weights DMA costs {0}", vpunnLayerWeightsCosts);
     vpunnCost += getWeightsDMACostForNCEOp(nceOp, parameters._tiling, vpunnLayerDPUCosts, vpunnLayerWeightsCosts, 0,
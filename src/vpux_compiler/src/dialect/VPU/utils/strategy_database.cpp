@@ -0,0 +1,384 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/utils/strategy_database.hpp"
+
+#include "vpux/compiler/compiler_version.hpp"
+#include "vpux/compiler/dialect/VPU/IR/ops_interfaces.hpp"
+#include "vpux/compiler/dialect/VPU/utils/manual_strategy_utils.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/FormatVariadic.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA256.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+
+using namespace vpux;
+using namespace VPU;
+
+namespace {
+
+constexpr StringLiteral versionKey = "version";
+constexpr StringLiteral strategiesKey = "strategies";
+constexpr StringLiteral tilingModeKey = "tilingMode";
+constexpr StringLiteral lastUseDayKey = "lastUseDay";
+
+// The key is a prefix of the digest, collisions are negligible for the number of layers in practice
+constexpr size_t KEY_DIGEST_SIZE = 16;
+
+// The last use is tracked with the granularity of a day, so the lookups of the same records rewrite the file at most
+// once a day
+int64_t getCurrentDay() {
+    using Days = std::chrono::duration<int64_t, std::ratio<24 * 60 * 60>>;
+    return std::chrono::duration_cast<Days>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void printTypes(llvm::raw_ostream& os, mlir::TypeRange types) {
+    os << "(";
+    llvm::interleaveComma(types, os, [&](mlir::Type type) {
+        type.print(os);
+    });
+    os << ")";
+}
+
+void printSignature(llvm::raw_ostream& os, mlir::Operation* op) {
+    os << op->getName() << " ";
+    printTypes(os, op->getOperandTypes());
+    os << " -> ";
+    printTypes(os, op->getResultTypes());
+}
+
+std::optional<TilingMode> symbolizeTilingMode(StringRef str) {
+    for (auto mode : {TilingMode::ISOLATED, TilingMode::PIPELINING, TilingMode::PREFETCHING}) {
+        if (getTilingModeStr(mode) == str) {
+            return mode;
+        }
+    }
+    return std::nullopt;
+}
+
+llvm::json::Value convertRecordToJSON(const StrategyRecord& record) {
+    llvm::json::Object object;
+    if (record.mcStrategy.has_value()) {
+        object[multiClusterStrategy] = stringifyMultiClusterStrategy(record.mcStrategy.value());
+    }
+    if (!record.tilingStrategy.empty()) {
+        object[tilingStrategy] = llvm::json::Array(record.tilingStrategy);
+    }
+    object[tilingModeKey] = getTilingModeStr(record.tilingMode);
+    object[lastUseDayKey] = record.lastUseDay;
+    return object;
+}
+
+std::optional<StrategyRecord> convertJSONToRecord(const llvm::json::Value& value) {
+    const auto* object = value.getAsObject();
+    if (object == nullptr) {
+        return std::nullopt;
+    }
+
+    StrategyRecord record;
+    if (const auto mcStrategy = object->getString(multiClusterStrategy)) {
+        record.mcStrategy = symbolizeMultiClusterStrategy(mcStrategy.value());
+        if (!record.mcStrategy.has_value()) {
+            return std::nullopt;
+        }
+    }
+    if (const auto* tiling = object->getArray(tilingStrategy)) {
+        for (const auto& dim : *tiling) {
+            const auto dimValue = dim.getAsInteger();
+            if (!dimValue.has_value() || dimValue.value() <= 0) {
+                return std::nullopt;
+            }
+            record.tilingStrategy.push_back(dimValue.value());
+        }
+    }
+    if (const auto modeStr = object->getString(tilingModeKey)) {
+        const auto mode = symbolizeTilingMode(modeStr.value());
+        if (!mode.has_value()) {
+            return std::nullopt;
+        }
+        record.tilingMode = mode.value();
+    }
+    // The entries written before the last use was tracked are the first candidates for pruning
+    record.lastUseDay = object->getInteger(lastUseDayKey).value_or(0);
+    return record;
+}
+
+}  // namespace
+
+//
+// getStrategyDatabaseKey
+//
+
+std::string vpux::VPU::getStrategyDatabaseKey(mlir::Operation* op, StringRef context, bool withMCStrategy) {
+    VPUX_THROW_WHEN(op == nullptr, "Can't compute the strategy database key of a null operation");
+
+    std::string signature;
+    llvm::raw_string_ostream os(signature);
+
+    os << context << "\n";
+    printSignature(os, op);
+    os << "\n";
+
+    // Strategy attributes are the result of the lookup, they must not change the key
+    for (const auto& attr : op->getAttrs()) {
+        if (attr.getName() == tilingStrategy || (attr.getName() == multiClusterStrategy && !withMCStrategy)) {
+            continue;
+        }
+        os << attr.getName() << " = ";
+        attr.getValue().print(os);
+        os << "\n";
+    }
+
+    // Neighbour signature: the strategy of the operation depends on the spilling around it
+    for (auto operand : op->getOperands()) {
+        os << "producer ";
+        if (auto* producer = operand.getDefiningOp()) {
+            printSignature(os, producer);
+        } else {
+            os << "block argument";
+        }
+        os << "\n";
+    }
+
+    // The order of the users isn't stable between models, so the consumers are sorted
+    SmallVector<std::string> consumers;
+    for (auto* user : op->getUsers()) {
+        std::string consumer;
+        llvm::raw_string_ostream consumerStream(consumer);
+        printSignature(consumerStream, user);
+        consumers.push_back(std::move(consumerStream.str()));
+    }
+    llvm::sort(consumers);
+    for (const auto& consumer : consumers) {
+        os << "consumer " << consumer << "\n";
+    }
+
+    llvm::SHA256 hasher;
+    hasher.update(StringRef(VPUX_COMPILER_VERSION));
+    hasher.update(os.str());
+    const auto digest = hasher.final();
+    return llvm::toHex(ArrayRef<uint8_t>(digest).take_front(KEY_DIGEST_SIZE), /*LowerCase=*/true);
+}
+
+//
+// getRecordTiling
+//
+
+mlir::FailureOr<OutputTiling> vpux::VPU::getRecordTiling(mlir::Operation* op, const StrategyRecord& record,
+                                                         Logger log) {
+    if (record.tilingStrategy.empty()) {
+        return OutputTiling{};
+    }
+
+    const auto outputShape = getShape(op->getResult(0));
+    if (record.tilingStrategy.size() != outputShape.size()) {
+        return mlir::failure();
+    }
+
+    auto tilingInfo = mlir::dyn_cast<VPU::TilingInfoOpInterface>(op);
+    if (tilingInfo == nullptr) {
+        return mlir::failure();
+    }
+
+    auto tiles = fillDividedTiles(op, Shape(record.tilingStrategy), outputShape);
+    if (mlir::failed(tiles) || !tilingInfo.isSupportedTiling(tiles.value(), record.tilingMode, log)) {
+        return mlir::failure();
+    }
+    return tiles;
+}
+
+//
+// StrategyDatabase
+//
+
+StrategyDatabase::StrategyDatabase(StringRef fileName, Logger log, size_t maxRecords)
+        : _fileName(fileName.str()), _log(log.nest("strategy-database")), _maxRecords(maxRecords) {
+    VPUX_THROW_WHEN(_fileName.empty(), "Strategy database file name is empty");
+    VPUX_THROW_WHEN(_maxRecords == 0, "Strategy database must keep at least one record");
+    load(_records);
+    _log.trace("Loaded {0} strategies from '{1}'", _records.size(), _fileName);
+}
+
+std::shared_ptr<StrategyDatabase> StrategyDatabase::get(StringRef fileName, Logger log) {
+    static std::mutex registryMutex;
+    static llvm::StringMap<std::shared_ptr<StrategyDatabase>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& database = registry[fileName];
+    if (database == nullptr) {
+        database = std::make_shared<StrategyDatabase>(fileName, log);
+    }
+    return database;
+}
+
+void StrategyDatabase::load(llvm::StringMap<StrategyRecord>& records) const {
+    auto buffer = llvm::MemoryBuffer::getFile(_fileName, /*IsText=*/true);
+    if (!buffer || buffer.get()->getBufferSize() == 0) {
+        // The database is created by the first save
+        return;
+    }
+
+    auto json = llvm::json::parse(buffer.get()->getBuffer());
+    if (!json) {
+        _log.warning("Strategy database '{0}' is corrupted, ignoring it: {1}", _fileName,
+                     llvm::toString(json.takeError()));
+        return;
+    }
+
+    const auto* root = json->getAsObject();
+    if (root == nullptr || root->getInteger(versionKey) != VERSION) {
+        _log.warning("Strategy database '{0}' has unsupported format, ignoring it", _fileName);
+        return;
+    }
+
+    const auto* strategies = root->getObject(strategiesKey);
+    if (strategies == nullptr) {
+        return;
+    }
+
+    for (const auto& [key, value] : *strategies) {
+        auto record = convertJSONToRecord(value);
+        if (!record.has_value()) {
+            _log.warning("Ignoring invalid strategy database entry '{0}'", key.str());
+            continue;
+        }
+        records.try_emplace(key.str(), std::move(record.value()));
+    }
+}
+
+std::optional<StrategyRecord> StrategyDatabase::lookup(StringRef key) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _records.find(key);
+    if (it == _records.end()) {
+        return std::nullopt;
+    }
+
+    const auto currentDay = getCurrentDay();
+    if (it->second.lastUseDay != currentDay) {
+        it->second.lastUseDay = currentDay;
+        _isModified = true;
+    }
+    return it->second;
+}
+
+void StrategyDatabase::record(StringRef key, const StrategyRecord& record) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto currentDay = getCurrentDay();
+    auto [it, inserted] = _records.try_emplace(key, record);
+    if (!inserted && it->second == record && it->second.lastUseDay == currentDay) {
+        return;
+    }
+    it->second = record;
+    it->second.lastUseDay = currentDay;
+    _isModified = true;
+}
+
+size_t StrategyDatabase::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _records.size();
+}
+
+// Must be called with the mutex locked
+void StrategyDatabase::prune() {
+    if (_records.size() <= _maxRecords) {
+        return;
+    }
+
+    // The key breaks the ties, so that all the processes drop the same records
+    SmallVector<std::pair<int64_t, StringRef>> lastUses;
+    lastUses.reserve(_records.size());
+    for (const auto& entry : _records) {
+        lastUses.emplace_back(entry.getValue().lastUseDay, entry.getKey());
+    }
+    const auto numPruned = _records.size() - _maxRecords;
+    std::nth_element(lastUses.begin(), lastUses.begin() + numPruned, lastUses.end());
+
+    // The keys are owned by the map, they are copied before the erasure
+    SmallVector<std::string> prunedKeys;
+    prunedKeys.reserve(numPruned);
+    for (const auto& lastUse : ArrayRef(lastUses).take_front(numPruned)) {
+        prunedKeys.push_back(lastUse.second.str());
+    }
+    for (const auto& key : prunedKeys) {
+        _records.erase(key);
+    }
+    _log.trace("Pruned {0} least recently used strategies from '{1}'", numPruned, _fileName);
+}
+
+void StrategyDatabase::save() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_isModified) {
+        return;
+    }
+
+    // Other compilations might have added strategies since the database was loaded, the own records take precedence
+    llvm::StringMap<StrategyRecord> fileRecords;
+    load(fileRecords);
+    for (auto& entry : fileRecords) {
+        auto [it, inserted] = _records.try_emplace(entry.getKey(), entry.getValue());
+        if (!inserted) {
+            it->second.lastUseDay = std::max(it->second.lastUseDay, entry.getValue().lastUseDay);
+        }
+    }
+    prune();
+
+    // Sorted keys keep the file stable between the runs
+    SmallVector<StringRef> keys;
+    for (const auto& entry : _records) {
+        keys.push_back(entry.getKey());
+    }
+    llvm::sort(keys);
+
+    llvm::json::Object strategies;
+    for (auto key : keys) {
+        strategies[key] = convertRecordToJSON(_records.find(key)->second);
+    }
+    llvm::json::Object root;
+    root[versionKey] = VERSION;
+    root[strategiesKey] = std::move(strategies);
+
+    // Write into a unique temporary file first and publish it with an atomic rename,
+    // so concurrent compilations either see the old database or the new one
+    llvm::SmallString<128> tmpModel(_fileName);
+    tmpModel.append(".tmp-%%%%%%%%");
+
+    int fd = -1;
+    llvm::SmallString<128> tmpPath;
+    if (const auto errc = llvm::sys::fs::createUniqueFile(tmpModel, fd, tmpPath)) {
+        _log.warning("Failed to create temporary file for strategy database '{0}': {1}", _fileName, errc.message());
+        return;
+    }
+
+    {
+        llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+        os << llvm::formatv("{0:2}", llvm::json::Value(std::move(root))) << "\n";
+        os.close();
+
+        if (os.has_error()) {
+            _log.warning("Failed to write strategy database '{0}': {1}", _fileName, os.error().message());
+            os.clear_error();
+            std::ignore = llvm::sys::fs::remove(tmpPath);
+            return;
+        }
+    }
+
+    if (const auto errc = llvm::sys::fs::rename(tmpPath, _fileName)) {
+        _log.warning("Failed to publish strategy database '{0}': {1}", _fileName, errc.message());
+        std::ignore = llvm::sys::fs::remove(tmpPath);
+        return;
+    }
+
+    _isModified = false;
+    _log.trace("Saved {0} strategies to '{1}'", _records.size(), _fileName);
+}
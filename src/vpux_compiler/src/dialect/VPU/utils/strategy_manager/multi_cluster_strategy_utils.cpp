@@ -1302,7 +1302,7 @@ SmallVector<uint32_t> vpux::VPU::getDPUCostForNCEOp(VPU::NCEOpInterface nceOp, V
                                                     const VPUIP::WorkloadCostParams& costParams,
                                                     VPUNN::VPULayerStrategy vpunnStrategy,
                                                     const std::shared_ptr<VPUNN::VPULayerCostModel>& vpunnCostModel,
-                                                    Logger log) {
+                                                    Logger log, bool tileTypesForStrategy) {
     std::vector<VPUNN::DPULayer> vpunnLayers{VPU::getDPULayer(costParams)};
     if (!outTiles.empty()) {
         auto tilingBuilderOp = mlir::dyn_cast<VPU::TilingBuilderOpInterface>(nceOp.getOperation());
@@ -1315,7 +1315,10 @@ SmallVector<uint32_t> vpux::VPU::getDPUCostForNCEOp(VPU::NCEOpInterface nceOp, V
             for (auto& outTile : outTiles) {
                 vpunnLayers.push_back(vpunnLayer);
                 auto inTiles = tilingBuilderOp.backInferTileInfo(outTile, log);
-                tilesTypes.push_back(getTileTypes(nceOp.getOperation(), outTile, inTiles));
+                tilesTypes.push_back(tileTypesForStrategy
+                                             ? getTileTypesForStrategy(nceOp.getOperation(), outTile, mcStrategy,
+                                                                       inTiles)
+                                             : getTileTypes(nceOp.getOperation(), outTile, inTiles));
                 auto& inputTile = inTiles.tiles.front();
                 auto inPad = inTiles.pads;
                 vpunnLayers.back().inputs = {getVPUTensor(inputTile.shape, costParams.inDataType)};
@@ -1338,9 +1341,13 @@ SmallVector<uint32_t> vpux::VPU::getDPUCostForNCEOp(VPU::NCEOpInterface nceOp, V
         }
     }
 
+    // Tiles of equal shapes produce identical layers, the batch query evaluates each of them once
+    const auto vpunnLayerCosts = getDPULayerCosts(*vpunnCostModel, vpunnLayers, vpunnStrategy);
+
     SmallVector<uint32_t> layerDPUCosts;
-    for (auto& vpunnLayer : vpunnLayers) {
-        auto cost = checkAndReturnCost(vpunnCostModel->Layer(vpunnLayer, vpunnStrategy), log);
+    for (const auto ind : irange(vpunnLayers.size())) {
+        const auto& vpunnLayer = vpunnLayers[ind];
+        auto cost = checkAndReturnCost(vpunnLayerCosts[ind], log);
         if (cost >= VPU::INVALID_COST_BASE) {
             printVPUNNLayerConfig(vpunnLayer, vpunnStrategy, log);
             if (cost == VPU::ERROR_INPUT_TOO_BIG && !layerDPUCosts.empty()) {
@@ -13,6 +13,15 @@
 using namespace vpux;
 using namespace VPU;
 
+OperationStrategies::OperationStrategies(): _transitionCost(std::make_shared<TransitionCostMap>()) {
+}
+
+std::shared_ptr<OperationStrategies> OperationStrategies::createView() const {
+    auto view = std::make_shared<OperationStrategies>(*this);
+    view->_isView = true;
+    return view;
+}
+
 void OperationStrategies::setStrategyState(const OperationStrategy& opStr, unsigned bitIndex) {
     auto& strategySet = _strategies[opStr.first];
     VPUX_THROW_WHEN(strategySet.empty(), "There are no strategies for operation {0}", opStr.first->getLoc());
@@ -55,6 +64,8 @@ CombinedTransitionKey OperationStrategies::getTransitionHash(const OperationStra
 }
 
 void OperationStrategies::addStrategy(const OperationStrategy& opStr, const StrategyCost cost) {
+    VPUX_THROW_WHEN(_isView, "Strategies can't be added to the storage view");
+
     auto& strategySet = _strategies[opStr.first];
     auto foundStrategy = llvm::find_if(strategySet, [&](auto& item) {
         return item.strategy == opStr.second;
@@ -70,6 +81,8 @@ void OperationStrategies::addStrategy(const OperationStrategy& opStr, const Stra
 }
 
 void OperationStrategies::setStrategy(const OperationStrategy& opStr, const StrategyCost cost) {
+    VPUX_THROW_WHEN(_isView, "Strategy costs can't be updated in the storage view");
+
     auto& strategySet = _strategies[opStr.first];
 
     auto foundStrategy = llvm::find_if(strategySet, [&](auto& item) {
@@ -117,7 +130,8 @@ void OperationStrategies::setBestStrategy(const OperationStrategy& opStr) {
 
 void OperationStrategies::setTransitionCost(const OperationStrategy& srcOpStr, const OperationStrategy& dstOpStr,
                                             const StrategyCost cost) {
-    _transitionCost[getTransitionHash(srcOpStr, dstOpStr)] = cost;
+    VPUX_THROW_WHEN(_isView, "Transition costs can't be updated in the storage view");
+    (*_transitionCost)[getTransitionHash(srcOpStr, dstOpStr)] = cost;
 }
 
 StrategyCost OperationStrategies::getStrategyCost(const OperationStrategy& opStr) const {
@@ -137,11 +151,12 @@ std::optional<StrategyCost> OperationStrategies::getTransitionCost(const Operati
                                                                    const OperationStrategy& dstOpStr) const {
     const auto hash = getTransitionHash(srcOpStr, dstOpStr);
 
-    if (_transitionCost.count(hash) == 0) {
+    const auto foundCost = _transitionCost->find(hash);
+    if (foundCost == _transitionCost->end()) {
         return std::nullopt;
     }
 
-    return _transitionCost.at(hash);
+    return foundCost->second;
 }
 
 Strategy OperationStrategies::getCurrentStrategy(mlir::Operation* operation) const {
@@ -163,3 +178,27 @@ SmallVector<StrategyInfo> OperationStrategies::getAllStrategies(mlir::Operation*
 
     return _strategies.at(operation);
 }
+
+void OperationStrategies::pinStrategy(const OperationStrategy& opStr) {
+    setCurrentStrategy(opStr);
+    setBestStrategy(opStr);
+    _pinnedOperations.insert(opStr.first);
+}
+
+void OperationStrategies::unpinAll() {
+    _pinnedOperations.clear();
+}
+
+llvm::SetVector<mlir::Operation*> OperationStrategies::getSearchedOperations() const {
+    if (_pinnedOperations.empty()) {
+        return _operationList;
+    }
+
+    llvm::SetVector<mlir::Operation*> operations;
+    for (auto* operation : _operationList) {
+        if (!_pinnedOperations.contains(operation)) {
+            operations.insert(operation);
+        }
+    }
+    return operations;
+}
@@ -0,0 +1,240 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_graph.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <deque>
+#include <limits>
+
+using namespace vpux;
+using namespace VPU;
+
+namespace {
+
+// Index of the minimal value, the first one is taken for equal values
+template <typename CostFunc>
+std::pair<size_t, double> findMinimum(size_t numStrategies, CostFunc&& getCost) {
+    size_t bestInd = 0;
+    double bestCost = std::numeric_limits<double>::max();
+    for (size_t ind = 0; ind < numStrategies; ++ind) {
+        const auto cost = getCost(ind);
+        if (cost < bestCost) {
+            bestInd = ind;
+            bestCost = cost;
+        }
+    }
+    return {bestInd, bestCost};
+}
+
+}  // namespace
+
+//
+// StrategyGraph
+//
+
+double StrategyGraph::getCost(ArrayRef<size_t> strategyInds) const {
+    VPUX_THROW_WHEN(strategyInds.size() != nodes.size(), "Expected {0} strategies, got {1}", nodes.size(),
+                    strategyInds.size());
+
+    double cost = 0;
+    for (auto ind : irange(nodes.size())) {
+        cost += nodes[ind].costs[strategyInds[ind]];
+    }
+    for (const auto& edge : edges) {
+        const auto numDstStrategies = nodes[edge.dst].costs.size();
+        cost += edge.costs[strategyInds[edge.src] * numDstStrategies + strategyInds[edge.dst]];
+    }
+    return cost;
+}
+
+//
+// StrategyGraphSolver
+//
+
+StrategyGraphSolver::StrategyGraphSolver(const StrategyGraph& graph) {
+    const auto numNodes = graph.nodes.size();
+    _numStrategies.reserve(numNodes);
+    _nodeCosts.reserve(numNodes);
+    _adjacency.resize(numNodes);
+
+    for (const auto& node : graph.nodes) {
+        VPUX_THROW_WHEN(node.costs.empty(), "There are no strategies for the node");
+        _numStrategies.push_back(node.costs.size());
+        _nodeCosts.push_back(node.costs);
+    }
+
+    for (const auto& edge : graph.edges) {
+        VPUX_THROW_WHEN(edge.src >= numNodes || edge.dst >= numNodes, "Invalid edge {0} -> {1}", edge.src, edge.dst);
+        const auto rows = _numStrategies[edge.src];
+        const auto cols = _numStrategies[edge.dst];
+        VPUX_THROW_WHEN(edge.costs.size() != rows * cols, "Expected {0} edge costs, got {1}", rows * cols,
+                        edge.costs.size());
+
+        if (edge.src == edge.dst) {
+            for (size_t ind = 0; ind < rows; ++ind) {
+                _nodeCosts[edge.src][ind] += edge.costs[ind * cols + ind];
+            }
+            continue;
+        }
+
+        addEdge(edge.src, edge.dst, CostTable{rows, cols, edge.costs});
+    }
+
+    SmallVector<bool> isEliminated(numNodes, false);
+    SmallVector<bool> isQueued(numNodes, true);
+    std::deque<size_t> worklist;
+    for (size_t node = 0; node < numNodes; ++node) {
+        worklist.push_back(node);
+    }
+
+    while (!worklist.empty()) {
+        const auto node = worklist.front();
+        worklist.pop_front();
+        isQueued[node] = false;
+
+        const auto numNeighbours = _adjacency[node].size();
+        if (isEliminated[node] || numNeighbours > 2) {
+            continue;
+        }
+
+        SmallVector<size_t> neighbours;
+        for (const auto& item : _adjacency[node]) {
+            neighbours.push_back(item.first);
+        }
+
+        if (numNeighbours == 0) {
+            eliminateIsolated(node);
+        } else if (numNeighbours == 1) {
+            eliminateLeaf(node);
+        } else {
+            eliminateSeries(node);
+        }
+        isEliminated[node] = true;
+
+        // The neighbours might have become a leaf or a series node
+        for (auto neighbour : neighbours) {
+            if (!isQueued[neighbour]) {
+                isQueued[neighbour] = true;
+                worklist.push_back(neighbour);
+            }
+        }
+    }
+
+    for (size_t node = 0; node < numNodes; ++node) {
+        if (!isEliminated[node]) {
+            _kernelNodes.push_back(node);
+        }
+    }
+}
+
+void StrategyGraphSolver::addEdge(size_t first, size_t second, const CostTable& table) {
+    auto addTable = [](std::map<size_t, CostTable>& neighbours, size_t neighbour, CostTable&& newTable) {
+        auto it = neighbours.find(neighbour);
+        if (it == neighbours.end()) {
+            neighbours.emplace(neighbour, std::move(newTable));
+            return;
+        }
+        for (auto ind : irange(newTable.values.size())) {
+            it->second.values[ind] += newTable.values[ind];
+        }
+    };
+
+    CostTable transposed{table.cols, table.rows, SmallVector<double>(table.values.size())};
+    for (size_t row = 0; row < table.rows; ++row) {
+        for (size_t col = 0; col < table.cols; ++col) {
+            transposed.values[col * table.rows + row] = table.at(row, col);
+        }
+    }
+
+    addTable(_adjacency[first], second, CostTable(table));
+    addTable(_adjacency[second], first, std::move(transposed));
+}
+
+void StrategyGraphSolver::removeEdges(size_t node) {
+    for (const auto& item : _adjacency[node]) {
+        _adjacency[item.first].erase(node);
+    }
+    _adjacency[node].clear();
+}
+
+void StrategyGraphSolver::eliminateIsolated(size_t node) {
+    const auto& costs = _nodeCosts[node];
+    const auto bestInd = findMinimum(_numStrategies[node], [&](size_t ind) {
+                             return costs[ind];
+                         }).first;
+
+    _eliminations.push_back(Elimination{node, {}, {bestInd}});
+}
+
+void StrategyGraphSolver::eliminateLeaf(size_t node) {
+    const auto neighbour = _adjacency[node].begin()->first;
+    const auto& table = _adjacency[node].begin()->second;
+    const auto& costs = _nodeCosts[node];
+
+    Elimination elimination{node, {neighbour}, SmallVector<size_t>(_numStrategies[neighbour])};
+    for (size_t neighbourInd = 0; neighbourInd < _numStrategies[neighbour]; ++neighbourInd) {
+        const auto [bestInd, bestCost] = findMinimum(_numStrategies[node], [&](size_t ind) {
+            return costs[ind] + table.at(ind, neighbourInd);
+        });
+        elimination.choices[neighbourInd] = bestInd;
+        _nodeCosts[neighbour][neighbourInd] += bestCost;
+    }
+
+    _eliminations.push_back(std::move(elimination));
+    removeEdges(node);
+}
+
+void StrategyGraphSolver::eliminateSeries(size_t node) {
+    auto it = _adjacency[node].begin();
+    const auto first = it->first;
+    const auto firstTable = it->second;
+    ++it;
+    const auto second = it->first;
+    const auto secondTable = it->second;
+    const auto& costs = _nodeCosts[node];
+
+    const auto numFirst = _numStrategies[first];
+    const auto numSecond = _numStrategies[second];
+    CostTable table{numFirst, numSecond, SmallVector<double>(numFirst * numSecond)};
+    Elimination elimination{node, {first, second}, SmallVector<size_t>(numFirst * numSecond)};
+    for (size_t firstInd = 0; firstInd < numFirst; ++firstInd) {
+        for (size_t secondInd = 0; secondInd < numSecond; ++secondInd) {
+            const auto [bestInd, bestCost] = findMinimum(_numStrategies[node], [&](size_t ind) {
+                return costs[ind] + firstTable.at(ind, firstInd) + secondTable.at(ind, secondInd);
+            });
+            elimination.choices[firstInd * numSecond + secondInd] = bestInd;
+            table.values[firstInd * numSecond + secondInd] = bestCost;
+        }
+    }
+
+    _eliminations.push_back(std::move(elimination));
+    removeEdges(node);
+    addEdge(first, second, table);
+}
+
+SmallVector<size_t> StrategyGraphSolver::solve(const KernelAssignment& kernelAssignment) const {
+    SmallVector<size_t> strategyInds(_numStrategies.size(), std::numeric_limits<size_t>::max());
+
+    for (auto node : _kernelNodes) {
+        const auto it = kernelAssignment.find(node);
+        VPUX_THROW_WHEN(it == kernelAssignment.end(), "Strategy of the kernel node {0} is not set", node);
+        VPUX_THROW_WHEN(it->second >= _numStrategies[node], "Invalid strategy {0} of the kernel node {1}", it->second,
+                        node);
+        strategyInds[node] = it->second;
+    }
+
+    // The neighbours of a node are either kernel nodes or eliminated after it
+    for (const auto& elimination : llvm::reverse(_eliminations)) {
+        size_t choiceInd = 0;
+        for (auto neighbour : elimination.neighbours) {
+            choiceInd = choiceInd * _numStrategies[neighbour] + strategyInds[neighbour];
+        }
+        strategyInds[elimination.node] = elimination.choices[choiceInd];
+    }
+
+    return strategyInds;
+}
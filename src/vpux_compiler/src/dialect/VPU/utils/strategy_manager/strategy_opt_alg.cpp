@@ -4,12 +4,83 @@
 //
 
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_opt_alg.hpp"
+#include "vpux/compiler/utils/loop.hpp"
 #include "vpux/utils/algorithms/simulated_annealing.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
+#include <cmath>
+#include <exception>
+#include <optional>
+#include <random>
 
 using namespace vpux;
 
 constexpr size_t SA_INIT_ITERATIONS = 200;
 
+namespace {
+
+/*
+One chain of the parallel tempering with its own storage view and random generator
+*/
+struct Replica {
+    Replica(const std::shared_ptr<OperationStrategies>& view, std::shared_ptr<DefaultStateProvider> provider,
+            uint32_t seed)
+            : storage(view), stateProvider(std::move(provider)), randomEngine(seed) {
+    }
+
+    std::shared_ptr<OperationStrategies> storage;
+    std::shared_ptr<DefaultStateProvider> stateProvider;
+    std::mt19937 randomEngine;
+    double currentCost = 0;
+    double bestCost = 0;
+    std::exception_ptr error;
+};
+
+/*
+Geometric temperature ladder from the initial temperature down to 1
+*/
+SmallVector<size_t> getTemperatureLadder(size_t initialTemperature, size_t numReplicas) {
+    SmallVector<size_t> ladder;
+    ladder.reserve(numReplicas);
+    for (size_t ind = 0; ind < numReplicas; ++ind) {
+        const auto ratio = static_cast<double>(ind) / static_cast<double>(numReplicas - 1);
+        const auto temperature = std::pow(static_cast<double>(initialTemperature), 1.0 - ratio);
+        ladder.push_back(std::max<size_t>(static_cast<size_t>(std::round(temperature)), 1));
+    }
+    return ladder;
+}
+
+/*
+Metropolis steps at fixed temperature, the same as one temperature level of the simulated annealing.
+The reannealing of the simulated annealing is not applied, the replica keeps its own chain
+*/
+void runMetropolisSteps(Replica& replica, size_t temperature, size_t steps) {
+    std::uniform_real_distribution<double> dist(0, 1);
+    auto& provider = *replica.stateProvider;
+
+    for (size_t step = 0; step < steps; ++step) {
+        const auto currentState = provider.getRandomState();
+        const double currentCost = provider.getCost(currentState);
+        const auto neighbour = provider.getNeighbourState(currentState);
+        const double delta = provider.getCost(neighbour) - currentCost;
+
+        const double acceptance = dist(replica.randomEngine);
+        if (delta > 0 && std::exp(-(delta / temperature)) <= acceptance) {
+            continue;
+        }
+
+        provider.updateState(neighbour);
+        replica.currentCost += delta;
+        if (replica.currentCost <= replica.bestCost) {
+            replica.bestCost = replica.currentCost;
+            provider.updateSolution(neighbour);
+        }
+    }
+}
+
+}  // namespace
+
 void SimulatedAnnealingStrategy::optimize() {
     vpux::algorithm::simulatedAnnealing<OperationStrategy>(
             _temperature, _steps,
@@ -30,14 +101,160 @@ void SimulatedAnnealingStrategy::optimize() {
             });
 }
 
-std::unique_ptr<IStrategyOptAlgorithm> createAlgorithm(const vpux::VPU::TilingOptions&,
+void ParallelTemperingStrategy::optimize() {
+    const auto operations = _storage->getAllOperations();
+    VPUX_THROW_WHEN(operations.empty(), "There are no operations added in this state");
+    VPUX_THROW_WHEN(_numReplicas < 2, "Parallel tempering requires at least two replicas, got {0}", _numReplicas);
+    if (_temperature == 0) {
+        return;
+    }
+
+    SmallVector<Replica> replicas;
+    replicas.reserve(_numReplicas);
+    for (size_t ind = 0; ind < _numReplicas; ++ind) {
+        const auto seed = static_cast<uint32_t>(ind);
+        auto view = _storage->createView();
+        auto provider = _providerFactory(view, seed);
+        replicas.emplace_back(view, std::move(provider), seed);
+
+        auto& replica = replicas.back();
+        replica.currentCost = replica.stateProvider->getFullCost();
+        replica.bestCost = replica.currentCost;
+    }
+
+    // Replica which currently runs at the temperature level, the hottest level is the first one
+    const auto ladder = getTemperatureLadder(_temperature, _numReplicas);
+    auto replicaAtLevel = to_small_vector(irange(_numReplicas));
+
+    // The replicas share the iterations of the single chain simulated annealing
+    const auto numRounds = divUp(_temperature, _numReplicas);
+    std::mt19937 exchangeEngine(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+    auto* ctx = operations.front()->getContext();
+
+    for (size_t round = 0; round < numRounds; ++round) {
+        loop_1d(LoopExecPolicy::Parallel, ctx, checked_cast<int64_t>(_numReplicas), [&](int64_t level) {
+            auto& replica = replicas[replicaAtLevel[level]];
+            try {
+                runMetropolisSteps(replica, ladder[level], _steps);
+            } catch (...) {
+                replica.error = std::current_exception();
+            }
+        });
+
+        for (auto& replica : replicas) {
+            if (replica.error != nullptr) {
+                std::rethrow_exception(replica.error);
+            }
+        }
+
+        // Exchange the temperatures of the neighbouring levels, alternating the even and the odd pairs
+        for (auto level = round % 2; level + 1 < _numReplicas; level += 2) {
+            const auto& hotReplica = replicas[replicaAtLevel[level]];
+            const auto& coldReplica = replicas[replicaAtLevel[level + 1]];
+            const auto exponent = (1.0 / ladder[level + 1] - 1.0 / ladder[level]) *
+                                  (coldReplica.currentCost - hotReplica.currentCost);
+            if (exponent >= 0 || std::exp(exponent) > dist(exchangeEngine)) {
+                std::swap(replicaAtLevel[level], replicaAtLevel[level + 1]);
+            }
+        }
+    }
+
+    // Recalculate the full cost of the best solution of each replica, as the accumulated costs are approximate
+    std::optional<size_t> bestReplicaInd;
+    StrategyCost bestCost = 0;
+    for (auto ind : irange(replicas.size())) {
+        auto& replica = replicas[ind];
+        for (auto* operation : operations) {
+            replica.storage->setCurrentStrategy(std::make_pair(operation, replica.storage->getBestStrategy(operation)));
+        }
+
+        const auto cost = replica.stateProvider->getFullCost();
+        if (!bestReplicaInd.has_value() || cost < bestCost) {
+            bestReplicaInd = ind;
+            bestCost = cost;
+        }
+    }
+
+    const auto& bestStorage = replicas[bestReplicaInd.value()].storage;
+    for (auto* operation : operations) {
+        const auto bestState = std::make_pair(operation, bestStorage->getBestStrategy(operation));
+        _storage->setCurrentStrategy(bestState);
+        _storage->setBestStrategy(bestState);
+    }
+}
+
+void DynamicProgrammingStrategy::optimize() {
+    const auto graph = _stateProvider->buildStrategyGraph();
+    const StrategyGraphSolver solver(graph);
+
+    const auto getStrategyInd = [&](size_t node, const Strategy& strategy) {
+        const auto& graphNode = graph.nodes[node];
+        const auto foundStrategy = llvm::find(graphNode.strategies, strategy);
+        VPUX_THROW_WHEN(foundStrategy == graphNode.strategies.end(), "Strategy of {0} is not in the graph",
+                        graphNode.operation->getLoc());
+        return static_cast<size_t>(std::distance(graphNode.strategies.begin(), foundStrategy));
+    };
+
+    StrategyGraphSolver::KernelAssignment kernelAssignment;
+    const auto kernelNodes = solver.getKernelNodes();
+    if (!kernelNodes.empty()) {
+        // The reduced regions are assigned optimally for the current strategies of the kernel and pinned,
+        // so the fallback searches only over the kernel nodes
+        for (auto node : kernelNodes) {
+            kernelAssignment[node] = getStrategyInd(node, _storage->getCurrentStrategy(graph.nodes[node].operation));
+        }
+
+        const auto initialInds = solver.solve(kernelAssignment);
+        for (auto ind : irange(graph.nodes.size())) {
+            if (!kernelAssignment.count(ind)) {
+                const auto& graphNode = graph.nodes[ind];
+                _storage->pinStrategy(std::make_pair(graphNode.operation, graphNode.strategies[initialInds[ind]]));
+            }
+        }
+
+        _fallback->optimize();
+        _storage->unpinAll();
+
+        for (auto node : kernelNodes) {
+            kernelAssignment[node] = getStrategyInd(node, _storage->getBestStrategy(graph.nodes[node].operation));
+        }
+    }
+
+    const auto strategyInds = solver.solve(kernelAssignment);
+    for (auto ind : irange(graph.nodes.size())) {
+        const auto& graphNode = graph.nodes[ind];
+        const auto state = std::make_pair(graphNode.operation, graphNode.strategies[strategyInds[ind]]);
+        _storage->setCurrentStrategy(state);
+        _storage->setBestStrategy(state);
+    }
+}
+
+std::unique_ptr<IStrategyOptAlgorithm> createAlgorithm(const vpux::VPU::TilingOptions& options,
                                                        const std::shared_ptr<IStateProvider>& stateProvider,
-                                                       const std::shared_ptr<OperationStrategies>& strategies) {
+                                                       const std::shared_ptr<OperationStrategies>& strategies,
+                                                       StateProviderFactory replicaFactory) {
     // number of iteration will be chosen based on compilation options
     // for long compilation iteration number for each step is equal number of operations in the storage
-    return std::make_unique<SimulatedAnnealingStrategy>(
-            stateProvider, getInitialTemperature(strategies),
-            std::max(strategies->getAllOperations().size(), SA_INIT_ITERATIONS));
+    const auto steps = std::max(strategies->getAllOperations().size(), SA_INIT_ITERATIONS);
+    const auto numReplicas = static_cast<size_t>(std::max<int64_t>(options.numStrategyReplicas, 1));
+    std::unique_ptr<IStrategyOptAlgorithm> annealing;
+    if (numReplicas > 1 && replicaFactory != nullptr) {
+        annealing = std::make_unique<ParallelTemperingStrategy>(strategies, std::move(replicaFactory),
+                                                                getInitialTemperature(strategies), steps, numReplicas);
+    } else {
+        annealing = std::make_unique<SimulatedAnnealingStrategy>(stateProvider, getInitialTemperature(strategies),
+                                                                 steps);
+    }
+
+    if (options.enableExactStrategySolver) {
+        if (auto defaultStateProvider = std::dynamic_pointer_cast<DefaultStateProvider>(stateProvider)) {
+            return std::make_unique<DynamicProgrammingStrategy>(strategies, defaultStateProvider,
+                                                                std::move(annealing));
+        }
+    }
+
+    return annealing;
 }
 
 /*
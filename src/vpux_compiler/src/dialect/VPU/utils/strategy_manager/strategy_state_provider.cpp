@@ -9,6 +9,8 @@
 #include "vpux/compiler/dialect/VPU/utils/multi_cluster_strategy_utils.hpp"
 #include "vpux/compiler/utils/VPU/tile_utils.hpp"
 
+#include <llvm/ADT/DenseSet.h>
+
 #include <numeric>
 
 using namespace vpux::VPU;
@@ -36,22 +38,30 @@ OperationStrategy DefaultStateProvider::getState(int temperature, double& cost,
     if (state == nullptr) {
         initializeTemperature(temperature);
         reannealingStep(temperature, cost);
-        const auto allOperations = _storage->getAllOperations();
-        VPUX_THROW_WHEN(allOperations.empty(), "There are no operations added in this state");
-
-        return randomOperation(allOperations.getArrayRef());
+        return getRandomState();
     }
 
-    auto allStrategies = _storage->getAllStrategies(state->first);
+    return getNeighbourState(*state);
+}
+
+OperationStrategy DefaultStateProvider::getRandomState() {
+    const auto operations = _storage->getSearchedOperations();
+    VPUX_THROW_WHEN(operations.empty(), "There are no operations to search in this state");
+
+    return randomOperation(operations.getArrayRef());
+}
+
+OperationStrategy DefaultStateProvider::getNeighbourState(const OperationStrategy& state) {
+    auto allStrategies = _storage->getAllStrategies(state.first);
     auto chosenStrategy = allStrategies[0].strategy;
 
     if (allStrategies.size() != 1) {
         std::uniform_int_distribution<> strategyDistribution(0, allStrategies.size() - 1);
         do {
             chosenStrategy = allStrategies[strategyDistribution(_generator)].strategy;
-        } while (chosenStrategy == state->second);
+        } while (chosenStrategy == state.second);
     }
-    return std::make_pair(state->first, chosenStrategy);
+    return std::make_pair(state.first, chosenStrategy);
 }
 
 StrategyCost DefaultStateProvider::getCost(const OperationStrategy& state) {
@@ -96,6 +106,106 @@ StrategyCost DefaultStateProvider::accumulateCost(ArrayRef<mlir::Operation*> nei
     });
 }
 
+void DefaultStateProvider::fillInNeighbourCosts(mlir::Operation* neighbour, const OperationStrategy& state,
+                                                bool parent) {
+    if (neighbour == nullptr) {
+        return;
+    }
+
+    if (!_storage->hasAnyStrategy(neighbour)) {
+        getTransitionOutsideCost(state, neighbour, parent);
+        return;
+    }
+
+    for (const auto& strategyInfo : _storage->getAllStrategies(neighbour)) {
+        const auto neighbourState = std::make_pair(neighbour, strategyInfo.strategy);
+        parent ? getTransitionCost(neighbourState, state) : getTransitionCost(state, neighbourState);
+    }
+}
+
+void DefaultStateProvider::fillInTransitionCosts() {
+    for (auto* operation : _storage->getAllOperations()) {
+        if (_neighbours.count(operation) == 0) {
+            fillInNeighbours(operation);
+        }
+
+        const auto& [parents, consumers] = _neighbours[operation];
+        for (const auto& strategyInfo : _storage->getAllStrategies(operation)) {
+            const auto state = std::make_pair(operation, strategyInfo.strategy);
+            for (auto* parent : parents) {
+                fillInNeighbourCosts(parent, state, true);
+            }
+            for (auto* consumer : consumers) {
+                fillInNeighbourCosts(consumer, state, false);
+            }
+        }
+    }
+}
+
+StrategyGraph DefaultStateProvider::buildStrategyGraph() {
+    StrategyGraph graph;
+    const auto allOperations = _storage->getAllOperations();
+
+    llvm::DenseMap<mlir::Operation*, size_t> nodeInds;
+    for (auto* operation : allOperations) {
+        nodeInds[operation] = graph.nodes.size();
+
+        StrategyGraph::Node node;
+        node.operation = operation;
+        for (const auto& strategyInfo : _storage->getAllStrategies(operation)) {
+            node.strategies.push_back(strategyInfo.strategy);
+            node.costs.push_back(strategyInfo.strategyCost);
+        }
+        graph.nodes.push_back(std::move(node));
+    }
+
+    // The transitions are collected in the same way as in getFullCost, each of them is counted once
+    llvm::DenseSet<mlir::Operation*> passedOp;
+    for (auto* operation : allOperations) {
+        if (_neighbours.count(operation) == 0) {
+            fillInNeighbours(operation);
+        }
+
+        const auto nodeInd = nodeInds[operation];
+        const auto addTransitions = [&](ArrayRef<mlir::Operation*> neighbours, bool parent) {
+            for (auto* neighbour : neighbours) {
+                if (neighbour == nullptr || passedOp.contains(neighbour)) {
+                    continue;
+                }
+
+                auto& node = graph.nodes[nodeInd];
+                if (!_storage->hasAnyStrategy(neighbour)) {
+                    for (auto ind : irange(node.strategies.size())) {
+                        const auto state = std::make_pair(operation, node.strategies[ind]);
+                        node.costs[ind] += getTransitionOutsideCost(state, neighbour, parent);
+                    }
+                    continue;
+                }
+
+                const auto neighbourInd = nodeInds[neighbour];
+                StrategyGraph::Edge edge;
+                edge.src = parent ? neighbourInd : nodeInd;
+                edge.dst = parent ? nodeInd : neighbourInd;
+                const auto& srcNode = graph.nodes[edge.src];
+                const auto& dstNode = graph.nodes[edge.dst];
+                for (const auto& srcStrategy : srcNode.strategies) {
+                    for (const auto& dstStrategy : dstNode.strategies) {
+                        edge.costs.push_back(getTransitionCost(std::make_pair(srcNode.operation, srcStrategy),
+                                                               std::make_pair(dstNode.operation, dstStrategy)));
+                    }
+                }
+                graph.edges.push_back(std::move(edge));
+            }
+        };
+
+        addTransitions(_neighbours[operation].first, true);
+        addTransitions(_neighbours[operation].second, false);
+        passedOp.insert(operation);
+    }
+
+    return graph;
+}
+
 void DefaultStateProvider::initializeTemperature(int temperature) {
     if (_initialTemperature.has_value()) {
         return;
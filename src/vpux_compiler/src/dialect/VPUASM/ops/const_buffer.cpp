@@ -13,15 +13,23 @@ using namespace vpux;
 //
 
 void VPUASM::ConstBufferOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
-    vpux::Const::Content cnt = getContent();
+    const auto size = getBinarySize();
+    auto tmpBuf = std::make_unique<uint8_t[]>(size);
+    serializeToBuffer(MutableArrayRef<uint8_t>(tmpBuf.get(), size));
 
-    const auto size = cnt.getType().getTotalAllocSize().count();
-    auto tmpBuf = std::make_unique<char[]>(size);
-    MutableArrayRef<char> buf(tmpBuf.get(), size);
-    cnt.copyTo(buf);
+    binDataSection.appendData(tmpBuf.get(), size);
+}
+
+bool VPUASM::ConstBufferOp::canSerializeToBuffer() {
+    return true;
+}
+
+void VPUASM::ConstBufferOp::serializeToBuffer(MutableArrayRef<uint8_t> buffer) {
+    const auto cnt = getContent();
+    VPUX_THROW_UNLESS(buffer.size() == static_cast<size_t>(cnt.getType().getTotalAllocSize().count()),
+                      "Buffer of {0} bytes doesn't match the size of the constant {1}", buffer.size(), *this);
 
-    auto ptrCharTmp = reinterpret_cast<uint8_t*>(tmpBuf.get());
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    cnt.copyTo(MutableArrayRef<char>(reinterpret_cast<char*>(buffer.data()), buffer.size()));
 }
 
 size_t VPUASM::ConstBufferOp::getBinarySize() {
@@ -3,8 +3,6 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
@@ -19,9 +17,5 @@ using namespace vpux;
 uint32_t vpux::VPUASM::DeclareKernelEntryOp::getKernelEntry() {
     const auto elfBlob = ELF::getKernelELF(getOperation(), getKernelPath());
 
-    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
-    auto elf_reader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
-
-    auto actKernelHeader = elf_reader.getHeader();
-    return actKernelHeader->e_entry;
+    return ShaveBinaryResources::getInstance().getKernelInfo(elfBlob).entryPoint;
 }
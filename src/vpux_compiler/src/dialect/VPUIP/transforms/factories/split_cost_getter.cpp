@@ -22,3 +22,16 @@ VPUIP::SplitCostCb VPUIP::getSplitCostCb(VPU::ArchKind arch) {
     }
     }
 }
+
+VPUIP::SplitPoolCostCb VPUIP::getSplitPoolCostCb(VPU::ArchKind arch) {
+    switch (arch) {
+    case VPU::ArchKind::NPU37XX:
+    case VPU::ArchKind::NPU40XX: {
+        return VPUIP::arch37xx::computeSplitPoolCosts;
+    }
+    case VPU::ArchKind::UNKNOWN:
+    default: {
+        VPUX_THROW("Unexpected architecture {0}", arch);
+    }
+    }
+}
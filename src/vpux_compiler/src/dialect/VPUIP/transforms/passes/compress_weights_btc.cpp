@@ -9,6 +9,7 @@
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
 #include "vpux/compiler/utils/codec_factory.hpp"
 #include "vpux/compiler/utils/compression_utils.hpp"
+#include "vpux/compiler/utils/loop.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 #include "vpux/compiler/utils/swizzling_utils.hpp"
 #include "vpux/compiler/utils/types.hpp"
@@ -32,47 +33,16 @@ private:
 };
 
 //
-// NNDMAOpConverter
+// CompressionCandidate
 //
 
-class NNDMAOpConverter final : public mlir::OpRewritePattern<VPUIP::NNDMAOp> {
-public:
-    NNDMAOpConverter(mlir::MLIRContext* ctx, const ICodec::CompressionAlgorithm& algo, VPU::ArchKind arch, Logger log)
-            : mlir::OpRewritePattern<VPUIP::NNDMAOp>(ctx), _log(log), _codec(vpux::makeCodec(algo, arch)) {
-    }
-
-public:
-    mlir::LogicalResult matchAndRewrite(VPUIP::NNDMAOp origOp, mlir::PatternRewriter& rewriter) const final;
-
-private:
-    ICodec::CompressionMode getCompressionMode(Const::DeclareOp constOp) const;
-
-    Logger _log;
-    const std::unique_ptr<ICodec> _codec;
-    mlir::FailureOr<std::vector<uint8_t>> compressDataFromDeclareOp(Const::DeclareOp constOp,
-                                                                    ICodec::CompressionMode compressionMode) const;
+struct CompressionCandidate {
+    VPUIP::NNDMAOp dmaOp;
+    Const::DeclareOp constOp;
+    VPURT::DeclareBufferOp outBufferOp;
 };
 
-ICodec::CompressionMode NNDMAOpConverter::getCompressionMode(Const::DeclareOp constOp) const {
-    if (!_codec->supportsFP16compression()) {
-        return ICodec::CompressionMode::UINT8;
-    }
-
-    const auto inputElementType = constOp.getType().cast<vpux::NDTypeInterface>().getElementType();
-    return inputElementType.isF16() ? ICodec::CompressionMode::FP16 : ICodec::CompressionMode::UINT8;
-}
-
-mlir::FailureOr<std::vector<uint8_t>> NNDMAOpConverter::compressDataFromDeclareOp(
-        Const::DeclareOp constOp, ICodec::CompressionMode compressionMode) const {
-    const auto content = constOp.getContent();
-    const Byte totalInputSize = getTotalSize(constOp);
-    std::vector<uint8_t> origData(checked_cast<size_t>(totalInputSize.count()));
-    content.copyTo(MutableArrayRef(reinterpret_cast<char*>(origData.data()), origData.size()));
-
-    return _codec->compress(origData, compressionMode, _log);
-}
-
-mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mlir::PatternRewriter& rewriter) const {
+std::optional<CompressionCandidate> getCompressionCandidate(VPUIP::NNDMAOp origOp, Logger log) {
     const auto loc = origOp->getLoc();
     auto input = origOp.getInput();
     auto output = origOp.getOutputBuff();
@@ -81,20 +51,20 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
 
     auto inConstOp = input.getDefiningOp<Const::DeclareOp>();
     if (inConstOp == nullptr) {
-        return mlir::failure();
+        return std::nullopt;
     }
 
     auto outBufferOp = output.getDefiningOp<VPURT::DeclareBufferOp>();
     if (outBufferOp == nullptr) {
-        return mlir::failure();
+        return std::nullopt;
     }
 
     if (outputType.getMemoryKind() != VPU::MemoryKind::CMX_NN) {
-        _log.nest().trace("CompressedDMA only support CONST2CMX");
-        return mlir::failure();
+        log.nest().trace("CompressedDMA only support CONST2CMX");
+        return std::nullopt;
     }
 
-    _log.trace("Check if can change to compressed DMA, operation - '{0}'", loc);
+    log.trace("Check if can change to compressed DMA, operation - '{0}'", loc);
 
     const auto originInShape = inputType.getShape().raw();
     const auto originOutShape = outputType.getShape().raw();
@@ -103,8 +73,8 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
     const auto strideOutReqs = StrideReqs::compact(originOutShape.size());
 
     if (!strideInReqs.checkStrides(input) || !strideOutReqs.checkStrides(output)) {
-        _log.nest().trace("Strides check failed");
-        return mlir::failure();
+        log.nest().trace("Strides check failed");
+        return std::nullopt;
     }
 
     if (outputType.isa<VPUIP::DistributedBufferType>()) {
@@ -112,29 +82,59 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
         const auto distributionAttr = distributedType.getDistribution();
         const auto distributionMode = distributionAttr.getMode().getValue();
         if (distributionMode != VPU::DistributionMode::DUPLICATED) {
-            _log.nest().trace("Only DUPLICATE Distributed mode supported, mode - '{0}'",
-                              VPU::stringifyDistributionMode(distributionMode));
-            return mlir::failure();
+            log.nest().trace("Only DUPLICATE Distributed mode supported, mode - '{0}'",
+                             VPU::stringifyDistributionMode(distributionMode));
+            return std::nullopt;
         }
     }
 
     const Byte totalInputSize = getTotalSize(origOp.getInput());
     constexpr Byte MIN_INPUT_SIZE = 4_KB;
     if (totalInputSize < MIN_INPUT_SIZE) {
-        _log.nest().trace("Size smaller than minimal '{0}' < '{1}'", totalInputSize.count(), MIN_INPUT_SIZE.count());
-        return mlir::failure();
+        log.nest().trace("Size smaller than minimal '{0}' < '{1}'", totalInputSize.count(), MIN_INPUT_SIZE.count());
+        return std::nullopt;
     }
 
-    auto compressionMode = getCompressionMode(inConstOp);
-    _log.trace("Compress constant '{0}', type - '{1}', compression mode: {2}", inConstOp->getLoc(), inputType,
-               ICodec::compressionModeToStr(compressionMode));
-
-    const auto compressedDataOrFailure = compressDataFromDeclareOp(inConstOp, compressionMode);
+    return CompressionCandidate{origOp, inConstOp, outBufferOp};
+}
 
-    if (mlir::failed(compressedDataOrFailure)) {
-        return mlir::failure();
+ICodec::CompressionMode getCompressionMode(const ICodec& codec, Const::DeclareOp constOp) {
+    if (!codec.supportsFP16compression()) {
+        return ICodec::CompressionMode::UINT8;
     }
-    const auto compressedData = compressedDataOrFailure.value();
+
+    const auto inputElementType = constOp.getType().cast<vpux::NDTypeInterface>().getElementType();
+    return inputElementType.isF16() ? ICodec::CompressionMode::FP16 : ICodec::CompressionMode::UINT8;
+}
+
+mlir::FailureOr<std::vector<uint8_t>> compressDataFromDeclareOp(const ICodec& codec, Const::DeclareOp constOp,
+                                                                ICodec::CompressionMode compressionMode,
+                                                                Logger log) {
+    const auto content = constOp.getContent();
+    const Byte totalInputSize = getTotalSize(constOp);
+    std::vector<uint8_t> origData(checked_cast<size_t>(totalInputSize.count()));
+    content.copyTo(MutableArrayRef(reinterpret_cast<char*>(origData.data()), origData.size()));
+
+    return codec.compress(origData, compressionMode, log);
+}
+
+//
+// replaceWithDecompressDMA
+//
+
+void replaceWithDecompressDMA(mlir::RewriterBase& rewriter, const CompressionCandidate& candidate,
+                              ICodec::CompressionMode compressionMode, ArrayRef<uint8_t> compressedData, Logger log) {
+    auto origOp = candidate.dmaOp;
+    auto inConstOp = candidate.constOp;
+    auto outBufferOp = candidate.outBufferOp;
+
+    const auto loc = origOp->getLoc();
+    const auto inputType = origOp.getInput().getType().cast<vpux::NDTypeInterface>();
+    const auto outputType = origOp.getOutputBuff().getType().cast<vpux::NDTypeInterface>();
+    const Byte totalInputSize = getTotalSize(origOp.getInput());
+
+    log.trace("Compress constant '{0}', type - '{1}', compression mode: {2}", inConstOp->getLoc(), inputType,
+              ICodec::compressionModeToStr(compressionMode));
 
     const auto ctx = rewriter.getContext();
     auto u8Type = getUInt8Type(ctx);
@@ -155,7 +155,7 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
         newSrcType = mlir::cast<mlir::MemRefType>(
                 vpux::setCompressionState(newSrcType, VPUIP::CompressionState::CompiletimeCompressed));
         const auto newSrcStorageType = mlir::RankedTensorType::get(compressedDataShape.raw(), u8Type);
-        newSrcContentAttr = mlir::DenseElementsAttr::get(newSrcStorageType, ArrayRef(compressedData));
+        newSrcContentAttr = mlir::DenseElementsAttr::get(newSrcStorageType, compressedData);
     } else if (compressionMode == ICodec::CompressionMode::FP16) {
         unsigned f16TypeSizeBytes = f16Type.getWidth() / CHAR_BIT;
         const Shape newDstShape{totalInputSize.count() / f16TypeSizeBytes, 1, 1, 1};
@@ -200,10 +200,8 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
 
     const auto uncompressed = totalInputSize.count();
     const auto compressed = compressedData.size();
-    _log.trace("Compressed weights for {0}: {1} / {2} ({3})", loc, compressed, uncompressed,
-               (double)compressed / uncompressed);
-
-    return mlir::success();
+    log.trace("Compressed weights for {0}: {1} / {2} ({3})", loc, compressed, uncompressed,
+              (double)compressed / uncompressed);
 }
 
 void CompressWeightsBTCPass::safeRunOnFunc() {
@@ -214,12 +212,44 @@ void CompressWeightsBTCPass::safeRunOnFunc() {
 
     _log.trace("VPUIP CompressWeightsBTCPass");
     auto& ctx = getContext();
+    const auto codec = vpux::makeCodec(algo, arch, &ctx);
+
+    SmallVector<CompressionCandidate> candidates;
+    func.walk([&](VPUIP::NNDMAOp dmaOp) {
+        if (auto candidate = getCompressionCandidate(dmaOp, _log)) {
+            candidates.push_back(candidate.value());
+        }
+    });
+
+    // Constants are compressed in parallel before the IR is changed, a constant used by several DMAs is compressed once
+    SmallVector<Const::DeclareOp> constOps;
+    DenseMap<mlir::Operation*, size_t> constOpIndices;
+    for (const auto& candidate : candidates) {
+        if (constOpIndices.try_emplace(candidate.constOp, constOps.size()).second) {
+            constOps.push_back(candidate.constOp);
+        }
+    }
 
-    mlir::RewritePatternSet patterns(&ctx);
-    patterns.add<NNDMAOpConverter>(&ctx, algo, arch, _log);
+    SmallVector<ICodec::CompressionMode> compressionModes(constOps.size());
+    SmallVector<mlir::FailureOr<std::vector<uint8_t>>> compressedData(constOps.size(), mlir::failure());
+    loop_1d(LoopExecPolicy::Parallel, &ctx, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
+        compressionModes[ind] = getCompressionMode(*codec, constOps[ind]);
+        compressedData[ind] = compressDataFromDeclareOp(*codec, constOps[ind], compressionModes[ind], _log);
+    });
+
+    mlir::IRRewriter rewriter(&ctx);
+    for (const auto& candidate : candidates) {
+        const auto ind = constOpIndices[candidate.constOp];
+        if (mlir::failed(compressedData[ind])) {
+            continue;
+        }
+        replaceWithDecompressDMA(rewriter, candidate, compressionModes[ind], compressedData[ind].value(), _log);
+    }
 
-    if (mlir::failed(applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
-        signalPassFailure();
+    for (auto constOp : constOps) {
+        if (constOp->use_empty()) {
+            rewriter.eraseOp(constOp);
+        }
     }
 }
 
@@ -221,12 +221,12 @@ void mergeBarriers(BarrierInfo& barrierInfo, ArrayRef<BarrierInfo::TaskSet> orig
 
         // For each barrier get the largest producer index
         for (auto barrierInd : blockUpdateBarriers) {
-            const auto producers = barrierInfo.getBarrierProducers(barrierInd);
+            const auto& producers = barrierInfo.getBarrierProducers(barrierInd);
             std::optional<size_t> maxProducer;
             if (producers.empty()) {
                 numOfBarriersWithNoProducers++;
             } else {
-                maxProducer = *std::max_element(producers.begin(), producers.end());
+                maxProducer = producers.back();
             }
 
             barIndAndMaxProdVec.push_back(std::make_pair(barrierInd, maxProducer));
@@ -243,10 +243,7 @@ void mergeBarriers(BarrierInfo& barrierInfo, ArrayRef<BarrierInfo::TaskSet> orig
 
         const auto allProducersAfterConsumers = [](const BarrierInfo::TaskSet& producers,
                                                    const BarrierInfo::TaskSet& consumers) {
-            const auto maxConsumer = *std::max_element(consumers.begin(), consumers.end());
-            const auto minProducer = *std::min_element(producers.begin(), producers.end());
-
-            return minProducer > maxConsumer;
+            return producers.front() > consumers.back();
         };
 
         // Merge barriers if possible.
@@ -290,8 +287,8 @@ void mergeBarriers(BarrierInfo& barrierInfo, ArrayRef<BarrierInfo::TaskSet> orig
                 barrierInfo.addProducers(barrierInd, barrierProducersB);
                 barrierInfo.addConsumers(barrierInd, barrierConsumersB);
                 barrierInfo.resetBarrier(nextBarrierInd);
-                llvm::set_union(barrierProducersA, barrierProducersB);
-                llvm::set_union(barrierConsumersA, barrierConsumersB);
+                barrierProducersA.merge(barrierProducersB);
+                barrierConsumersA.merge(barrierConsumersB);
             }
         }
     }
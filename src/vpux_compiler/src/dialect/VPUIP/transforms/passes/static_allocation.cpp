@@ -166,7 +166,8 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::func::FuncOp funcOp)
 
     // An empty reserved memory container means that we can use the default scan result for the current function
     // In single-function mode (general approach), the result is cached by calculating the ReservedMemInfo analysis
-    if (reservedMem.empty()) {
+    // The cached result doesn't use the offline placement, so it's recalculated if the placement is enabled
+    if (reservedMem.empty() && !enableOfflinePlacement) {
         // There is no need to call getCachedAnalysis since a cached allocation analysis will be received, if any
         // It is safe to keep references to the resulting objects because the analysis is cached
         auto& allocationInfo = getAnalysis<AllocationInfo>();
@@ -195,8 +196,8 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::func::FuncOp funcOp)
         // A cached deps analysis will be received, if any
         auto& liveRangeInfo = getMemLiveRangeInfoMemType(_memKind);
         // Run a linear scan, giving that a certain amount of memory is reserved
-        std::tie(scanHandler, scheduledOpsResources) =
-                vpux::runLinearScan(funcOp, liveRangeInfo, depsInfo, _memKind, _log, reservedMem);
+        std::tie(scanHandler, scheduledOpsResources) = vpux::runLinearScan(funcOp, liveRangeInfo, depsInfo, _memKind,
+                                                                           _log, reservedMem, enableOfflinePlacement);
     }
 
     ControlEdgeSet controlEdges;
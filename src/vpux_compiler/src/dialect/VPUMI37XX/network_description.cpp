@@ -5,8 +5,6 @@
 
 #include <openvino/core/partial_shape.hpp>
 
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include <vpux_headers/serial_metadata.hpp>
 
 #include "vpux/compiler/dialect/VPUMI37XX/network_description.hpp"
@@ -16,10 +14,13 @@
 
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/IE/prefix.hpp"
+#include "vpux/utils/core/elf_section_lookup.hpp"
 #include "vpux/utils/core/enums.hpp"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/range.hpp"
 
+#include <llvm/Support/MemoryBuffer.h>
+
 #include <algorithm>
 
 using namespace vpux;
@@ -261,30 +262,21 @@ void deserializeIONodes(elf::OVNode* OVNode, uint32_t count, IONodeDescriptorMap
 
 }  // namespace
 
-NetworkMetadata vpux::VPUMI37XX::getNetworkMetadata(const std::vector<uint8_t>& blob) {
+NetworkMetadata vpux::VPUMI37XX::getNetworkMetadata(ArrayRef<uint8_t> blob) {
     NetworkMetadata network;
 
     OV_ITT_TASK_CHAIN(NETWORK_DESCRIPTION, itt::domains::VPUXPlugin, "NetworkDescription::NetworkDescription",
-                      "elfReader");
+                      "getSection&getHeader");
     VPUX_THROW_UNLESS(!blob.empty(), "Got NULL pointer");
 
-    auto accessor = elf::ElfDDRAccessManager(blob.data(), blob.size());
-    elf::Reader<elf::ELF_Bitness::Elf64> reader(&accessor);
-
-    std::shared_ptr<elf::NetworkMetadata> metadata;
-
-    OV_ITT_TASK_NEXT(NETWORK_DESCRIPTION, "getSection&getHeader");
-    for (size_t secIndex = 0; secIndex < reader.getSectionsNum(); secIndex++) {
-        const auto& section = reader.getSection(secIndex);
+    // Only the section header table is scanned, the content of the other sections (weights) is never accessed
+    const auto metadataSection = findElfSectionByType(
+            blob, static_cast<uint32_t>(vpux::ELFNPU37XX::SectionTypeAttr::VPU_SHT_NETDESC));
+    VPUX_THROW_UNLESS(metadataSection.has_value(), "METADATA NOT FOUND IN ELF");
 
-        const auto secHeader = section.getHeader();
-        if (secHeader->sh_type == static_cast<elf::Elf_Word>(vpux::ELFNPU37XX::SectionTypeAttr::VPU_SHT_NETDESC)) {
-            metadata = elf::MetadataSerialization::deserialize(section.getData<uint8_t>(), secHeader->sh_size);
-            break;
-        }
-    }
-
-    VPUX_THROW_UNLESS(metadata != nullptr, "METADATA NOT FOUND IN ELF");
+    OV_ITT_TASK_NEXT(NETWORK_DESCRIPTION, "deserializeMetadata");
+    const auto metadata = elf::MetadataSerialization::deserialize(metadataSection->data(), metadataSection->size());
+    VPUX_THROW_UNLESS(metadata != nullptr, "Failed to deserialize ELF metadata");
     network.name = metadata->mIdentification.blob_name;
 
     OV_ITT_TASK_NEXT(NETWORK_DESCRIPTION, "deserializeIONodes");
@@ -315,3 +307,14 @@ NetworkMetadata vpux::VPUMI37XX::getNetworkMetadata(const std::vector<uint8_t>&
 
     return network;
 }
+
+NetworkMetadata vpux::VPUMI37XX::getNetworkMetadataFromFile(StringRef blobPath) {
+    // The file is memory-mapped rather than read, so only the pages of the ELF headers and the metadata are loaded
+    auto blobBuffer = llvm::MemoryBuffer::getFile(blobPath, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    VPUX_THROW_UNLESS(blobBuffer, "Failed to open compiled network '{0}': {1}", blobPath,
+                      blobBuffer.getError().message());
+
+    const auto& buffer = blobBuffer.get();
+    return getNetworkMetadata(
+            ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(buffer->getBufferStart()), buffer->getBufferSize()));
+}
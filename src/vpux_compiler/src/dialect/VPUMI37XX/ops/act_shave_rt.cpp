@@ -7,8 +7,6 @@
 #include <mlir/IR/BuiltinTypes.h>
 #include <fstream>
 #include <vector>
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
 #include "vpux/compiler/dialect/ELFNPU37XX/utils.hpp"
 #include "vpux/compiler/dialect/VPUMI37XX/ops.hpp"
@@ -28,9 +26,9 @@ void vpux::VPUMI37XX::ActShaveRtOp::serialize(elf::writer::BinaryDataSection<uin
 
     const auto elfBlob = kernelInfo.getElf(kernel, arch);
 
-    auto secDataSizePair = vpux::ELFNPU37XX::getDataAndSizeOfElfSection(elfBlob, {".text"});
+    const auto text = kernelInfo.getKernelInfo(elfBlob).getSection({".text"});
 
-    binDataSection.appendData(secDataSizePair.first, secDataSizePair.second);
+    binDataSection.appendData(text.data(), text.size());
 }
 
 size_t vpux::VPUMI37XX::ActShaveRtOp::getBinarySize() {
@@ -41,9 +39,7 @@ size_t vpux::VPUMI37XX::ActShaveRtOp::getBinarySize() {
 
     const auto elfBlob = kernelInfo.getElf(kernel, arch);
 
-    auto secDataSizePair = vpux::ELFNPU37XX::getDataAndSizeOfElfSection(elfBlob, {".text"});
-
-    return secDataSizePair.second;
+    return kernelInfo.getKernelInfo(elfBlob).getSection({".text"}).size();
 }
 
 uint32_t vpux::VPUMI37XX::ActShaveRtOp::getKernelEntry() {
@@ -54,11 +50,7 @@ uint32_t vpux::VPUMI37XX::ActShaveRtOp::getKernelEntry() {
 
     const auto elfBlob = kernelInfo.getElf(kernel, arch);
 
-    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
-    auto elf_reader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
-
-    auto actKernelHeader = elf_reader.getHeader();
-    return actKernelHeader->e_entry;
+    return kernelInfo.getKernelInfo(elfBlob).entryPoint;
 }
 
 uint32_t vpux::VPUMI37XX::ActShaveRtOp::getVersion() {
@@ -69,9 +61,9 @@ uint32_t vpux::VPUMI37XX::ActShaveRtOp::getVersion() {
 
     const auto elfBlob = kernelInfo.getElf(kernel, arch);
 
-    auto secDataSizePair = vpux::ELFNPU37XX::getDataAndSizeOfElfSection(elfBlob, {".versiondata"});
+    const auto versionData = kernelInfo.getKernelInfo(elfBlob).getSection({".versiondata"});
 
-    auto nnActEntryRtVersion = reinterpret_cast<const uint32_t*>(secDataSizePair.first);
+    auto nnActEntryRtVersion = reinterpret_cast<const uint32_t*>(versionData.data());
 
     return *nnActEntryRtVersion;
 }
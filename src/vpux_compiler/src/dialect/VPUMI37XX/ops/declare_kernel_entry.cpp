@@ -7,8 +7,6 @@
 #include <mlir/IR/BuiltinTypes.h>
 #include <fstream>
 #include <vector>
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
 #include "vpux/compiler/dialect/ELFNPU37XX/utils.hpp"
 #include "vpux/compiler/dialect/VPUMI37XX/ops.hpp"
@@ -26,9 +24,5 @@ uint32_t vpux::VPUMI37XX::DeclareKernelEntryOp::getKernelEntry() {
     const auto& kernelInfo = ShaveBinaryResources::getInstance();
     const auto elfBlob = kernelInfo.getElf(kernel);
 
-    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
-    auto elf_reader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
-
-    auto actKernelHeader = elf_reader.getHeader();
-    return actKernelHeader->e_entry;
+    return kernelInfo.getKernelInfo(elfBlob).entryPoint;
 }
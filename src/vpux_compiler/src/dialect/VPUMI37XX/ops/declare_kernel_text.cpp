@@ -7,7 +7,6 @@
 #include <mlir/IR/BuiltinTypes.h>
 #include <fstream>
 #include <vector>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
 #include "vpux/compiler/dialect/ELFNPU37XX/utils.hpp"
 #include "vpux/compiler/dialect/VPUMI37XX/ops.hpp"
@@ -25,9 +24,9 @@ void vpux::VPUMI37XX::DeclareKernelTextOp::serialize(elf::writer::BinaryDataSect
     const auto& kernelInfo = ShaveBinaryResources::getInstance();
     const auto elfBlob = kernelInfo.getElf(kernel);
 
-    auto secDataSizePair = vpux::ELFNPU37XX::getDataAndSizeOfElfSection(elfBlob, {".text"});
+    const auto section = kernelInfo.getKernelInfo(elfBlob).getSection({".text"});
 
-    binDataSection.appendData(secDataSizePair.first, secDataSizePair.second);
+    binDataSection.appendData(section.data(), section.size());
 }
 
 size_t vpux::VPUMI37XX::DeclareKernelTextOp::getBinarySize() {
@@ -36,9 +35,7 @@ size_t vpux::VPUMI37XX::DeclareKernelTextOp::getBinarySize() {
     const auto& kernelInfo = ShaveBinaryResources::getInstance();
     const auto elfBlob = kernelInfo.getElf(kernel);
 
-    auto secDataSizePair = vpux::ELFNPU37XX::getDataAndSizeOfElfSection(elfBlob, {".text"});
-
-    return secDataSizePair.second;
+    return kernelInfo.getKernelInfo(elfBlob).getSection({".text"}).size();
 }
 
 // The .text sections for the sw layers must be 1kB aligned as an ActShave requirement
@@ -23,7 +23,7 @@ public:
 
 private:
     void safeRunOnFunc() final;
-    bool linearizeTasks(std::set<size_t>& linearizationTasks, BarrierInfo& barrierInfo);
+    bool linearizeTasks(const BarrierInfo::TaskSet& linearizationTasks, BarrierInfo& barrierInfo);
     void linearizeBarriers(mlir::DenseSet<VPURT::DeclareVirtualBarrierOp>& barrierOps, BarrierInfo& barrierInfo);
 
     // When linearizing tasks barriers are being inserted to represent new control flow. During
@@ -68,7 +68,7 @@ bool useSameBarriers(size_t taskA, size_t taskB, BarrierInfo& barrierInfo) {
                                       |
                                    TaskOpM
 */
-bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& linearizationTasks,
+bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(const BarrierInfo::TaskSet& linearizationTasks,
                                                             BarrierInfo& barrierInfo) {
     _log.trace("Linearizing tasks");
 
@@ -78,7 +78,7 @@ bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& li
     }
 
     // account for parallel tasks with same wait & update barrier(s) which do not produce new barriers
-    const auto findEndItr = [&](std::set<size_t>::iterator currItr) {
+    const auto findEndItr = [&](BarrierInfo::TaskSet::iterator currItr) {
         auto slotCount = barrierInfo.getNumOfSlotsUsed(barrierInfo.getTaskOpAtIndex(*currItr));
         auto endItr = currItr;
         ++endItr;
@@ -100,7 +100,7 @@ bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& li
     mlir::OpBuilder builder(earliestConsumer);
     builder.setInsertionPoint(earliestConsumer);
 
-    auto getBlockIndexesForTasksBatch = [&](std::set<size_t>& linearizationTasks) {
+    auto getBlockIndexesForTasksBatch = [&](const BarrierInfo::TaskSet& linearizationTasks) {
         std::unordered_map<size_t, size_t> blockIndexes;
         for (auto task : linearizationTasks) {
             blockIndexes[task] = barrierInfo.getControlGraphBlockIndex(task);
@@ -158,20 +158,29 @@ bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& li
         _log.trace("Created new barrier '{0}'", newBarrier);
         barrierInfo.addNewBarrier(newBarrier);
 
+        BarrierInfo::TaskSet newProducers;
         while (currTask != producersEnd) {
             _log.nest().trace("Add producer '{0}' to new barrier", *currTask);
             barrierInfo.addProducer(newBarrier, *currTask);
+            newProducers.insert(*currTask);
             ++currTask;
         }
         _log.trace("Producer slots number - {0}", barrierInfo.getProducerSlotCount(newBarrier));
 
+        BarrierInfo::TaskSet newConsumers;
         while (nextTask != consumersEnd) {
             _log.nest().trace("Add consumer '{0}' to new barrier", *nextTask);
             barrierInfo.addConsumer(newBarrier, *nextTask);
+            newConsumers.insert(*nextTask);
             ++nextTask;
         }
         _log.trace("Consumer slots number - {0}", barrierInfo.getConsumerSlotCount(newBarrier));
 
+        if (_checkDependencyWhenLinearizing) {
+            // keep the control map up to date for the next checks instead of building it again
+            barrierInfo.updateTaskControlMap(_taskControlMap, _controlMapOffset, newProducers, newConsumers);
+        }
+
         linearized = true;
     }
 
@@ -191,15 +200,15 @@ void ReduceExceedingActiveCountBarriersPass::linearizeBarriers(
     _log.trace("Linearizing barriers");
 
     // store barrier producers and consumers to linearize
-    std::set<size_t> tasksToLinearize;
+    BarrierInfo::TaskSet tasksToLinearize;
     for (const auto& barrierOp : barrierOps) {
         _log.nest().trace("Barrier '{0}'", barrierOp);
 
         const auto& barrierProducers = barrierInfo.getBarrierProducers(barrierOp);
-        tasksToLinearize.insert(barrierProducers.begin(), barrierProducers.end());
+        tasksToLinearize.merge(barrierProducers);
 
         const auto& barrierConsumers = barrierInfo.getBarrierConsumers(barrierOp);
-        tasksToLinearize.insert(barrierConsumers.begin(), barrierConsumers.end());
+        tasksToLinearize.merge(barrierConsumers);
     }
 
     // TODO: try to efficiently linearize producers or consumers only
@@ -35,14 +35,14 @@ void resolveOutOfOrderDependencies(const std::map<VPURT::TaskQueueType, SmallVec
         // operate per queue
         const auto& dmaQueue = entry.second;
 
-        std::set<size_t> nextUpdateBarriers;
+        BarrierInfo::TaskSet nextUpdateBarriers;
         for (const auto& task : dmaQueue | reversed) {
             const auto& updateBarriers = barrierInfo.getUpdateBarriers(task);
             if (updateBarriers.empty()) {
                 continue;
             }
             if (!barrierInfo.getWaitBarriers(task).empty()) {
-                nextUpdateBarriers.insert(updateBarriers.begin(), updateBarriers.end());
+                nextUpdateBarriers.merge(updateBarriers);
                 continue;
             }
 
@@ -56,7 +56,7 @@ void resolveOutOfOrderDependencies(const std::map<VPURT::TaskQueueType, SmallVec
                 barrierInfo.addProducer(barrierInfo.getBarrierOpAtIndex(nextUpdate), task);
             }
 
-            nextUpdateBarriers.insert(updateBarriers.begin(), updateBarriers.end());
+            nextUpdateBarriers.merge(updateBarriers);
         }
     }
 
@@ -77,7 +77,7 @@ void linkTasksToBarriers(const BarrierInfo::TaskSet& tasksToAdd, const BarrierIn
             barrierTasks = barrierInfo.getBarrierProducers(barrierIdn);
         }
 
-        llvm::set_union(barrierTasks, tasksToAdd);
+        barrierTasks.merge(tasksToAdd);
         auto batches = barrierInfo.createLegalVariantBatches(barrierTasks, legalVariantCount);
         if (batches.size() > 1) {
             auto insertionPoint = barrierInfo.getBarrierOpAtIndex(barrierIdn);
@@ -303,8 +303,7 @@ void reduceParallelControlFlowsForQueue(VPURT::TaskConfigVec& ops, std::map<size
             if (VPURT::getMaxEntry(nextWaitBarriers) > minUpdateBarrier) {
                 break;
             }
-            llvm::set_union(intermediateBarriers,
-                            findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, nextWaitBarriers));
+            intermediateBarriers.merge(findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, nextWaitBarriers));
             ++nextTask;
         }
 
@@ -350,8 +349,8 @@ void reduceParallelControlFlowsForQueue(VPURT::TaskConfigVec& ops, std::map<size
             if (VPURT::getMinEntry(prevUpdateBarriers) < maxWaitBarrier) {
                 break;
             }
-            llvm::set_union(intermediateBarriers,
-                            findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, prevUpdateBarriers));
+            intermediateBarriers.merge(
+                    findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, prevUpdateBarriers));
         } while (prevTask != ops.begin());
 
         BarrierInfo::TaskSet newWaitBarriers;
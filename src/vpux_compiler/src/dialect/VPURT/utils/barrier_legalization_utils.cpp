@@ -12,14 +12,14 @@ size_t VPURT::getMinEntry(const BarrierInfo::TaskSet& entries) {
     if (entries.empty()) {
         return std::numeric_limits<size_t>::min();
     }
-    return *std::min_element(entries.begin(), entries.end());
+    return entries.front();
 }
 
 size_t VPURT::getMaxEntry(const BarrierInfo::TaskSet& entries) {
     if (entries.empty()) {
         return std::numeric_limits<size_t>::max();
     }
-    return *std::max_element(entries.begin(), entries.end());
+    return entries.back();
 }
 
 // generate FIFOs of Task Ops using index from BarrierInfo
@@ -8,6 +8,8 @@
 
 #include "vpux/compiler/dialect/const/ops.hpp"
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
+#include "vpux/compiler/dialect/const/utils/sub_byte.hpp"
+#include "vpux/compiler/dialect/const/utils/transformations.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
 #include "vpux/utils/core/format.hpp"
@@ -107,7 +109,8 @@ mlir::LogicalResult vpux::Const::ContentAttr::verify(FuncRef<mlir::InFlightDiagn
         // Note: manual checks required since dense resource blob is opaque and does not perform much validation itself
         const auto bytes = denseResource.getRawHandle().getBlob()->getData();
         bool ignored = false;
-        if (!mlir::DenseElementsAttr::isValidRawBuffer(baseContent.getShapedType(), bytes, ignored)) {
+        if (!mlir::DenseElementsAttr::isValidRawBuffer(baseContent.getShapedType(), bytes, ignored) &&
+            !Const::isPackedSubByteBuffer(baseContent.getShapedType(), bytes)) {
             return printTo(emitError(),
                            "Size of dense resource buffer '{0}' in 'baseContent' doesn't match its type '{1}'",
                            bytes.size(), denseResource.getShapedType());
@@ -178,8 +181,13 @@ std::pair<mlir::ArrayRef<char>, bool> getRawDataAndSplatness(mlir::ElementsAttr
     }
 
     auto denseResource = mlir::cast<mlir::DenseResourceElementsAttr>(baseContent);
+    const auto data = denseResource.getRawHandle().getBlob()->getData();
+    // packed sub-byte elements are not checked for splat, the same way as the unpacked copies of OV constants
+    if (Const::isPackedSubByteBuffer(baseContent.getShapedType(), data)) {
+        return {data, false};
+    }
     // dense resource doesn't support splat detection in MLIR itself
-    return detectSplatManually(baseContent.getShapedType(), denseResource.getRawHandle().getBlob()->getData());
+    return detectSplatManually(baseContent.getShapedType(), data);
 }
 
 //
@@ -192,8 +200,20 @@ Const::Content wrapBaseContent(mlir::ElementsAttr baseContent) {
 
     std::tie(data, isSplat) = getRawDataAndSplatness(baseContent);
 
-    return Const::Content::fromRawBuffer(baseContent.getShapedType().cast<vpux::NDTypeInterface>(), data,
-                                         baseContent.getShapedType().getElementType(), isSplat);
+    const auto type = baseContent.getShapedType();
+    if (Const::isPackedSubByteBuffer(type, data)) {
+        // Shared sub-byte constants are kept packed in the IR and unpacked into one element per byte only when they
+        // are folded, which matches the storage of the copied constants
+        const auto elemType = type.getElementType();
+        const auto storageElemType =
+                elemType.isSignedInteger() ? getSInt8Type(type.getContext()) : getUInt8Type(type.getContext());
+        auto content = Const::Content::allocTempBuffer(type.cast<vpux::NDTypeInterface>(), storageElemType,
+                                                       /*isSplat=*/false);
+        Const::unpackSubByteBuffer(data.data(), elemType.getIntOrFloatBitWidth(), content.getRawTempBuf());
+        return content;
+    }
+
+    return Const::Content::fromRawBuffer(type.cast<vpux::NDTypeInterface>(), data, type.getElementType(), isSplat);
 }
 
 bool canAddQuantCast(Const::TransformAttrInterface* begin, Const::TransformAttrInterface* insertPos) {
@@ -226,6 +246,12 @@ Const::Content vpux::Const::ContentAttr::fold(bool bypassCache) const {
         if (cacheManager.contains(ctx)) {
             auto& cache = cacheManager.get(ctx);
             auto content = cache.getContent(*this);
+            if (!content.has_value()) {
+                // The request may still be waiting in the background queue, fold it with priority instead of
+                // repeating the work here
+                cache.promoteRequest(*this);
+                content = cache.getContent(*this);
+            }
             if (content.has_value()) {
                 return content.value();
             }
@@ -237,7 +263,17 @@ Const::Content vpux::Const::ContentAttr::fold(bool bypassCache) const {
 
     auto res = wrapBaseContent(baseContent);
 
-    for (const auto& attr : getTransformations()) {
+    const auto transformations = getTransformations();
+    for (size_t ind = 0; ind < transformations.size();) {
+        const auto numFused = Const::details::applyFusedTransformations(res, transformations.drop_front(ind));
+        if (numFused != 0) {
+            Const::logger().trace("Applied {0} fused transformations starting from: {1}", numFused,
+                                  transformations[ind]);
+            ind += numFused;
+            continue;
+        }
+
+        const auto& attr = transformations[ind++];
         const auto storageElemTypeSize = vpux::getElemTypeSize(res.getStorageElemType()).count();
         VPUX_THROW_WHEN(storageElemTypeSize < CHAR_BIT && !attr.supportsSubByteStorageType(),
                         "Unsupported storage type of size '{0}' bits.", storageElemTypeSize);
@@ -13,6 +13,8 @@
 
 #include <mlir/IR/DialectImplementation.h>
 
+#include <vector>
+
 using namespace vpux;
 
 //
@@ -109,16 +111,33 @@ template <class StorageType>
 Const::Content transformImpl(mlir::quant::QuantizedType qElemType, mlir::Type outType, mlir::MLIRContext* ctx,
                              vpux::Const::Content& input) {
     auto output = allocateTempBuffer(qElemType, outType, input.isSplat());
-    const auto realVals = input.getValues<float>();
+    const auto realValsRange = input.getValues<float>();
     auto qVals = output.getTempBuf<StorageType>();
 
+    // Non-splat values are converted to float in bulk, FP32 storage is used as is without any copy
+    const auto isSplat = input.isSplat();
+    std::vector<float> convertedVals;
+    ArrayRef<float> realValsBuf;
+    if (!isSplat) {
+        if (input.getStorageElemType().isF32()) {
+            realValsBuf = input.getStorageBuf<float>().take_front(realValsRange.size());
+        } else {
+            convertedVals.resize(realValsRange.size());
+            input.copyValuesTo(MutableArrayRef<float>(convertedVals));
+            realValsBuf = convertedVals;
+        }
+    }
+    const auto getRealVal = [&](size_t idx) -> float {
+        return isSplat ? realValsRange[idx] : realValsBuf[idx];
+    };
+
     if (const auto uniformType = qElemType.dyn_cast<mlir::quant::UniformQuantizedType>()) {
         const auto scale = uniformType.getScale();
         const auto zeroPoint = uniformType.getZeroPoint();
         const auto quantizer = createQuantizeFn(scale, zeroPoint, qElemType);
 
-        for (size_t i = 0; i < realVals.size(); ++i) {
-            qVals[i] = static_cast<StorageType>(quantizer(realVals[i]));
+        for (size_t i = 0; i < realValsRange.size(); ++i) {
+            qVals[i] = static_cast<StorageType>(quantizer(getRealVal(i)));
         }
     } else if (const auto uniformType = qElemType.dyn_cast<mlir::quant::UniformQuantizedPerAxisType>()) {
         const auto scales = uniformType.getScales();
@@ -166,7 +185,7 @@ Const::Content transformImpl(mlir::quant::QuantizedType qElemType, mlir::Type ou
                 [&](int64_t outerInd, int64_t quantAxisInd, int64_t innerInd) {
                     const auto quantizer = quantizers[quantAxisInd];
                     const auto idx = outerInd * quantAxisTotalSize + quantAxisInd * innerSize + innerInd;
-                    qVals[idx] = static_cast<StorageType>(quantizer(realVals[idx]));
+                    qVals[idx] = static_cast<StorageType>(quantizer(getRealVal(idx)));
                 });
     } else {
         VPUX_THROW("Unsupported Quantized Type '{0}'", qElemType);
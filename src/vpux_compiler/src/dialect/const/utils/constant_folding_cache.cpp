@@ -8,8 +8,68 @@
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
 #include "vpux/utils/core/disable_warning.hpp"
 
+#include <llvm/Support/Error.h>
+
+#include <algorithm>
+#include <shared_mutex>
+#include <vector>
+
 using namespace vpux;
 
+namespace {
+
+size_t getCachedSize(Const::ContentAttr attr) {
+    return checked_cast<size_t>(attr.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count());
+}
+
+// Folding the content again requires reading the base content and applying each transformation
+size_t getNumFoldingSteps(Const::ContentAttr attr) {
+    return attr.getTransformations().size() + 1;
+}
+
+// The entries with the lowest score are evicted first. The score grows with the number of folding steps needed to
+// recompute the entry and decreases with the number of cache accesses since its last use and with its size, as
+// evicting a larger entry frees more memory
+double getRetentionScore(size_t numFoldingSteps, size_t size, uint64_t lastAccess, uint64_t currentAccess) {
+    const auto age = currentAccess > lastAccess ? currentAccess - lastAccess : 0;
+    return static_cast<double>(numFoldingSteps) / static_cast<double>(age + 1) /
+           static_cast<double>(std::max<size_t>(size, 1));
+}
+
+std::optional<llvm::compression::Format> getCompressionFormat() {
+    static const auto format = []() -> std::optional<llvm::compression::Format> {
+        for (auto candidate : {llvm::compression::Format::Zstd, llvm::compression::Format::Zlib}) {
+            if (llvm::compression::getReasonIfUnsupported(candidate) == nullptr) {
+                return candidate;
+            }
+        }
+        return std::nullopt;
+    }();
+    return format;
+}
+
+// The traversal of the concurrent hash map is not safe with concurrent insertions and erasures, so the mutex is taken
+// exclusively here, while the modifications of the maps share it
+template <typename Map>
+std::vector<std::pair<Const::ContentAttr, double>> getEvictionOrder(const Map& map, std::shared_mutex& mutex,
+                                                                    uint64_t currentAccess) {
+    std::vector<std::pair<Const::ContentAttr, double>> entries;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        entries.reserve(map.size());
+        for (const auto& [attr, entry] : map) {
+            entries.emplace_back(attr, getRetentionScore(entry.numFoldingSteps, getCachedSize(attr), entry.lastAccess,
+                                                         currentAccess));
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.second < b.second;
+    });
+    return entries;
+}
+
+}  // namespace
+
 //
 // ConstantFoldingCache
 //
@@ -30,10 +90,22 @@ Const::FoldingRequest Const::ConstantFoldingCache::getRequest() {
     return result;
 }
 
+uint64_t Const::ConstantFoldingCache::nextAccess() {
+    return ++_accessCounter;
+}
+
 bool Const::ConstantFoldingCache::hasContent(Const::ContentAttr attr) {
-    Const::details::ContentMap::accessor accessor;
-    if (_cache.find(accessor, attr) && !accessor.empty()) {
-        accessor->second.refCount++;
+    {
+        Const::details::ContentMap::accessor accessor;
+        if (_cache.find(accessor, attr) && !accessor.empty()) {
+            accessor->second.lastAccess = nextAccess();
+            return true;
+        }
+    }
+
+    Const::details::CompressedContentMap::accessor accessor;
+    if (_compressedCache.find(accessor, attr) && !accessor.empty()) {
+        accessor->second.lastAccess = nextAccess();
         return true;
     }
     return false;
@@ -51,39 +123,171 @@ bool Const::ConstantFoldingCache::isMemoryLimitReached() const {
     return _memoryUsedCache >= _memoryUsageLimit;
 }
 
+void Const::ConstantFoldingCache::setCompressedMemoryUsageLimit(vpux::Byte memoryUsageLimit) {
+    _compressedMemoryUsageLimit = memoryUsageLimit.count();
+}
+
 void Const::ConstantFoldingCache::cleanUpCache() {
-    std::vector<std::pair<Const::ContentAttr, int>> contents;
-    {
-        std::lock_guard<std::mutex> lock(_mutex);
-        contents.reserve(_cache.size());
-        for (const auto& [attr, cachedContent] : _cache) {
-            contents.emplace_back(attr, cachedContent.refCount);
+    std::unique_lock<std::mutex> cleanUpLock(_cleanUpMutex, std::try_to_lock);
+    if (!cleanUpLock.owns_lock()) {
+        return;
+    }
+
+    const auto contents = getEvictionOrder(_cache, _mutex, _accessCounter.load());
+    for (const auto& entry : contents) {
+        compressContent(entry.first);
+        if (_memoryUsedCache <= _memoryUsageLimit * _cacheCleanThreshold) {
+            break;
         }
     }
-    std::sort(contents.begin(), contents.end(), [](const auto& a, const auto& b) {
-        return a.second < b.second;
+
+    if (_memoryUsedCompressedCache > _compressedMemoryUsageLimit) {
+        cleanUpCompressedCache();
+    }
+}
+
+void Const::ConstantFoldingCache::scheduleCleanUp() {
+    if (!_backgroundTaskHandler) {
+        cleanUpCache();
+        return;
+    }
+
+    // A single clean-up task is enough, it runs until the memory usage drops below the threshold
+    if (_isCleanUpScheduled.exchange(true)) {
+        return;
+    }
+    _backgroundTaskHandler([this]() {
+        _isCleanUpScheduled = false;
+        cleanUpCache();
     });
+}
 
+void Const::ConstantFoldingCache::cleanUpCompressedCache() {
+    const auto contents = getEvictionOrder(_compressedCache, _mutex, _accessCounter.load());
     for (const auto& entry : contents) {
-        removeContent(entry.first);
-        if (_memoryUsedCache <= _memoryUsageLimit * _cacheCleanThreshold) {
+        std::shared_lock<std::shared_mutex> mapLock(_mutex);
+        Const::details::CompressedContentMap::accessor accessor;
+        if (_compressedCache.find(accessor, entry.first) && !accessor.empty()) {
+            _memoryUsedCompressedCache -= accessor->second.data.size();
+            _compressedCache.erase(accessor);
+        }
+        if (_memoryUsedCompressedCache <= _compressedMemoryUsageLimit * _cacheCleanThreshold) {
             break;
         }
     }
 }
 
+void Const::ConstantFoldingCache::compressContent(Const::ContentAttr attr) {
+    Const::details::CompressedContent compressedContent;
+    Const::Content content;
+    {
+        std::shared_lock<std::shared_mutex> mapLock(_mutex);
+        Const::details::ContentMap::accessor accessor;
+        if (!_cache.find(accessor, attr) || accessor.empty()) {
+            return;
+        }
+        content = std::move(accessor->second.content);
+        compressedContent.numFoldingSteps = accessor->second.numFoldingSteps;
+        compressedContent.lastAccess = accessor->second.lastAccess;
+        _cache.erase(accessor);
+    }
+
+    _memoryUsedCache -= getCachedSize(attr);
+    if (_collectStatistics) {
+        _statistics.numElementsErasedFromCache++;
+    }
+
+    if (_compressedMemoryUsageLimit == 0) {
+        return;
+    }
+
+    const auto rawData = content.getRawStorageBuf();
+    const auto rawBytes = ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(rawData.data()), rawData.size());
+    compressedContent.type = content.getType();
+    compressedContent.storageElemType = content.getStorageElemType();
+    compressedContent.isSplat = content.isSplat();
+    compressedContent.rawSize = rawBytes.size();
+
+    const auto format = getCompressionFormat();
+    if (format.has_value() && !content.isSplat()) {
+        // Favor the speed, as the compression delays the clean-up of the main cache
+        const auto level = format.value() == llvm::compression::Format::Zstd
+                                   ? llvm::compression::zstd::BestSpeedCompression
+                                   : llvm::compression::zlib::BestSpeedCompression;
+        llvm::compression::compress(llvm::compression::Params(format.value(), level), rawBytes, compressedContent.data);
+        compressedContent.format = format;
+    }
+    if (!compressedContent.format.has_value() || compressedContent.data.size() >= rawBytes.size()) {
+        compressedContent.data.assign(rawBytes.begin(), rawBytes.end());
+        compressedContent.format = std::nullopt;
+    }
+
+    const auto compressedSize = compressedContent.data.size();
+    {
+        std::shared_lock<std::shared_mutex> mapLock(_mutex);
+        Const::details::CompressedContentMap::accessor accessor;
+        if (!_compressedCache.insert(accessor, attr)) {
+            _memoryUsedCompressedCache -= accessor->second.data.size();
+        }
+        accessor->second = std::move(compressedContent);
+    }
+    _memoryUsedCompressedCache += compressedSize;
+
+    if (_collectStatistics) {
+        _statistics.numElementsCompressed++;
+        _statistics.numBytesSavedByCompression += rawBytes.size() - compressedSize;
+        _statistics.updateMaxMemoryUsedCompressedCache(_memoryUsedCompressedCache.load());
+    }
+}
+
+std::optional<Const::Content> Const::ConstantFoldingCache::restoreCompressedContent(Const::ContentAttr attr) {
+    Const::details::CompressedContent compressedContent;
+    {
+        std::shared_lock<std::shared_mutex> mapLock(_mutex);
+        Const::details::CompressedContentMap::accessor accessor;
+        if (!_compressedCache.find(accessor, attr) || accessor.empty()) {
+            return std::nullopt;
+        }
+        compressedContent = std::move(accessor->second);
+        _compressedCache.erase(accessor);
+    }
+    _memoryUsedCompressedCache -= compressedContent.data.size();
+
+    auto content = Const::Content::allocTempBuffer(compressedContent.type, compressedContent.storageElemType,
+                                                   compressedContent.isSplat, compressedContent.rawSize);
+    auto rawBuffer = content.getRawTempBuf();
+    if (compressedContent.format.has_value()) {
+        auto error = llvm::compression::decompress(compressedContent.format.value(), compressedContent.data,
+                                                   reinterpret_cast<uint8_t*>(rawBuffer.data()), rawBuffer.size());
+        VPUX_THROW_WHEN(error, "Failed to decompress cached content: {0}", llvm::toString(std::move(error)));
+    } else {
+        std::copy_n(compressedContent.data.begin(), compressedContent.data.size(), rawBuffer.begin());
+    }
+
+    if (_collectStatistics) {
+        _statistics.numCompressedCacheHits++;
+        _statistics.numBytesRestoredFromCompressedCache += rawBuffer.size();
+    }
+
+    addContent(attr, content);
+    return content;
+}
+
 void Const::ConstantFoldingCache::addContent(Const::ContentAttr attr, const Const::Content& content) {
-    Const::details::ContentMap::accessor accessor;
-    _cache.insert(accessor, attr);
-    VPUX_THROW_WHEN(accessor.empty(), "Failed to add folding request to cache");
-    accessor->second.content = content;
-    accessor.release();
+    {
+        std::shared_lock<std::shared_mutex> mapLock(_mutex);
+        Const::details::ContentMap::accessor accessor;
+        _cache.insert(accessor, attr);
+        VPUX_THROW_WHEN(accessor.empty(), "Failed to add folding request to cache");
+        accessor->second.content = content;
+        accessor->second.numFoldingSteps = getNumFoldingSteps(attr);
+        accessor->second.lastAccess = nextAccess();
+    }
 
-    auto size = attr.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
-    _memoryUsedCache += size.count();
+    _memoryUsedCache += getCachedSize(attr);
 
     if (isMemoryLimitReached()) {
-        cleanUpCache();
+        scheduleCleanUp();
     }
 
     if (_collectStatistics) {
@@ -95,18 +299,24 @@ void Const::ConstantFoldingCache::addContent(Const::ContentAttr attr, const Cons
 }
 
 void Const::ConstantFoldingCache::removeContent(Const::ContentAttr attr) {
+    std::shared_lock<std::shared_mutex> mapLock(_mutex);
     Const::details::ContentMap::accessor accessor;
     if (_cache.find(accessor, attr) && !accessor.empty()) {
         _cache.erase(accessor);
         accessor.release();
 
-        auto size = attr.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
-        _memoryUsedCache -= size.count();
+        _memoryUsedCache -= getCachedSize(attr);
 
         if (_collectStatistics) {
             _statistics.numElementsErasedFromCache++;
         }
     }
+
+    Const::details::CompressedContentMap::accessor compressedAccessor;
+    if (_compressedCache.find(compressedAccessor, attr) && !compressedAccessor.empty()) {
+        _memoryUsedCompressedCache -= compressedAccessor->second.data.size();
+        _compressedCache.erase(compressedAccessor);
+    }
 }
 
 std::optional<Const::Content> Const::ConstantFoldingCache::getContent(Const::ContentAttr attr) {
@@ -116,9 +326,14 @@ std::optional<Const::Content> Const::ConstantFoldingCache::getContent(Const::Con
         if (_collectStatistics) {
             _statistics.numCacheHits++;
         }
-        accessor->second.refCount--;
+        accessor->second.lastAccess = nextAccess();
         return accessor->second.content;
     }
+    accessor.release();
+
+    if (auto content = restoreCompressedContent(attr)) {
+        return content;
+    }
 
     if (_collectStatistics) {
         _statistics.numCacheMisses++;
@@ -127,18 +342,47 @@ std::optional<Const::Content> Const::ConstantFoldingCache::getContent(Const::Con
 }
 
 bool Const::ConstantFoldingCache::replaceContentAttr(Const::ContentAttr originalAttr, Const::ContentAttr newAttr) {
+    std::shared_lock<std::shared_mutex> mapLock(_mutex);
     Const::details::ContentMap::accessor originalAttrAccessor;
     if (_cache.find(originalAttrAccessor, originalAttr) && !originalAttrAccessor.empty()) {
         Const::details::ContentMap::accessor newAttrAccessor;
         _cache.insert(newAttrAccessor, newAttr);
         VPUX_THROW_WHEN(newAttrAccessor.empty(), "Failed to add folding request to cache");
         newAttrAccessor->second.content = std::move(originalAttrAccessor->second.content);
+        newAttrAccessor->second.numFoldingSteps = getNumFoldingSteps(newAttr);
+        newAttrAccessor->second.lastAccess = nextAccess();
         _cache.erase(originalAttrAccessor);
         return true;
     }
+    originalAttrAccessor.release();
+
+    Const::details::CompressedContentMap::accessor originalCompressedAccessor;
+    if (_compressedCache.find(originalCompressedAccessor, originalAttr) && !originalCompressedAccessor.empty()) {
+        Const::details::CompressedContentMap::accessor newCompressedAccessor;
+        _compressedCache.insert(newCompressedAccessor, newAttr);
+        VPUX_THROW_WHEN(newCompressedAccessor.empty(), "Failed to add folding request to cache");
+        newCompressedAccessor->second = std::move(originalCompressedAccessor->second);
+        newCompressedAccessor->second.numFoldingSteps = getNumFoldingSteps(newAttr);
+        _compressedCache.erase(originalCompressedAccessor);
+        return true;
+    }
     return false;
 }
 
+void Const::ConstantFoldingCache::setPromoteHandler(std::function<void(Const::ContentAttr)> handler) {
+    _promoteHandler = std::move(handler);
+}
+
+void Const::ConstantFoldingCache::setBackgroundTaskHandler(std::function<void(std::function<void()>)> handler) {
+    _backgroundTaskHandler = std::move(handler);
+}
+
+void Const::ConstantFoldingCache::promoteRequest(Const::ContentAttr attr) {
+    if (_promoteHandler) {
+        _promoteHandler(attr);
+    }
+}
+
 void Const::ConstantFoldingCache::enableStatisticsCollection() {
     _collectStatistics = true;
 }
@@ -155,6 +399,10 @@ size_t Const::ConstantFoldingCache::getMemoryUsedCache() const {
     return _memoryUsedCache;
 }
 
+size_t Const::ConstantFoldingCache::getMemoryUsedCompressedCache() const {
+    return _memoryUsedCompressedCache;
+}
+
 Const::details::CacheStatistics& Const::ConstantFoldingCache::getStatistics() {
     return _statistics;
 }
@@ -178,6 +426,11 @@ void Const::details::CacheStatistics::updateMaxMemoryUsedCache(size_t newMemoryU
     _maxMemoryUsedCache = std::max(_maxMemoryUsedCache, newMemoryUsedCache);
 }
 
+void Const::details::CacheStatistics::updateMaxMemoryUsedCompressedCache(size_t newMemoryUsedCompressedCache) {
+    std::lock_guard<std::mutex> lock(_mtx);
+    _maxMemoryUsedCompressedCache = std::max(_maxMemoryUsedCompressedCache, newMemoryUsedCompressedCache);
+}
+
 size_t Const::details::CacheStatistics::getMaxNumRequestsInQueue() {
     std::lock_guard<std::mutex> lock(_mtx);
     return _maxNumRequestsInQueue;
@@ -193,6 +446,11 @@ size_t Const::details::CacheStatistics::getMaxMemoryUsedCache() {
     return _maxMemoryUsedCache;
 }
 
+size_t Const::details::CacheStatistics::getMaxMemoryUsedCompressedCache() {
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _maxMemoryUsedCompressedCache;
+}
+
 //
 // ConstantFoldingCacheManager
 //
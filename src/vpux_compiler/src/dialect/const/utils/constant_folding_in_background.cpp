@@ -8,13 +8,18 @@
 #include "vpux/compiler/dialect/const/utils/constant_folding_in_background.hpp"
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
 
+#include <llvm/Support/ThreadPool.h>
+
+#include <algorithm>
+#include <memory>
+
 using namespace vpux;
 using namespace vpux::Const;
 
 BackgroundConstantFolding::BackgroundConstantFolding(mlir::MLIRContext* ctx, size_t maxConcurrentTasks,
                                                      bool collectStatistics, size_t memoryUsageLimit,
                                                      double cacheCleanThreshold, Logger log)
-        : _ctx(ctx), _maxConcurrentTasks(maxConcurrentTasks), _log(log) {
+        : _ctx(ctx), _log(log) {
     if (!_ctx->isMultithreadingEnabled()) {
         _log.warning("Multi thread is disabled, background constant folding is disabled");
         _isEnabled = false;
@@ -34,12 +39,27 @@ BackgroundConstantFolding::BackgroundConstantFolding(mlir::MLIRContext* ctx, siz
     vpux::MB memoryUsageLimitMB(memoryUsageLimit);
     auto memoryUsageLimitBytes = memoryUsageLimitMB.to<vpux::Byte>();
     cacheManager.get(_ctx).setMemoryUsageLimit(memoryUsageLimitBytes);
+    cacheManager.get(_ctx).setCompressedMemoryUsageLimit(memoryUsageLimitBytes);
     cacheManager.get(_ctx).setCacheCleanThreshold(cacheCleanThreshold);
     if (collectStatistics) {
         cacheManager.get(_ctx).enableStatisticsCollection();
     }
 
-    _listenerThread = initFoldingListener(threadPool);
+    // The workers have the idle OS priority, so they can use as many cores as the main compilation does
+    _executor = std::make_unique<PriorityExecutor>(threadPool.getThreadCount(), std::max<size_t>(maxConcurrentTasks, 1),
+                                                   _log);
+
+    cacheManager.get(_ctx).setPromoteHandler([this](Const::ContentAttr attr) {
+        promoteRequest(attr);
+    });
+
+    // The clean-up compresses the evicted entries, so it is kept away from the compilation threads which add the
+    // restored content to the cache. It is queued before the pending folding requests to free the memory sooner
+    cacheManager.get(_ctx).setBackgroundTaskHandler([this](std::function<void()> task) {
+        _executor->submit(std::move(task), TaskPriority::Foreground);
+    });
+
+    _listenerThread = initFoldingListener();
 }
 
 BackgroundConstantFolding::~BackgroundConstantFolding() {
@@ -49,11 +69,6 @@ BackgroundConstantFolding::~BackgroundConstantFolding() {
 
     try {
         stopFoldingListener();
-
-        std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] {
-            return _activeTasks == 0;
-        });
     } catch (...) {
         _log.error("Exception caught in BackgroundConstantFolding destructor");
     }
@@ -101,70 +116,91 @@ bool tryFoldingPartially(vpux::Const::ConstantFoldingCache& cache, Const::Conten
     return true;
 }
 
-class TaskCompletionNotifier {
-public:
-    TaskCompletionNotifier(std::atomic<size_t>& activeTasks, std::condition_variable& cv)
-            : _activeTasks(&activeTasks), _cv(&cv) {
-    }
-
-    ~TaskCompletionNotifier() {
-        (*_activeTasks)--;
-        _cv->notify_one();
-    }
-
-private:
-    std::atomic<size_t>* const _activeTasks;
-    std::condition_variable* const _cv;
-};
-
 void BackgroundConstantFolding::processFoldingRequest(const FoldingRequest& foldingRequest,
                                                       ConstantFoldingCache& cache) {
-    // As the main compilation process also utilizes the pool concurrently, _maxConcurrentTasks is introduced to
-    // manually control the resources used by constant folding in background.
-    std::unique_lock<std::mutex> lock(_mutex);
-    _cv.wait(lock, [this] {
-        return _activeTasks < _maxConcurrentTasks;
-    });
+    Const::ContentAttr pendingAttr;
+    if (auto equivalenceRequest = mlir::dyn_cast_or_null<Const::EquivalenceRequestAttr>(foldingRequest.attr)) {
+        pendingAttr = equivalenceRequest.getNewAttr();
+    } else {
+        pendingAttr = mlir::dyn_cast_if_present<Const::ContentAttr>(foldingRequest.attr);
+    }
 
-    _activeTasks++;
-    _ctx->getThreadPool().async([this, foldingRequest, &cache]() {
-        TaskCompletionNotifier notifier(_activeTasks, _cv);
+    // The pending request is registered under the lock, so that the task cannot unregister itself before that.
+    // The id of the task is known only after the submission, it is passed to the task through the shared slot
+    auto taskIdSlot = std::make_shared<PriorityExecutor::TaskId>(0);
+    std::lock_guard<std::mutex> lock(_pendingRequestsMutex);
+    const auto taskId = _executor->submit(
+            [this, foldingRequest, pendingAttr, taskIdSlot, &cache]() {
+                foldRequest(foldingRequest, cache);
+
+                // A duplicated request of the same attribute becomes a no-op once this one is folded, so there is
+                // no need to keep it promotable. A newer request of the attribute may have replaced the entry, it
+                // stays registered until its own task is finished
+                std::lock_guard<std::mutex> lock(_pendingRequestsMutex);
+                const auto pendingRequest = _pendingRequests.find(pendingAttr);
+                if (pendingRequest != _pendingRequests.end() && pendingRequest->second == *taskIdSlot) {
+                    _pendingRequests.erase(pendingRequest);
+                }
+            },
+            TaskPriority::Background);
+    *taskIdSlot = taskId;
+    if (pendingAttr != nullptr) {
+        _pendingRequests[pendingAttr] = taskId;
+    }
+}
 
-        Const::ContentAttr request;
-        if (auto equivalenceRequest = mlir::dyn_cast_or_null<Const::EquivalenceRequestAttr>(foldingRequest.attr)) {
-            if (cache.replaceContentAttr(equivalenceRequest.getOriginalAttr(), equivalenceRequest.getNewAttr())) {
-                return;
-            }
-            request = equivalenceRequest.getNewAttr();
-        } else {
-            request = mlir::dyn_cast_if_present<Const::ContentAttr>(foldingRequest.attr);
+void BackgroundConstantFolding::foldRequest(const FoldingRequest& foldingRequest, ConstantFoldingCache& cache) {
+    Const::ContentAttr request;
+    if (auto equivalenceRequest = mlir::dyn_cast_or_null<Const::EquivalenceRequestAttr>(foldingRequest.attr)) {
+        if (cache.replaceContentAttr(equivalenceRequest.getOriginalAttr(), equivalenceRequest.getNewAttr())) {
+            return;
         }
-        VPUX_THROW_WHEN(request == nullptr, "Invalid folding request");
+        request = equivalenceRequest.getNewAttr();
+    } else {
+        request = mlir::dyn_cast_if_present<Const::ContentAttr>(foldingRequest.attr);
+    }
+    VPUX_THROW_WHEN(request == nullptr, "Invalid folding request");
 
-        if (cache.hasContent(request)) {
-            if (cache.isStatisticsCollectionEnabled()) {
-                cache.getStatistics().numDuplicatedRequests++;
-            }
-            return;
+    if (cache.hasContent(request)) {
+        if (cache.isStatisticsCollectionEnabled()) {
+            cache.getStatistics().numDuplicatedRequests++;
         }
+        return;
+    }
+
+    // Try folding partially if the new transformation is added to the end of the list of transformations
+    // In this case, it is likely that the previous ContentAttr (without the new transformation) is already
+    // in the cache, so its folded result can be reused
+    if (tryFoldingPartially(cache, request, foldingRequest.newTransformation)) {
+        return;
+    }
 
-        // Try folding partially if the new transformation is added to the end of the list of transformations
-        // In this case, it is likely that the previous ContentAttr (without the new transformation) is already
-        // in the cache, so its folded result can be reused
-        if (tryFoldingPartially(cache, request, foldingRequest.newTransformation)) {
+    // Create a copy of the Content which will own the referenced buffer
+    // This is done since the Content object obtained after folding may reference an external object without
+    // owning it. If that object is erased, the Content object from the cache would point to an invalid
+    // object
+    cache.addContent(request, request.fold(/*bypassCache=*/true).copyUnownedBuffer());
+}
+
+void BackgroundConstantFolding::promoteRequest(Const::ContentAttr attr) {
+    PriorityExecutor::TaskId taskId = 0;
+    {
+        std::lock_guard<std::mutex> lock(_pendingRequestsMutex);
+        const auto it = _pendingRequests.find(attr);
+        if (it == _pendingRequests.end()) {
             return;
         }
+        taskId = it->second;
+    }
 
-        // Create a copy of the Content which will own the referenced buffer
-        // This is done since the Content object obtained after folding may reference an external object without
-        // owning it. If that object is erased, the Content object from the cache would point to an invalid
-        // object
-        cache.addContent(request, request.fold(/*bypassCache=*/true).copyUnownedBuffer());
-    });
+    // Folds the request on the calling thread if no worker has picked it up yet
+    _executor->runOrWait(taskId);
 }
 
-std::shared_future<void> BackgroundConstantFolding::initFoldingListener(llvm::ThreadPool& threadPool) {
-    auto listenerThread = threadPool.async([this]() {
+// The listener only dispatches the requests to the executor, so it runs on its own thread instead of occupying
+// a thread of the MLIR pool
+std::thread BackgroundConstantFolding::initFoldingListener() {
+    std::thread listenerThread([this]() {
         auto& cacheManager = ConstantFoldingCacheManager::getInstance();
         auto& cache = cacheManager.get(_ctx);
 
@@ -187,7 +223,12 @@ void BackgroundConstantFolding::stopFoldingListener() {
     auto terminationAttr = Const::TerminateRequestAttr::get(_ctx);
     cache.enqueueRequest(Const::FoldingRequest{terminationAttr, nullptr});
 
-    _listenerThread.wait();
+    _listenerThread.join();
+
+    // The remaining requests are only speculative, the folding results are not needed anymore
+    cache.setPromoteHandler(nullptr);
+    _executor->cancelPending();
+    cache.setBackgroundTaskHandler(nullptr);
 
     if (cache.isStatisticsCollectionEnabled()) {
         _log.setName("constant-folding-in-background");
@@ -203,8 +244,40 @@ void BackgroundConstantFolding::stopFoldingListener() {
         _log.nest().info("number of duplicated requests:              {0}", statistics.numDuplicatedRequests);
         _log.nest().info("total number of elements added to cache:    {0}", statistics.numElementsAddedToCache);
         _log.nest().info("total number of elements erased from cache: {0}", statistics.numElementsErasedFromCache);
+
+        const size_t numLookups =
+                statistics.numCacheHits + statistics.numCompressedCacheHits + statistics.numCacheMisses;
+        const auto getHitRate = [&](size_t numHits) {
+            return numLookups != 0 ? static_cast<double>(numHits) / static_cast<double>(numLookups) : 0.0;
+        };
+        _log.info("Cache tier statistics");
+        _log.nest().info("main cache hit rate:                        {0:P}", getHitRate(statistics.numCacheHits));
+        _log.nest().info("compressed cache hit rate:                  {0:P}",
+                         getHitRate(statistics.numCompressedCacheHits));
+        _log.nest().info("number of compressed elements:              {0}", statistics.numElementsCompressed);
+        _log.nest().info("bytes saved by compression:                 {0}", statistics.numBytesSavedByCompression);
+        _log.nest().info("bytes restored without folding:             {0}",
+                         statistics.numBytesRestoredFromCompressedCache);
+        _log.nest().info("maximum memory used by compressed cache:    {0}",
+                         statistics.getMaxMemoryUsedCompressedCache());
+        _log.nest().info("current memory used by compressed cache:    {0}",
+                         cacheManager.get(_ctx).getMemoryUsedCompressedCache());
+
+        const auto executorStatistics = _executor->getStatistics();
+        _log.info("Executor statistics");
+        _log.nest().info("number of idle priority threads:            {0}", _executor->getNumIdlePriorityWorkers());
+        _log.nest().info("number of folding tasks:                    {0}", executorStatistics.numBackgroundTasks);
+        _log.nest().info("number of tasks folded on demand:           {0}", executorStatistics.numTasksRunByWaiter);
+        _log.nest().info("number of tasks boosted for a waiter:       {0}", executorStatistics.numBoostedTasks);
+        _log.nest().info("number of canceled tasks:                   {0}", executorStatistics.numCanceledTasks);
+        _log.nest().info("maximum number of tasks in queue:           {0}", executorStatistics.maxQueueDepth);
+        _log.nest().info("total task wait time:                       {0} us",
+                         executorStatistics.totalWaitTime.count());
+        _log.nest().info("maximum task wait time:                     {0} us", executorStatistics.maxWaitTime.count());
     }
 
+    _executor.reset();
+
     cacheManager.removeCache(_ctx);
 }
 
@@ -108,25 +108,6 @@ Const::Content vpux::Const::Content::copyUnownedBuffer() {
 // Content::copyTo
 //
 
-namespace {
-
-template <class Range>
-void fillBuf(const Range& range, MutableArrayRef<char> buf) {
-    using value_type = typename Range::iterator::value_type;
-    static const auto VALUE_BYTE_SIZE = sizeof(value_type);
-
-    VPUX_THROW_UNLESS(buf.size() >= range.size() * VALUE_BYTE_SIZE,
-                      "Buffer with byte size '{0}' is not enough to hold actual elements with '{1}' byte size",
-                      buf.size(), range.size() * VALUE_BYTE_SIZE);
-
-    for (size_t i = 0; i < range.size(); ++i) {
-        auto* bufPtr = reinterpret_cast<value_type*>(buf.data() + i * VALUE_BYTE_SIZE);
-        *bufPtr = range[i];
-    }
-}
-
-}  // namespace
-
 void vpux::Const::Content::copySubByteContent(MutableArrayRef<char> targetData, mlir::Type elemType) const {
     if (_isSplat) {
         const Bit elemSize = vpux::getElemTypeSize(elemType);
@@ -206,7 +187,14 @@ void vpux::Const::Content::copyTo(MutableArrayRef<char> targetData) const {
 
     dispatchByElemType<void>(elemType, [this, targetData](auto dummy) {
         using ElemT = std::decay_t<decltype(dummy)>;
-        fillBuf(this->getValues<ElemT>(), targetData);
+
+        const auto numElements = checked_cast<size_t>(getType().getNumElements());
+        VPUX_THROW_UNLESS(targetData.size() >= numElements * sizeof(ElemT),
+                          "Buffer with byte size '{0}' is not enough to hold actual elements with '{1}' byte size",
+                          targetData.size(), numElements * sizeof(ElemT));
+
+        auto targetValues = MutableArrayRef<ElemT>(reinterpret_cast<ElemT*>(targetData.data()), numElements);
+        this->copyValuesTo(targetValues);
     });
 }
 
@@ -0,0 +1,297 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/convert_elements.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define VPUX_CONVERT_ELEMENTS_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define VPUX_CONVERT_ELEMENTS_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace vpux;
+using vpux::type::float16;
+
+static_assert(sizeof(float16) == sizeof(uint16_t), "float16 is expected to be stored as raw 16-bit value");
+
+namespace {
+
+// The largest finite FP16 value and the smallest float which is rounded to FP16 infinity
+constexpr float FP16_MAX = 65504.0f;
+constexpr float FP16_OVERFLOW = 65520.0f;
+
+// Values below the smallest normal FP16 value are converted by the scalar code,
+// which keeps the results bit-exact with `float16(float)` for the denormal range
+constexpr float FP16_MIN_NORMAL = 6.103515625e-05f;
+
+//
+// Scalar kernels
+//
+
+template <typename InT, typename OutT>
+size_t convertScalar(const InT* in, OutT* out, size_t count) {
+    size_t clampedCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Const::details::SaturateCvtHelper<OutT>::cvt(in[i], clampedCount);
+    }
+    return clampedCount;
+}
+
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+
+//
+// AVX kernels
+//
+
+bool hasF16C() {
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (ecx & bit_F16C) != 0;
+}
+
+bool hasAvxF16C() {
+    static const bool supported = __builtin_cpu_supports("avx") && hasF16C();
+    return supported;
+}
+
+bool hasAvx2F16C() {
+    static const bool supported = __builtin_cpu_supports("avx2") && hasF16C();
+    return supported;
+}
+
+__attribute__((target("avx,f16c"))) size_t convertF32ToF16Avx(const float* in, float16* out, size_t count) {
+    const auto absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const auto maxVal = _mm256_set1_ps(FP16_MAX);
+    const auto minVal = _mm256_set1_ps(-FP16_MAX);
+    const auto overflowVal = _mm256_set1_ps(FP16_OVERFLOW);
+    const auto minNormalVal = _mm256_set1_ps(FP16_MIN_NORMAL);
+    const auto zero = _mm256_setzero_ps();
+
+    size_t clampedCount = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto val = _mm256_loadu_ps(in + i);
+        const auto absVal = _mm256_and_ps(val, absMask);
+
+        const auto nanMask = _mm256_cmp_ps(val, val, _CMP_UNORD_Q);
+        const auto denormMask = _mm256_and_ps(_mm256_cmp_ps(absVal, minNormalVal, _CMP_LT_OQ),
+                                              _mm256_cmp_ps(absVal, zero, _CMP_NEQ_OQ));
+        if (_mm256_movemask_ps(_mm256_or_ps(nanMask, denormMask)) != 0) {
+            clampedCount += convertScalar(in + i, out + i, 8);
+            continue;
+        }
+
+        const auto overflowMask = _mm256_movemask_ps(_mm256_cmp_ps(absVal, overflowVal, _CMP_GE_OQ));
+        clampedCount += __builtin_popcount(overflowMask);
+
+        const auto clampedVal = _mm256_max_ps(_mm256_min_ps(val, maxVal), minVal);
+        const auto res = _mm256_cvtps_ph(clampedVal, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), res);
+    }
+
+    return clampedCount + convertScalar(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx,f16c"))) size_t convertF16ToF32Avx(const float16* in, float* out, size_t count) {
+    const auto absMask = _mm_set1_epi16(0x7FFF);
+    const auto infBits = _mm_set1_epi16(0x7C00);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto val = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+        // NaN payloads are propagated differently by the hardware conversion
+        const auto nanMask = _mm_cmpgt_epi16(_mm_and_si128(val, absMask), infBits);
+        if (_mm_movemask_epi8(nanMask) != 0) {
+            convertScalar(in + i, out + i, 8);
+            continue;
+        }
+
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(val));
+    }
+
+    convertScalar(in + i, out + i, count - i);
+    return 0;
+}
+
+template <bool IsSigned>
+__attribute__((target("avx2"))) __m256 loadBytesAsF32(const void* ptr) {
+    const auto bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr));
+    const auto ints = IsSigned ? _mm256_cvtepi8_epi32(bytes) : _mm256_cvtepu8_epi32(bytes);
+    return _mm256_cvtepi32_ps(ints);
+}
+
+// 8-bit integers are exactly representable in FP16, no clamping is needed
+template <typename InT>
+__attribute__((target("avx2,f16c"))) size_t convertI8ToF16Avx2(const InT* in, float16* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto val = loadBytesAsF32<std::is_signed<InT>::value>(in + i);
+        const auto res = _mm256_cvtps_ph(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), res);
+    }
+
+    convertScalar(in + i, out + i, count - i);
+    return 0;
+}
+
+template <typename InT>
+__attribute__((target("avx2"))) size_t convertI8ToF32Avx2(const InT* in, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, loadBytesAsF32<std::is_signed<InT>::value>(in + i));
+    }
+
+    convertScalar(in + i, out + i, count - i);
+    return 0;
+}
+
+#elif defined(VPUX_CONVERT_ELEMENTS_NEON)
+
+//
+// NEON kernels
+//
+
+size_t convertF32ToF16Neon(const float* in, float16* out, size_t count) {
+    const auto maxVal = vdupq_n_f32(FP16_MAX);
+    const auto minVal = vdupq_n_f32(-FP16_MAX);
+    const auto overflowVal = vdupq_n_f32(FP16_OVERFLOW);
+    const auto minNormalVal = vdupq_n_f32(FP16_MIN_NORMAL);
+    const auto zero = vdupq_n_f32(0.0f);
+
+    size_t clampedCount = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto val = vld1q_f32(in + i);
+        const auto absVal = vabsq_f32(val);
+
+        const auto notNanMask = vceqq_f32(val, val);
+        const auto denormMask = vandq_u32(vcltq_f32(absVal, minNormalVal), vmvnq_u32(vceqq_f32(absVal, zero)));
+        if (vminvq_u32(notNanMask) == 0 || vmaxvq_u32(denormMask) != 0) {
+            clampedCount += convertScalar(in + i, out + i, 4);
+            continue;
+        }
+
+        const auto overflowMask = vcgeq_f32(absVal, overflowVal);
+        clampedCount += vaddvq_u32(vshrq_n_u32(overflowMask, 31));
+
+        const auto clampedVal = vmaxq_f32(vminq_f32(val, maxVal), minVal);
+        vst1_u16(reinterpret_cast<uint16_t*>(out + i), vreinterpret_u16_f16(vcvt_f16_f32(clampedVal)));
+    }
+
+    return clampedCount + convertScalar(in + i, out + i, count - i);
+}
+
+size_t convertF16ToF32Neon(const float16* in, float* out, size_t count) {
+    const auto absMask = vdup_n_u16(0x7FFF);
+    const auto infBits = vdup_n_u16(0x7C00);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto val = vld1_u16(reinterpret_cast<const uint16_t*>(in + i));
+
+        // NaN payloads are propagated differently by the hardware conversion
+        const auto nanMask = vcgt_u16(vand_u16(val, absMask), infBits);
+        if (vmaxv_u16(nanMask) != 0) {
+            convertScalar(in + i, out + i, 4);
+            continue;
+        }
+
+        vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(val)));
+    }
+
+    convertScalar(in + i, out + i, count - i);
+    return 0;
+}
+
+#endif
+
+}  // namespace
+
+//
+// convertElements
+//
+
+template <>
+size_t vpux::Const::details::convertElements<float, float16>(const float* in, float16* out, size_t count) {
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+    if (hasAvxF16C()) {
+        return convertF32ToF16Avx(in, out, count);
+    }
+#elif defined(VPUX_CONVERT_ELEMENTS_NEON)
+    return convertF32ToF16Neon(in, out, count);
+#endif
+    return convertScalar(in, out, count);
+}
+
+template <>
+size_t vpux::Const::details::convertElements<float16, float>(const float16* in, float* out, size_t count) {
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+    if (hasAvxF16C()) {
+        return convertF16ToF32Avx(in, out, count);
+    }
+#elif defined(VPUX_CONVERT_ELEMENTS_NEON)
+    return convertF16ToF32Neon(in, out, count);
+#endif
+    return convertScalar(in, out, count);
+}
+
+template <>
+size_t vpux::Const::details::convertElements<int8_t, float16>(const int8_t* in, float16* out, size_t count) {
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+    if (hasAvx2F16C()) {
+        return convertI8ToF16Avx2(in, out, count);
+    }
+#endif
+    return convertScalar(in, out, count);
+}
+
+template <>
+size_t vpux::Const::details::convertElements<uint8_t, float16>(const uint8_t* in, float16* out, size_t count) {
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+    if (hasAvx2F16C()) {
+        return convertI8ToF16Avx2(in, out, count);
+    }
+#endif
+    return convertScalar(in, out, count);
+}
+
+template <>
+size_t vpux::Const::details::convertElements<int8_t, float>(const int8_t* in, float* out, size_t count) {
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+    if (__builtin_cpu_supports("avx2")) {
+        return convertI8ToF32Avx2(in, out, count);
+    }
+#endif
+    return convertScalar(in, out, count);
+}
+
+template <>
+size_t vpux::Const::details::convertElements<uint8_t, float>(const uint8_t* in, float* out, size_t count) {
+#if defined(VPUX_CONVERT_ELEMENTS_X86)
+    if (__builtin_cpu_supports("avx2")) {
+        return convertI8ToF32Avx2(in, out, count);
+    }
+#endif
+    return convertScalar(in, out, count);
+}
+
+//
+// reportClampedValues
+//
+
+void vpux::Const::details::reportClampedValues(size_t clampedCount) {
+    if (clampedCount == 0) {
+        return;
+    }
+
+    auto logger = Logger::global();
+    logger.warning("{0} value(s) are out of range for FP16; clamping them to the FP16 range.", clampedCount);
+}
@@ -30,16 +30,49 @@ mlir::SmallVector<char> vpux::Const::getConstBuffer(const char* sourceData, cons
     }
 
     auto targetData = SmallVector<char>(numElems);
+    unpackSubByteBuffer(sourceData, bitWidth, targetData);
+    return targetData;
+}
+
+//
+// Const::unpackSubByteBuffer
+//
+
+void vpux::Const::unpackSubByteBuffer(const char* sourceData, const size_t bitWidth, MutableArrayRef<char> targetData) {
+    VPUX_THROW_UNLESS(isSubByte(bitWidth), "Invalid sub-byte bitWidth: '{0}'", bitWidth);
+
     // For sub 8 bit we need to unpack the data
     const auto elemPerByte = CHAR_BIT / bitWidth;
     VPUX_THROW_UNLESS(vpux::isPowerOfTwo(elemPerByte), "Invalid number of elements per byte '{0}'", elemPerByte);
     const size_t mask = checked_cast<uint8_t>(checked_cast<uint16_t>(std::pow(2, bitWidth)) - 1);
-    for (size_t idx = 0; idx < numElems / elemPerByte; idx++) {
+    for (size_t idx = 0; idx < targetData.size() / elemPerByte; idx++) {
         size_t shift = 0;
         for (size_t elemIdx = 0; elemIdx <= elemPerByte - 1; elemIdx++) {
             targetData[idx * elemPerByte + elemIdx] = (sourceData[idx] >> shift) & mask;
             shift += bitWidth;
         }
     }
-    return targetData;
+}
+
+//
+// Const::getPackedBufferSize
+//
+
+int64_t vpux::Const::getPackedBufferSize(const size_t bitWidth, const int64_t numElems) {
+    return divUp(numElems * checked_cast<int64_t>(bitWidth), checked_cast<int64_t>(CHAR_BIT));
+}
+
+//
+// Const::isPackedSubByteBuffer
+//
+
+bool vpux::Const::isPackedSubByteBuffer(mlir::ShapedType type, ArrayRef<char> data) {
+    const auto intType = type.getElementType().dyn_cast<mlir::IntegerType>();
+    if (intType == nullptr || !isSubByte(intType.getWidth())) {
+        return false;
+    }
+
+    // A single element has the same layout in both representations
+    const auto numElems = type.getNumElements();
+    return numElems > 1 && checked_cast<int64_t>(data.size()) == getPackedBufferSize(intType.getWidth(), numElems);
 }
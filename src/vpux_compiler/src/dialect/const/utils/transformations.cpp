@@ -7,9 +7,11 @@
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 #include "vpux/compiler/dialect/const/utils/const_logger.hpp"
 #include "vpux/compiler/dialect/const/utils/mem_permute_optimized.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
 #include "vpux/compiler/utils/loop.hpp"
 
 #include "vpux/utils/core/hash.hpp"
+#include "vpux/utils/core/range.hpp"
 
 #include <unordered_map>
 #include <unordered_set>
@@ -71,3 +73,211 @@ Const::Content Const::details::memPermuteTransformation(vpux::Const::Content& in
         return output;
     }
 }
+
+//
+// applyFusedTransformations
+//
+
+namespace {
+
+// Number of output elements produced by a single task of the fused loop
+constexpr int64_t FUSED_BLOCK_SIZE = 16 * 1024;
+
+enum class ElementwiseKind { Rescale, Add };
+
+struct ElementwiseStep final {
+    ElementwiseKind kind;
+    float value;
+};
+
+// Index mapping of a SubView in the memory order, Reshape and LayoutCast keep the linear memory index as is
+struct SubViewStep final {
+    MemShape inMemShape;
+    MemShape outMemShape;
+    MemShape memOffset;
+};
+
+struct FusedChain final {
+    SmallVector<ElementwiseStep> elementwiseSteps;
+    SmallVector<SubViewStep> subViewSteps;
+    vpux::NDTypeInterface outType;
+    size_t numTransformations = 0;
+};
+
+bool isViewTransformation(Const::TransformAttrInterface attr) {
+    if (mlir::isa<Const::ReshapeAttr, Const::LayoutCastAttr>(attr)) {
+        return true;
+    }
+    // The element type conversion is lazy, only sub-byte types change the storage on copy
+    if (const auto convertAttr = mlir::dyn_cast<Const::ConvertElemTypeAttr>(attr)) {
+        return vpux::getElemTypeSize(convertAttr.getElemType()).count() >= CHAR_BIT;
+    }
+    return false;
+}
+
+FusedChain collectFusedChain(vpux::NDTypeInterface inType, ArrayRef<Const::TransformAttrInterface> transformations) {
+    FusedChain chain;
+    FusedChain candidate;
+    candidate.outType = inType;
+
+    size_t numMaterializing = 0;
+    for (const auto& attr : transformations) {
+        const auto type = candidate.outType;
+
+        if (const auto rescaleAttr = mlir::dyn_cast<Const::RescaleAttr>(attr)) {
+            const auto scale = static_cast<float>(rescaleAttr.getScale().getValue().convertToDouble());
+            candidate.elementwiseSteps.push_back({ElementwiseKind::Rescale, scale});
+        } else if (const auto addAttr = mlir::dyn_cast<Const::AddAttr>(attr)) {
+            const auto bias = static_cast<float>(addAttr.getBias().getValue().convertToDouble());
+            candidate.elementwiseSteps.push_back({ElementwiseKind::Add, bias});
+        } else if (const auto subViewAttr = mlir::dyn_cast<Const::SubViewAttr>(attr)) {
+            const auto order = type.getDimsOrder();
+            const auto offset = Shape(parseIntArrayAttr<int64_t>(subViewAttr.getOffset()));
+            const auto subViewType = subViewAttr.inferOutputType(type);
+            candidate.subViewSteps.push_back({order.toMemoryOrder(type.getShape()),
+                                              order.toMemoryOrder(subViewType.getShape()),
+                                              order.toMemoryOrder(offset)});
+        } else if (!isViewTransformation(attr)) {
+            break;
+        }
+
+        candidate.outType = attr.inferOutputType(type);
+        ++candidate.numTransformations;
+
+        // Trailing view transformations are free on their own, so the chain ends at the last materializing one
+        if (!isViewTransformation(attr)) {
+            ++numMaterializing;
+            chain = candidate;
+        }
+    }
+
+    // A single materializing transformation doesn't have any intermediate buffer to save
+    if (numMaterializing < 2) {
+        return FusedChain{};
+    }
+    return chain;
+}
+
+// Maps the linear memory index of the fused output into the linear memory index of the input.
+// `runLength` is reduced to the number of following elements which are contiguous in the input as well.
+int64_t mapToInput(ArrayRef<SubViewStep> subViewSteps, int64_t outMemInd1D, int64_t& runLength) {
+    auto memInd1D = outMemInd1D;
+    for (const auto& step : subViewSteps | reversed) {
+        const auto innerSize = step.outMemShape.raw().back();
+        runLength = std::min(runLength, innerSize - memInd1D % innerSize);
+
+        auto memIndND = getMemIndexND(memInd1D, step.outMemShape);
+        for (auto ind : irange(memIndND.size())) {
+            memIndND[MemDim(ind)] += step.memOffset[MemDim(ind)];
+        }
+        memInd1D = getMemIndex1D(memIndND, step.inMemShape);
+    }
+    return memInd1D;
+}
+
+void applyElementwiseSteps(ArrayRef<ElementwiseStep> steps, MutableArrayRef<float> vals) {
+    // Each step is applied to the whole block, which keeps the inner loops trivially vectorizable
+    for (const auto& step : steps) {
+        if (step.kind == ElementwiseKind::Rescale) {
+            for (auto& val : vals) {
+                val *= step.value;
+            }
+        } else {
+            for (auto& val : vals) {
+                val += step.value;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+size_t Const::details::applyFusedTransformations(vpux::Const::Content& content,
+                                                 ArrayRef<TransformAttrInterface> transformations) {
+    // Splat content is cheap to transform one by one
+    if (content.isSplat() || vpux::getElemTypeSize(content.getStorageElemType()).count() < CHAR_BIT) {
+        return 0;
+    }
+
+    const auto chain = collectFusedChain(content.getType(), transformations);
+    if (chain.numTransformations == 0) {
+        return 0;
+    }
+
+    auto ctx = content.getType().getContext();
+    const auto hasArithmetic = !chain.elementwiseSteps.empty();
+    const auto outStorageType = hasArithmetic ? mlir::Float32Type::get(ctx) : content.getStorageElemType();
+    auto output = Const::Content::allocTempBuffer(chain.outType, outStorageType, /*isSplat=*/false);
+
+    const auto numElements = chain.outType.getNumElements();
+    const auto numBlocks = divUp(numElements, FUSED_BLOCK_SIZE);
+
+    // Calls `copyRun(inMemInd1D, outMemInd1D, length)` for the contiguous runs of the [begin, end) output block
+    const auto forEachRun = [&](int64_t begin, int64_t end, auto&& copyRun) {
+        for (auto outMemInd1D = begin; outMemInd1D < end;) {
+            auto runLength = end - outMemInd1D;
+            const auto inMemInd1D = mapToInput(chain.subViewSteps, outMemInd1D, runLength);
+            copyRun(inMemInd1D, outMemInd1D, runLength);
+            outMemInd1D += runLength;
+        }
+    };
+
+    const auto forEachBlock = [&](auto&& processBlock) {
+        loop_1d(
+                LoopExecPolicy::Parallel, ctx, numBlocks,
+                [&](int64_t blockInd) {
+                    const auto begin = blockInd * FUSED_BLOCK_SIZE;
+                    processBlock(begin, std::min(begin + FUSED_BLOCK_SIZE, numElements));
+                },
+                /*costHint=*/FUSED_BLOCK_SIZE);
+    };
+
+    if (!hasArithmetic) {
+        // Only the index remapping, copy the raw elements
+        const auto elemSize = checked_cast<size_t>(Byte(vpux::getElemTypeSize(outStorageType)).count());
+        const auto inBuf = content.getRawStorageBuf();
+        auto outBuf = output.getRawTempBuf();
+
+        forEachBlock([&](int64_t begin, int64_t end) {
+            forEachRun(begin, end, [&](int64_t inMemInd1D, int64_t outMemInd1D, int64_t length) {
+                std::copy_n(inBuf.data() + checked_cast<size_t>(inMemInd1D) * elemSize,
+                            checked_cast<size_t>(length) * elemSize,
+                            outBuf.data() + checked_cast<size_t>(outMemInd1D) * elemSize);
+            });
+        });
+    } else {
+        auto outVals = output.getTempBuf<float>();
+
+        if (content.getStorageElemType().isF32()) {
+            const auto inVals = content.getStorageBuf<float>();
+            forEachBlock([&](int64_t begin, int64_t end) {
+                forEachRun(begin, end, [&](int64_t inMemInd1D, int64_t outMemInd1D, int64_t length) {
+                    std::copy_n(inVals.data() + inMemInd1D, length, outVals.data() + outMemInd1D);
+                });
+                applyElementwiseSteps(chain.elementwiseSteps,
+                                      outVals.slice(checked_cast<size_t>(begin), checked_cast<size_t>(end - begin)));
+            });
+        } else if (chain.subViewSteps.empty()) {
+            // The same elements in the same order, convert them in bulk right into the output buffer
+            content.copyValuesTo(outVals);
+            forEachBlock([&](int64_t begin, int64_t end) {
+                applyElementwiseSteps(chain.elementwiseSteps,
+                                      outVals.slice(checked_cast<size_t>(begin), checked_cast<size_t>(end - begin)));
+            });
+        } else {
+            const auto inVals = content.getValues<float>();
+            forEachBlock([&](int64_t begin, int64_t end) {
+                forEachRun(begin, end, [&](int64_t inMemInd1D, int64_t outMemInd1D, int64_t length) {
+                    for (int64_t i = 0; i < length; ++i) {
+                        outVals[outMemInd1D + i] = inVals[inMemInd1D + i];
+                    }
+                });
+                applyElementwiseSteps(chain.elementwiseSteps,
+                                      outVals.slice(checked_cast<size_t>(begin), checked_cast<size_t>(end - begin)));
+            });
+        }
+    }
+
+    content = std::move(output);
+    return chain.numTransformations;
+}
@@ -757,15 +757,17 @@ void NGraphImporter::parseNode(mlir::OpBuilder& builder, const std::shared_ptr<o
     const Byte elemTypeSize = getElemTypeSize(tensorType).to<Byte>();
     const auto bitWidth = origNode->get_output_element_type(0).bitwidth();
     const auto bufferSize = numElems * elemTypeSize.count();
-
-    auto value = [&]() -> mlir::ElementsAttr {
-        if (vpux::Const::isSubByte(bitWidth) || !_sharedConstants) {
-            auto rawBuffer = vpux::Const::getConstBuffer(origNode->get_data_ptr<char>(), bitWidth, bufferSize);
-
-            return mlir::DenseElementsAttr::getFromRawBuffer(tensorType, rawBuffer);
+    const auto isSubByte = vpux::Const::isSubByte(bitWidth);
+
+    if (_sharedConstants) {
+        // The constant refers to the OV buffer without any copy. Sub-byte elements are referred packed with their
+        // original element type and are unpacked only when the constant is folded.
+        if (isSubByte) {
+            tensorType = mlir::RankedTensorType::get(tensorType.getShape(),
+                                                     importPrecision(_ctx, origNode->get_output_element_type(0)));
         }
-
-        const auto rawBuffer = ArrayRef(origNode->get_data_ptr<char>(), bufferSize);
+        const auto sharedBufferSize = isSubByte ? vpux::Const::getPackedBufferSize(bitWidth, numElems) : bufferSize;
+        const auto rawBuffer = ArrayRef(origNode->get_data_ptr<char>(), sharedBufferSize);
 
         constexpr size_t defaultAlignment =
                 alignof(std::max_align_t);  // seemingly used nowhere except no-op deleter - use C++ default
@@ -776,13 +778,21 @@ void NGraphImporter::parseNode(mlir::OpBuilder& builder, const std::shared_ptr<o
         auto& builtinDialectManager = mlir::DenseResourceElementsHandle::getManagerInterface(builder.getContext());
         // assumption (as per MLIR documented behavior): inserting a new blob with the same key would internally cause
         // the key to change, so that there are no collisions - thus, the blob is never overwritten here
-        return mlir::DenseResourceElementsAttr::get(
+        const auto value = mlir::DenseResourceElementsAttr::get(
                 tensorType, builtinDialectManager.insert("ngraphSharedConstant", std::move(blob)));
-    }();
+
+        auto op = builder.create<Const::DeclareOp>(createLocation(origNode), tensorType,
+                                                   Const::ContentAttr::get(value));
+        addOutputs(origNode, op);
+        return;
+    }
+
+    auto rawBuffer = vpux::Const::getConstBuffer(origNode->get_data_ptr<char>(), bitWidth, bufferSize);
+    const auto value = mlir::DenseElementsAttr::getFromRawBuffer(tensorType, rawBuffer);
 
     // For sub 8 bit we need to unpack the data
     auto contentAttr = Const::ContentAttr::get(value);
-    if (vpux::Const::isSubByte(bitWidth)) {
+    if (isSubByte) {
         // First for subbyte datatypes we took importStoragePrecision, because of the MLIR limitation of
         // storing sub byte datatype, and now we convert the Constant data type to the original datatype.
         auto dataType = importPrecision(_ctx, origNode->get_output_element_type(0));
@@ -5,8 +5,6 @@
 
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
-#include <vpux_elf/accessor.hpp>
-#include <vpux_elf/reader.hpp>
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
 
@@ -26,35 +24,6 @@ SmallString getSwKernelArchString(VPU::ArchKind archKind) {
 
 }  // namespace
 
-ArrayRef<uint8_t> vpux::ELF::getDataAndSizeOfElfSection(ArrayRef<uint8_t> elfBlob,
-                                                        ArrayRef<StringRef> possibleSecNames) {
-    auto accessor = elf::ElfDDRAccessManager(elfBlob.data(), elfBlob.size());
-    auto elfReader = elf::Reader<elf::ELF_Bitness::Elf32>(&accessor);
-
-    const uint8_t* secData = nullptr;
-    uint32_t secSize = 0;
-
-    bool secFound = false;
-
-    for (size_t i = 0; i < elfReader.getSectionsNum(); ++i) {
-        auto section = elfReader.getSection(i);
-        const auto secName = section.getName();
-        const auto sectionHeader = section.getHeader();
-
-        for (auto& possibleSecName : possibleSecNames) {
-            if (strcmp(secName, possibleSecName.data()) == 0) {
-                secSize = sectionHeader->sh_size;
-                secData = section.getData<uint8_t>();
-                secFound = true;
-                break;
-            }
-        }
-    }
-    VPUX_THROW_UNLESS(secFound, "Section {0} not found in ELF", possibleSecNames);
-
-    return {secData, secSize};
-}
-
 size_t vpux::ELF::math::gcd(size_t a, size_t b) {
     if (b == 0) {
         return a;
@@ -94,7 +63,7 @@ ArrayRef<uint8_t> vpux::ELF::getKernelELF(mlir::Operation* operation, StringRef
     } else {
         elfBlob = kernelInfo.getElf(kernelPath, arch);
     }
-    return sectionNames.empty() ? elfBlob : vpux::ELF::getDataAndSizeOfElfSection(elfBlob, sectionNames);
+    return sectionNames.empty() ? elfBlob : kernelInfo.getKernelInfo(elfBlob).getSection(sectionNames);
 }
 
 mlir::SymbolRefAttr vpux::ELF::composeSectionObjectSymRef(ELF::ElfSectionInterface sectionIface, mlir::Operation* op) {
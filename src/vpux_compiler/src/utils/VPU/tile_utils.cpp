@@ -13,6 +13,18 @@
 namespace vpux {
 namespace VPU {
 
+namespace {
+
+// The distributed tile types are built for the strategy stored in the operation, if any
+std::optional<VPU::MultiClusterStrategy> getOpStrategy(mlir::Operation* op) {
+    if (const auto strategyAttr = op->getAttrOfType<VPU::MultiClusterStrategyAttr>(VPU::multiClusterStrategy)) {
+        return strategyAttr.getValue();
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
 // Convolution
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::ConvolutionOp origOp, const TileInfo& outTile,
@@ -37,7 +49,8 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::ConvolutionOp origOp, const
 }
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEConvolutionOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiling = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global()));
 
     const auto tiles = tiling.tiles;
@@ -50,7 +63,7 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEConvolutionOp origOp, co
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
@@ -58,17 +71,22 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEConvolutionOp origOp, co
         auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(nceOp == nullptr, "Op {0} has multiClusterStrategy but is not an NCEOp", origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(
-                clusteredOp, outputTileType.getShape(),
-                clusteredOp->getAttr(VPU::multiClusterStrategy).cast<VPU::MultiClusterStrategyAttr>().getValue());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters, strategy.value()),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, filterTileType, outputTileType};
 }
 
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEConvolutionOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
 // MaxPool
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::MaxPoolOp origOp, const TileInfo& outTile,
@@ -90,7 +108,8 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::MaxPoolOp origOp, const Til
 }
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEMaxPoolOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiling = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global()));
 
     const auto tiles = tiling.tiles;
@@ -101,24 +120,31 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEMaxPoolOp origOp, const
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(),
-                                                      clusteredOp.getMultiClusterStrategy().value());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, outputTileType};
 }
 
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEMaxPoolOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
 // AveragePool
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEAveragePoolOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiling = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global()));
 
     const auto tiles = tiling.tiles;
@@ -130,20 +156,26 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEAveragePoolOp origOp, co
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(),
-                                                      clusteredOp.getMultiClusterStrategy().value());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, outputTileType};
 }
 
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEAveragePoolOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
 // GroupConvolution
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::GroupConvolutionOp origOp, const TileInfo& outTile,
@@ -171,7 +203,8 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::GroupConvolutionOp origOp,
 }
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEDepthConvolutionOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiling = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global()));
 
     const auto tiles = tiling.tiles;
@@ -184,7 +217,7 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEDepthConvolutionOp origO
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(nceOp == nullptr, "Op {0} has multiClusterStrategy but is not an NCEOp", origOp->getLoc());
 
@@ -192,18 +225,25 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEDepthConvolutionOp origO
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(),
-                                                      clusteredOp.getMultiClusterStrategy().value());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters, strategy.value()),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, filterTileType, outputTileType};
 }
 
-SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCECompressConvolutionOp origOp, const TileInfo& outTile,
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEDepthConvolutionOp origOp, const TileInfo& outTile,
                                                 const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCECompressConvolutionOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiles = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global())).tiles;
     auto inputTileType = origOp.getInput().getType().cast<vpux::NDTypeInterface>().extractDenseTile(tiles[0].offsets,
                                                                                                     tiles[0].shape);
@@ -212,7 +252,7 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCECompressConvolutionOp or
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
@@ -220,28 +260,34 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCECompressConvolutionOp or
         auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(nceOp == nullptr, "Op {0} has multiClusterStrategy but is not an NCEOp", origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(
-                clusteredOp, outputTileType.getShape(),
-                clusteredOp->getAttr(VPU::multiClusterStrategy).cast<VPU::MultiClusterStrategyAttr>().getValue());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters, strategy.value()),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, filterTileType, outputTileType};
 }
 
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCECompressConvolutionOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
 // Permute
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEPermuteOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiles = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global())).tiles;
     auto inputTileType = origOp.getInput().getType().cast<vpux::NDTypeInterface>().extractDenseTile(tiles[0].offsets,
                                                                                                     tiles[0].shape);
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
@@ -249,20 +295,26 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEPermuteOp origOp, const
         auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(nceOp == nullptr, "Op {0} has multiClusterStrategy but is not an NCEOp", origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(
-                clusteredOp, outputTileType.getShape(),
-                clusteredOp->getAttr(VPU::multiClusterStrategy).cast<VPU::MultiClusterStrategyAttr>().getValue());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, outputTileType};
 }
 
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEPermuteOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
 // DepthToSpace
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::DepthToSpaceOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiling = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global()));
 
     const auto tiles = tiling.tiles;
@@ -274,23 +326,29 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::DepthToSpaceOp origOp, cons
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(
-                clusteredOp, outputTileType.getShape(),
-                clusteredOp->getAttr(VPU::multiClusterStrategy).cast<VPU::MultiClusterStrategyAttr>().getValue());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, outputTileType};
 }
 
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::DepthToSpaceOp origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
 SmallVector<vpux::NDTypeInterface> getTileTypesCommon(mlir::Operation* origOp, const TileInfo& outTile,
-                                                      const std::optional<InputTiling>& inputTiles) {
+                                                      const std::optional<InputTiling>& inputTiles,
+                                                      std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto outputType = origOp->getResult(0).getType().cast<vpux::NDTypeInterface>();
 
     SmallVector<vpux::TileInfo> inTiles{outTile};
@@ -314,7 +372,7 @@ SmallVector<vpux::NDTypeInterface> getTileTypesCommon(mlir::Operation* origOp, c
     }
     const auto outputTileType = outputType.extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (!origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (!strategy.has_value()) {
         inputTileTypes.push_back(outputTileType);
         return inputTileTypes;
     }
@@ -322,25 +380,26 @@ SmallVector<vpux::NDTypeInterface> getTileTypesCommon(mlir::Operation* origOp, c
     auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp);
     VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                     origOp->getLoc());
-    auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(),
-                                                  clusteredOp.getMultiClusterStrategy().value());
+    auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
 
     SmallVector<vpux::NDTypeInterface> distributedTensorTypes;
     for (const auto& inputTileType : inputTileTypes) {
-        auto inDistributedType =
-                VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, outputTileType);
+        auto inDistributedType = VPU::getDistributedActivationTypeFromOp(
+                clusteredOp, inputTileType, numClusters, strategy.value(),
+                /*customAlignment*/ ArrayRef<int64_t>{}, outputTileType);
         distributedTensorTypes.push_back(inDistributedType.cast<vpux::NDTypeInterface>());
     }
 
-    auto outDistributedType =
-            VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, inputTileTypes[0]);
+    auto outDistributedType = VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters,
+                                                                  strategy.value(), inputTileTypes[0]);
     distributedTensorTypes.push_back(outDistributedType.cast<vpux::NDTypeInterface>());
 
     return distributedTensorTypes;
 }
 
 SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEInterpolateOp origOp, const TileInfo& outTile,
-                                                const std::optional<InputTiling>& inputTiles) {
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     const auto tiling = inputTiles.value_or(origOp.backInferTileInfo(outTile, Logger::global()));
 
     const auto tiles = tiling.tiles;
@@ -353,7 +412,7 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEInterpolateOp origOp, co
     auto outputTileType =
             origOp.getType().cast<vpux::NDTypeInterface>().extractDenseTile(outTile.offsets, outTile.shape);
 
-    if (origOp->hasAttr(VPU::multiClusterStrategy)) {
+    if (strategy.has_value()) {
         auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(clusteredOp == nullptr, "Op {0} has multiClusterStrategy but is not an ClusteredOp",
                         origOp->getLoc());
@@ -361,70 +420,102 @@ SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEInterpolateOp origOp, co
         auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(origOp.getOperation());
         VPUX_THROW_WHEN(nceOp == nullptr, "Op {0} has multiClusterStrategy but is not an NCEOp", origOp->getLoc());
 
-        auto numClusters = VPU::getOptimalNumClusters(
-                clusteredOp, outputTileType.getShape(),
-                clusteredOp->getAttr(VPU::multiClusterStrategy).cast<VPU::MultiClusterStrategyAttr>().getValue());
-        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, nullptr, tiles[0]),
-                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters),
-                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, nullptr, outTile)};
+        auto numClusters = VPU::getOptimalNumClusters(clusteredOp, outputTileType.getShape(), strategy.value());
+        return {VPU::getDistributedActivationTypeFromOp(clusteredOp, inputTileType, numClusters, strategy.value(),
+                                                        /*customAlignment*/ ArrayRef<int64_t>{}, nullptr, tiles[0]),
+                VPU::getDistributedFilterTypeFromOp(nceOp, filterTileType, numClusters, strategy.value()),
+                VPU::getDistributedOutputTypeFromOp(clusteredOp, outputTileType, numClusters, strategy.value(),
+                                                    nullptr, outTile)};
     }
 
     return {inputTileType, filterTileType, outputTileType};
 }
 
-SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::SWOpInterface origOp, const TileInfo& outTile,
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::NCEInterpolateOp origOp, const TileInfo& outTile,
                                                 const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
+SmallVector<vpux::NDTypeInterface> getTileTypesCommon(mlir::Operation* origOp, const TileInfo& outTile,
+                                                      const std::optional<InputTiling>& inputTiles) {
+    return getTileTypesCommon(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::SWOpInterface origOp, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     VPUX_THROW_UNLESS(origOp->getResults().size() == 1, "Only support SW with one output, but got '{0}'",
                       origOp->getResults().size());
 
-    return getTileTypesCommon(origOp, outTile, inputTiles);
+    return getTileTypesCommon(origOp, outTile, inputTiles, strategy);
 }
 
-SmallVector<vpux::NDTypeInterface> getTileTypes(mlir::Operation* op, const TileInfo& outTile,
+SmallVector<vpux::NDTypeInterface> getTileTypes(VPU::SWOpInterface origOp, const TileInfo& outTile,
                                                 const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(origOp, outTile, inputTiles, getOpStrategy(origOp));
+}
+
+SmallVector<vpux::NDTypeInterface> getTileTypes(mlir::Operation* op, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles,
+                                                std::optional<VPU::MultiClusterStrategy> strategy) {
     if (auto convOp = mlir::dyn_cast<VPU::ConvolutionOp>(op)) {
         return getTileTypes(convOp, outTile, inputTiles);
     }
     if (auto convOp = mlir::dyn_cast<VPU::NCEConvolutionOp>(op)) {
-        return getTileTypes(convOp, outTile, inputTiles);
+        return getTileTypes(convOp, outTile, inputTiles, strategy);
     }
     if (auto convOp = mlir::dyn_cast<VPU::NCECompressConvolutionOp>(op)) {
-        return getTileTypes(convOp, outTile, inputTiles);
+        return getTileTypes(convOp, outTile, inputTiles, strategy);
     }
     if (auto poolOp = mlir::dyn_cast<VPU::MaxPoolOp>(op)) {
         return getTileTypes(poolOp, outTile, inputTiles);
     }
     if (auto poolOp = mlir::dyn_cast<VPU::NCEMaxPoolOp>(op)) {
-        return getTileTypes(poolOp, outTile, inputTiles);
+        return getTileTypes(poolOp, outTile, inputTiles, strategy);
     }
     if (auto poolOp = mlir::dyn_cast<VPU::NCEAveragePoolOp>(op)) {
-        return getTileTypes(poolOp, outTile, inputTiles);
+        return getTileTypes(poolOp, outTile, inputTiles, strategy);
     }
     if (auto groupConvOp = mlir::dyn_cast<VPU::GroupConvolutionOp>(op)) {
         return getTileTypes(groupConvOp, outTile, inputTiles);
     }
     if (auto depthConvOp = mlir::dyn_cast<VPU::NCEDepthConvolutionOp>(op)) {
-        return getTileTypes(depthConvOp, outTile, inputTiles);
+        return getTileTypes(depthConvOp, outTile, inputTiles, strategy);
     }
     if (auto depthToSpaceOp = mlir::dyn_cast<VPU::DepthToSpaceOp>(op)) {
-        return getTileTypes(depthToSpaceOp, outTile, inputTiles);
+        return getTileTypes(depthToSpaceOp, outTile, inputTiles, strategy);
     }
     if (auto swOp = mlir::dyn_cast<VPU::SWOpInterface>(op)) {
-        return getTileTypes(swOp, outTile, inputTiles);
+        return getTileTypes(swOp, outTile, inputTiles, strategy);
     }
     if (auto interpOp = mlir::dyn_cast<VPU::NCEInterpolateOp>(op)) {
-        return getTileTypes(interpOp, outTile, inputTiles);
+        return getTileTypes(interpOp, outTile, inputTiles, strategy);
     }
     if (auto permuteOp = mlir::dyn_cast<VPU::NCEPermuteOp>(op)) {
-        return getTileTypes(permuteOp, outTile, inputTiles);
+        return getTileTypes(permuteOp, outTile, inputTiles, strategy);
     }
     if (auto gatherOp = mlir::dyn_cast<VPU::GatherOp>(op)) {
-        return getTileTypesCommon(gatherOp, outTile, inputTiles);
+        return getTileTypesCommon(gatherOp, outTile, inputTiles, strategy);
     }
 
     auto tileConf = inputTiles.value_or(vpux::backInferEltwiseTile(op, outTile));
 
-    return getTileTypesCommon(op, outTile, tileConf);
+    return getTileTypesCommon(op, outTile, tileConf, strategy);
+}
+
+SmallVector<vpux::NDTypeInterface> getTileTypes(mlir::Operation* op, const TileInfo& outTile,
+                                                const std::optional<InputTiling>& inputTiles) {
+    return getTileTypes(op, outTile, inputTiles, getOpStrategy(op));
+}
+
+SmallVector<vpux::NDTypeInterface> getTileTypesForStrategy(mlir::Operation* op, const TileInfo& outTile,
+                                                           VPU::MultiClusterStrategy strategy,
+                                                           const std::optional<InputTiling>& inputTiles) {
+    // The strategy is relevant only for the clustered operations, the others keep the dense tile types
+    if (!mlir::isa<VPU::ClusteredOpInterface>(op)) {
+        return getTileTypes(op, outTile, inputTiles, std::nullopt);
+    }
+    return getTileTypes(op, outTile, inputTiles, strategy);
 }
 
 Byte getRequiredCMXForWeight(VPU::ConvolutionOp convOp, const vpux::TileInfo& tiling,
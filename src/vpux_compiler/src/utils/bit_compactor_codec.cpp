@@ -4,10 +4,12 @@
 //
 
 #include "vpux/compiler/utils/bit_compactor_codec.hpp"
+#include "vpux/compiler/utils/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
 
 using namespace vpux;
 
-vpux::BitCompactorCodec::BitCompactorCodec(VPU::ArchKind arch_kind) {
+vpux::BitCompactorCodec::BitCompactorCodec(VPU::ArchKind arch_kind, mlir::MLIRContext* ctx): ctx_(ctx) {
     switch (arch_kind) {
     case VPU::ArchKind::NPU37XX:
         arch_type_ = vpux::bitc::ArchType::NPU27;
@@ -31,7 +33,16 @@ mlir::FailureOr<std::vector<uint8_t>> vpux::BitCompactorCodec::compress(std::vec
     config.arch_type = arch_type_;
     config.mode_fp16_enable = mode == CompressionMode::FP16;
 
-    vpux::bitc::Encoder encoder{};
+    // Chunks of the input are encoded in parallel, the result doesn't depend on the number of threads
+    vpux::bitc::Encoder::ParallelFor parallelFor;
+    if (ctx_ != nullptr) {
+        parallelFor = [ctx = ctx_](size_t count, const std::function<void(size_t)>& body) {
+            loop_1d(LoopExecPolicy::Parallel, ctx, checked_cast<int64_t>(count), [&](int64_t ind) {
+                body(checked_cast<size_t>(ind));
+            });
+        };
+    }
+    vpux::bitc::Encoder encoder{std::move(parallelFor)};
     std::vector<uint8_t> compressed_data;
 
     try {
@@ -9,14 +9,14 @@
 
 namespace vpux {
 
-std::unique_ptr<ICodec> getBitCompactorCodec(VPU::ArchKind arch) {
-    return std::make_unique<vpux::BitCompactorCodec>(arch);
+std::unique_ptr<ICodec> getBitCompactorCodec(VPU::ArchKind arch, mlir::MLIRContext* ctx) {
+    return std::make_unique<vpux::BitCompactorCodec>(arch, ctx);
 }
 
-std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch) {
+std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch, mlir::MLIRContext* ctx) {
     switch (algo) {
     case ICodec::CompressionAlgorithm::BITCOMPACTOR_CODEC:
-        return getBitCompactorCodec(arch);
+        return getBitCompactorCodec(arch, ctx);
     default:
         VPUX_THROW("vpux::makeCodec: unsupported compression algorithm");
     }
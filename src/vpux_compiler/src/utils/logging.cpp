@@ -5,10 +5,14 @@
 
 #include "vpux/compiler/utils/logging.hpp"
 
+#include <mlir/Dialect/Func/IR/FuncOps.h>
 #include <mlir/IR/Operation.h>
 #include <mlir/Pass/Pass.h>
 #include <mlir/Pass/PassInstrumentation.h>
 
+#include <atomic>
+#include <chrono>
+
 using namespace vpux;
 
 //
@@ -97,6 +101,98 @@ void vpux::addLogging(mlir::PassManager& pm, Logger log) {
     pm.addInstrumentation(std::make_unique<PassLogging>(log));
 }
 
+//
+// PassParallelismReport
+//
+
+namespace {
+
+class PassParallelismReport final : public mlir::PassInstrumentation {
+    using Clock = std::chrono::steady_clock;
+
+public:
+    explicit PassParallelismReport(Logger log): _log(log) {
+    }
+
+    // MLIR doesn't notify the instrumentations about the top-level pipeline, the instrumentation is destroyed
+    // together with the pass manager once the pipeline has run
+    ~PassParallelismReport() override {
+        const auto totalTime = _parallelTime + _serialTime;
+        if (totalTime.count() == 0) {
+            return;
+        }
+
+        const auto toMs = [](Clock::duration duration) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+        };
+        const auto parallelFraction = 100.0 * static_cast<double>(_parallelTime.count()) / totalTime.count();
+
+        _log.info("Parallel fraction {0:F1}% : {1} ms of {2} ms spent in {3} function-nested segments, {4} "
+                  "module-level sync points",
+                  parallelFraction, toMs(_parallelTime), toMs(totalTime), _parallelSegmentsCount, _syncPointsCount);
+    }
+
+    void runBeforePipeline(std::optional<mlir::OperationName> name, const PipelineParentInfo&) final {
+        // Nested pipelines are started per function, possibly from the worker threads
+        if (name.has_value() && name->getStringRef() == mlir::func::FuncOp::getOperationName()) {
+            ++_funcPipelinesCount;
+        }
+    }
+
+    void runBeforePass(mlir::Pass*, mlir::Operation* op) final {
+        if (!isTopLevel(op)) {
+            return;
+        }
+        _passStart = Clock::now();
+        _funcPipelinesBeforePass = _funcPipelinesCount.load();
+    }
+
+    void runAfterPass(mlir::Pass*, mlir::Operation* op) final {
+        if (!isTopLevel(op)) {
+            return;
+        }
+
+        const auto duration = Clock::now() - _passStart;
+        if (_funcPipelinesCount.load() > _funcPipelinesBeforePass) {
+            _parallelTime += duration;
+            ++_parallelSegmentsCount;
+        } else {
+            _serialTime += duration;
+            ++_syncPointsCount;
+        }
+    }
+
+    void runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) final {
+        runAfterPass(pass, op);
+    }
+
+private:
+    static bool isTopLevel(mlir::Operation* op) {
+        return op->getParentOp() == nullptr;
+    }
+
+private:
+    Logger _log;
+
+    std::atomic<size_t> _funcPipelinesCount{0};
+    size_t _funcPipelinesBeforePass = 0;
+    Clock::time_point _passStart;
+
+    Clock::duration _parallelTime{0};
+    Clock::duration _serialTime{0};
+    size_t _parallelSegmentsCount = 0;
+    size_t _syncPointsCount = 0;
+};
+
+}  // namespace
+
+void vpux::addParallelismReport(mlir::PassManager& pm, Logger log) {
+    if (!log.isActive(LogLevel::Info)) {
+        return;
+    }
+    pm.addInstrumentation(std::make_unique<PassParallelismReport>(log.nest("parallelism-report")));
+}
+
 //
 // OpBuilderLogger
 //
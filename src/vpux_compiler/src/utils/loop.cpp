@@ -4,110 +4,102 @@
 //
 
 #include "vpux/compiler/utils/loop.hpp"
-#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/numeric.hpp"
-#include "vpux/utils/core/small_vector.hpp"
 
 #include <mlir/IR/Threading.h>
 #include <mlir/IR/Types.h>
 
+#include <llvm/Support/ThreadPool.h>
+
+#include <atomic>
+
 using namespace vpux;
 
 namespace {
-typedef struct {
-    int64_t begin;
-    int64_t end;
-    bool partition;
-} LoopRange;
-
-SmallVector<LoopRange> partitionData(ArrayRef<int64_t> dims, int64_t availableThreads, int64_t& threadsToUse) {
-    SmallVector<LoopRange> ranges(dims.size());
-
-    std::optional<size_t> partitionIdx;
-    int64_t maxDim = dims[0];
-    int64_t maxDimIdx = 0;
-    for (size_t dimIdx = 0; dimIdx < dims.size(); ++dimIdx) {
-        ranges[dimIdx] = {0, dims[dimIdx], /*partition=*/false};
-        if (!partitionIdx.has_value() && dims[dimIdx] >= availableThreads) {
-            partitionIdx = dimIdx;
-            ranges[dimIdx].partition = true;
-            threadsToUse = availableThreads;
-        }
 
-        if (dims[dimIdx] > maxDim) {
-            maxDim = dims[dimIdx];
-            maxDimIdx = dimIdx;
-        }
-    }
+// Minimal cost of a chunk which amortizes the overhead of claiming it
+constexpr int64_t MIN_CHUNK_COST = 16 * 1024;
 
-    // No dimension is greater than the available number of threads, partition
-    // the largest dimension
-    if (!partitionIdx.has_value()) {
-        ranges[maxDimIdx].partition = true;
-        threadsToUse = dims[maxDimIdx];
-    }
+// Number of chunks per worker, leaves room to rebalance uneven iterations between the workers
+constexpr int64_t CHUNKS_PER_THREAD = 4;
 
-    return ranges;
+bool isSequential(LoopExecPolicy policy, mlir::MLIRContext* ctx) {
+    return !ctx->isMultithreadingEnabled() || policy == LoopExecPolicy::Sequential;
 }
 
-mlir::LogicalResult rangeAdjust(MutableArrayRef<LoopRange> ranges, ArrayRef<int64_t> dims, int64_t threadIdx,
-                                int64_t threadsToUse) {
-    for (size_t idx = 0; idx < ranges.size(); ++idx) {
-        if (!ranges[idx].partition) {
-            continue;
-        }
-        int64_t elementsPerThread = divUp(dims[idx], static_cast<int64_t>(threadsToUse));
+// Calls `body` for consecutive [begin, end) chunks of the [0, numIterations) range.
+// The chunks are claimed dynamically by the pool workers and by the calling thread, the latter
+// makes nested parallel loops safe even when they are started from the pool workers.
+void parallelChunks(mlir::MLIRContext* ctx, int64_t numIterations, int64_t costHint,
+                    FuncRef<void(int64_t, int64_t)> body) {
+    auto& threadPool = ctx->getThreadPool();
+    const auto numThreads = checked_cast<int64_t>(threadPool.getThreadCount());
+    const auto grainSize = details::getLoopGrainSize(numIterations, numThreads, costHint);
+    const auto numChunks = divUp(numIterations, grainSize);
+
+    if (numChunks <= 1) {
+        body(0, numIterations);
+        return;
+    }
 
-        ranges[idx].begin = elementsPerThread * threadIdx;
-        ranges[idx].end = std::min(ranges[idx].begin + elementsPerThread, dims[idx]);
-        if (ranges[idx].begin >= ranges[idx].end) {
-            return mlir::failure();
+    std::atomic<int64_t> nextChunk{0};
+    const auto worker = [&]() {
+        for (auto chunk = nextChunk.fetch_add(1); chunk < numChunks; chunk = nextChunk.fetch_add(1)) {
+            const auto begin = chunk * grainSize;
+            body(begin, std::min(begin + grainSize, numIterations));
         }
+    };
+
+    llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
+    const auto numHelpers = std::min(numThreads, numChunks - 1);
+    for (int64_t helperIdx = 0; helperIdx < numHelpers; ++helperIdx) {
+        tasksGroup.async(worker);
     }
-    return mlir::success();
+
+    worker();
+    tasksGroup.wait();
 }
+
 }  // namespace
 
-void vpux::loop_1d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, vpux::FuncRef<void(int64_t)> func) {
+int64_t vpux::details::getLoopGrainSize(int64_t numIterations, int64_t numThreads, int64_t costHint) {
+    const auto balancedGrainSize = divUp(numIterations, std::max<int64_t>(numThreads, 1) * CHUNKS_PER_THREAD);
+    if (costHint <= LOOP_COST_UNKNOWN) {
+        return std::max<int64_t>(balancedGrainSize, 1);
+    }
+
+    const auto minGrainSize = divUp(MIN_CHUNK_COST, costHint);
+    return std::max<int64_t>({balancedGrainSize, minGrainSize, 1});
+}
+
+void vpux::loop_1d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, vpux::FuncRef<void(int64_t)> func,
+                   int64_t costHint) {
     if (dim0 <= 0) {
         return;
     }
 
-    if (!ctx->isMultithreadingEnabled() || policy == LoopExecPolicy::Sequential) {
+    if (isSequential(policy, ctx)) {
         for (int64_t idxDim0 = 0; idxDim0 < dim0; ++idxDim0) {
             func(idxDim0);
         }
         return;
     }
 
-    auto& threadPool = ctx->getThreadPool();
-    llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
-    const auto availableThreads = threadPool.getThreadCount();
-    SmallVector<int64_t> dims = {dim0};
-
-    int64_t threadsToUse = 0;
-    auto ranges = partitionData(dims, availableThreads, threadsToUse);
-
-    for (int64_t threadIdx = 0; threadIdx < threadsToUse; ++threadIdx) {
-        if (rangeAdjust(ranges, dims, threadIdx, threadsToUse).failed()) {
-            break;
+    parallelChunks(ctx, dim0, costHint, [&](int64_t begin, int64_t end) {
+        for (int64_t idxDim0 = begin; idxDim0 < end; ++idxDim0) {
+            func(idxDim0);
         }
-
-        tasksGroup.async([ranges, func] {
-            for (int64_t idxDim0 = ranges[0].begin; idxDim0 < ranges[0].end; ++idxDim0) {
-                func(idxDim0);
-            }
-        });
-    }
+    });
 }
 
 void vpux::loop_2d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1,
-                   FuncRef<void(int64_t, int64_t)> func) {
+                   FuncRef<void(int64_t, int64_t)> func, int64_t costHint) {
     if (dim0 <= 0 || dim1 <= 0) {
         return;
     }
 
-    if (!ctx->isMultithreadingEnabled() || policy == LoopExecPolicy::Sequential) {
+    if (isSequential(policy, ctx)) {
         for (int64_t idxDim0 = 0; idxDim0 < dim0; ++idxDim0) {
             for (int64_t idxDim1 = 0; idxDim1 < dim1; ++idxDim1) {
                 func(idxDim0, idxDim1);
@@ -116,36 +108,26 @@ void vpux::loop_2d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0,
         return;
     }
 
-    auto& threadPool = ctx->getThreadPool();
-    llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
-    const auto availableThreads = threadPool.getThreadCount();
-    SmallVector<int64_t> dims = {dim0, dim1};
-
-    int64_t threadsToUse = 0;
-    auto ranges = partitionData(dims, availableThreads, threadsToUse);
-
-    for (int64_t threadIdx = 0; threadIdx < threadsToUse; ++threadIdx) {
-        if (rangeAdjust(ranges, dims, threadIdx, threadsToUse).failed()) {
-            break;
-        }
-
-        tasksGroup.async([ranges, func] {
-            for (int64_t idxDim0 = ranges[0].begin; idxDim0 < ranges[0].end; ++idxDim0) {
-                for (int64_t idxDim1 = ranges[1].begin; idxDim1 < ranges[1].end; ++idxDim1) {
-                    func(idxDim0, idxDim1);
-                }
+    parallelChunks(ctx, dim0 * dim1, costHint, [&](int64_t begin, int64_t end) {
+        int64_t idxDim0 = begin / dim1;
+        int64_t idxDim1 = begin % dim1;
+        for (auto idx = begin; idx < end; ++idx) {
+            func(idxDim0, idxDim1);
+            if (++idxDim1 == dim1) {
+                idxDim1 = 0;
+                ++idxDim0;
             }
-        });
-    }
+        }
+    });
 }
 
 void vpux::loop_3d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1, int64_t dim2,
-                   FuncRef<void(int64_t, int64_t, int64_t)> func) {
+                   FuncRef<void(int64_t, int64_t, int64_t)> func, int64_t costHint) {
     if (dim0 <= 0 || dim1 <= 0 || dim2 <= 0) {
         return;
     }
 
-    if (!ctx->isMultithreadingEnabled() || policy == LoopExecPolicy::Sequential) {
+    if (isSequential(policy, ctx)) {
         for (int64_t idxDim0 = 0; idxDim0 < dim0; ++idxDim0) {
             for (int64_t idxDim1 = 0; idxDim1 < dim1; ++idxDim1) {
                 for (int64_t idxDim2 = 0; idxDim2 < dim2; ++idxDim2) {
@@ -156,38 +138,30 @@ void vpux::loop_3d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0,
         return;
     }
 
-    auto& threadPool = ctx->getThreadPool();
-    llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
-    const auto availableThreads = threadPool.getThreadCount();
-    SmallVector<int64_t> dims = {dim0, dim1, dim2};
-
-    int64_t threadsToUse = 0;
-    auto ranges = partitionData(dims, availableThreads, threadsToUse);
-
-    for (int64_t threadIdx = 0; threadIdx < threadsToUse; ++threadIdx) {
-        if (rangeAdjust(ranges, dims, threadIdx, threadsToUse).failed()) {
-            break;
-        }
-
-        tasksGroup.async([ranges, func] {
-            for (int64_t idxDim0 = ranges[0].begin; idxDim0 < ranges[0].end; ++idxDim0) {
-                for (int64_t idxDim1 = ranges[1].begin; idxDim1 < ranges[1].end; ++idxDim1) {
-                    for (int64_t idxDim2 = ranges[2].begin; idxDim2 < ranges[2].end; ++idxDim2) {
-                        func(idxDim0, idxDim1, idxDim2);
-                    }
+    parallelChunks(ctx, dim0 * dim1 * dim2, costHint, [&](int64_t begin, int64_t end) {
+        int64_t idxDim0 = begin / (dim1 * dim2);
+        int64_t idxDim1 = (begin / dim2) % dim1;
+        int64_t idxDim2 = begin % dim2;
+        for (auto idx = begin; idx < end; ++idx) {
+            func(idxDim0, idxDim1, idxDim2);
+            if (++idxDim2 == dim2) {
+                idxDim2 = 0;
+                if (++idxDim1 == dim1) {
+                    idxDim1 = 0;
+                    ++idxDim0;
                 }
             }
-        });
-    }
+        }
+    });
 }
 
 void vpux::loop_4d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1, int64_t dim2,
-                   int64_t dim3, FuncRef<void(int64_t, int64_t, int64_t, int64_t)> func) {
+                   int64_t dim3, FuncRef<void(int64_t, int64_t, int64_t, int64_t)> func, int64_t costHint) {
     if (dim0 <= 0 || dim1 <= 0 || dim2 <= 0 || dim3 <= 0) {
         return;
     }
 
-    if (!ctx->isMultithreadingEnabled() || policy == LoopExecPolicy::Sequential) {
+    if (isSequential(policy, ctx)) {
         for (int64_t idxDim0 = 0; idxDim0 < dim0; ++idxDim0) {
             for (int64_t idxDim1 = 0; idxDim1 < dim1; ++idxDim1) {
                 for (int64_t idxDim2 = 0; idxDim2 < dim2; ++idxDim2) {
@@ -200,29 +174,23 @@ void vpux::loop_4d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0,
         return;
     }
 
-    auto& threadPool = ctx->getThreadPool();
-    llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
-    const auto availableThreads = threadPool.getThreadCount();
-    SmallVector<int64_t> dims = {dim0, dim1, dim2, dim3};
-
-    int64_t threadsToUse = 0;
-    auto ranges = partitionData(dims, availableThreads, threadsToUse);
-
-    for (int64_t threadIdx = 0; threadIdx < threadsToUse; ++threadIdx) {
-        if (rangeAdjust(ranges, dims, threadIdx, threadsToUse).failed()) {
-            break;
-        }
-
-        tasksGroup.async([ranges, func] {
-            for (int64_t idxDim0 = ranges[0].begin; idxDim0 < ranges[0].end; ++idxDim0) {
-                for (int64_t idxDim1 = ranges[1].begin; idxDim1 < ranges[1].end; ++idxDim1) {
-                    for (int64_t idxDim2 = ranges[2].begin; idxDim2 < ranges[2].end; ++idxDim2) {
-                        for (int64_t idxDim3 = ranges[3].begin; idxDim3 < ranges[3].end; ++idxDim3) {
-                            func(idxDim0, idxDim1, idxDim2, idxDim3);
-                        }
+    parallelChunks(ctx, dim0 * dim1 * dim2 * dim3, costHint, [&](int64_t begin, int64_t end) {
+        int64_t idxDim0 = begin / (dim1 * dim2 * dim3);
+        int64_t idxDim1 = (begin / (dim2 * dim3)) % dim1;
+        int64_t idxDim2 = (begin / dim3) % dim2;
+        int64_t idxDim3 = begin % dim3;
+        for (auto idx = begin; idx < end; ++idx) {
+            func(idxDim0, idxDim1, idxDim2, idxDim3);
+            if (++idxDim3 == dim3) {
+                idxDim3 = 0;
+                if (++idxDim2 == dim2) {
+                    idxDim2 = 0;
+                    if (++idxDim1 == dim1) {
+                        idxDim1 = 0;
+                        ++idxDim0;
                     }
                 }
             }
-        });
-    }
+        }
+    });
 }
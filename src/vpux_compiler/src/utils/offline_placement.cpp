@@ -0,0 +1,242 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/offline_placement.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+using namespace vpux;
+
+namespace {
+
+// The local search places the buffers many times, its total number of buffer placements is bounded,
+// so the number of iterations goes down for the large sets of buffers
+constexpr size_t MAX_REFINEMENT_PLACEMENTS = 1 << 18;
+
+// For each buffer, the buffers which are alive at the same time. The live ranges are swept by their begin,
+// so the cost depends on the number of overlapping pairs rather than on the square of the number of buffers
+SmallVector<SmallVector<size_t>> getTimeOverlaps(ArrayRef<OfflinePlacement::Buffer> buffers) {
+    SmallVector<size_t> byBegin(buffers.size());
+    std::iota(byBegin.begin(), byBegin.end(), 0);
+    llvm::stable_sort(byBegin, [&](size_t ind1, size_t ind2) {
+        return buffers[ind1].begin < buffers[ind2].begin;
+    });
+
+    SmallVector<SmallVector<size_t>> overlaps(buffers.size());
+    SmallVector<size_t> alive;
+    for (auto ind : byBegin) {
+        const auto& buf = buffers[ind];
+        llvm::erase_if(alive, [&](size_t aliveInd) {
+            return buffers[aliveInd].end <= buf.begin;
+        });
+        for (auto aliveInd : alive) {
+            overlaps[ind].push_back(aliveInd);
+            overlaps[aliveInd].push_back(ind);
+        }
+        alive.push_back(ind);
+    }
+    return overlaps;
+}
+
+AddressType getAlignedEnd(const OfflinePlacement::Buffer& buf, AddressType address) {
+    return alignValUp<AddressType>(address + buf.size, buf.alignment);
+}
+
+AddressType getPeakUsage(ArrayRef<OfflinePlacement::Buffer> buffers, ArrayRef<AddressType> addresses) {
+    AddressType peakUsage = 0;
+    for (auto ind : irange(buffers.size())) {
+        peakUsage = std::max(peakUsage, getAlignedEnd(buffers[ind], addresses[ind]));
+    }
+    return peakUsage;
+}
+
+// Index of the buffer which defines the peak usage
+size_t getPeakBuffer(ArrayRef<OfflinePlacement::Buffer> buffers, ArrayRef<AddressType> addresses) {
+    size_t peakInd = 0;
+    for (auto ind : irange(buffers.size())) {
+        if (getAlignedEnd(buffers[ind], addresses[ind]) > getAlignedEnd(buffers[peakInd], addresses[peakInd])) {
+            peakInd = ind;
+        }
+    }
+    return peakInd;
+}
+
+}  // namespace
+
+vpux::OfflinePlacement::OfflinePlacement(AddressType totalSize,
+                                         ArrayRef<std::pair<AddressType, AddressType>> reserved)
+        : _totalSize(totalSize), _reserved(reserved.begin(), reserved.end()) {
+    VPUX_THROW_UNLESS(_totalSize > 0, "Memory size must be positive");
+}
+
+std::optional<SmallVector<AddressType>> vpux::OfflinePlacement::placeInOrder(
+        ArrayRef<Buffer> buffers, ArrayRef<SmallVector<size_t>> overlaps, ArrayRef<size_t> order) const {
+    SmallVector<AddressType> addresses(buffers.size(), InvalidAddress);
+    for (auto ind : irange(buffers.size())) {
+        if (buffers[ind].fixedAddress.has_value()) {
+            addresses[ind] = buffers[ind].fixedAddress.value();
+        }
+    }
+
+    // [begin, end) address ranges occupied during the live range of the current buffer
+    SmallVector<std::pair<AddressType, AddressType>> occupied;
+    for (auto ind : order) {
+        const auto& buf = buffers[ind];
+
+        occupied.clear();
+        for (const auto& [address, size] : _reserved) {
+            occupied.emplace_back(address, address + size);
+        }
+        for (auto otherInd : overlaps[ind]) {
+            if (addresses[otherInd] != InvalidAddress) {
+                occupied.emplace_back(addresses[otherInd], addresses[otherInd] + buffers[otherInd].size);
+            }
+        }
+        llvm::sort(occupied);
+
+        // Best fit: the smallest gap between the occupied ranges, the lowest one among the gaps of the same size.
+        // The space above all the occupied ranges has the lowest priority
+        auto bestAddress = InvalidAddress;
+        auto bestGapSize = std::numeric_limits<AddressType>::max();
+        const auto tryGap = [&](AddressType gapBegin, AddressType gapEnd) {
+            const auto alignedBegin = alignValUp<AddressType>(gapBegin, buf.alignment);
+            if (alignedBegin + buf.size > gapEnd || gapEnd - gapBegin >= bestGapSize) {
+                return;
+            }
+            bestAddress = alignedBegin;
+            bestGapSize = gapEnd - gapBegin;
+        };
+
+        AddressType gapBegin = 0;
+        for (const auto& [rangeBegin, rangeEnd] : occupied) {
+            if (rangeBegin > gapBegin) {
+                tryGap(gapBegin, rangeBegin);
+            }
+            gapBegin = std::max(gapBegin, rangeEnd);
+        }
+        if (bestAddress == InvalidAddress && gapBegin < _totalSize) {
+            tryGap(gapBegin, _totalSize);
+        }
+
+        if (bestAddress == InvalidAddress) {
+            return std::nullopt;
+        }
+        addresses[ind] = bestAddress;
+    }
+
+    return addresses;
+}
+
+std::optional<SmallVector<AddressType>> vpux::OfflinePlacement::place(ArrayRef<Buffer> buffers,
+                                                                      size_t maxIterations) const {
+    for (const auto& buf : buffers) {
+        VPUX_THROW_UNLESS(buf.size > 0 && buf.alignment > 0 && buf.begin < buf.end,
+                          "Invalid buffer: size {0}, alignment {1}, live range [{2}, {3})", buf.size, buf.alignment,
+                          buf.begin, buf.end);
+    }
+
+    // Best fit decreasing: large and long living buffers first, they are the hardest to place
+    SmallVector<size_t> order;
+    for (auto ind : irange(buffers.size())) {
+        if (!buffers[ind].fixedAddress.has_value()) {
+            order.push_back(ind);
+        }
+    }
+    llvm::stable_sort(order, [&](size_t ind1, size_t ind2) {
+        const auto& buf1 = buffers[ind1];
+        const auto& buf2 = buffers[ind2];
+        if (buf1.size != buf2.size) {
+            return buf1.size > buf2.size;
+        }
+        return buf1.end - buf1.begin > buf2.end - buf2.begin;
+    });
+
+    const auto overlaps = getTimeOverlaps(buffers);
+    auto bestAddresses = placeInOrder(buffers, overlaps, order);
+    if (!bestAddresses.has_value() || order.size() < 2) {
+        return bestAddresses;
+    }
+    auto bestPeakUsage = getPeakUsage(buffers, bestAddresses.value());
+
+    // Local search over the placement order. The buffer which defines the peak is moved ahead,
+    // so it's placed before the buffers which pushed it up, every other move swaps two random buffers.
+    // The generator is seeded with a constant to keep the compilation reproducible
+    std::mt19937 generator(1);
+    const auto numIterations = std::min(maxIterations, MAX_REFINEMENT_PLACEMENTS / order.size());
+    for (auto iteration : irange(numIterations)) {
+        auto candidateOrder = order;
+        if (iteration % 2 == 0) {
+            const auto peakInd = getPeakBuffer(buffers, bestAddresses.value());
+            const auto peakPos = std::find(candidateOrder.begin(), candidateOrder.end(), peakInd);
+            if (peakPos == candidateOrder.begin() || peakPos == candidateOrder.end()) {
+                continue;
+            }
+            const auto shift = 1 + generator() % static_cast<size_t>(peakPos - candidateOrder.begin());
+            std::rotate(peakPos - shift, peakPos, peakPos + 1);
+        } else {
+            const auto pos1 = generator() % candidateOrder.size();
+            const auto pos2 = generator() % candidateOrder.size();
+            std::swap(candidateOrder[pos1], candidateOrder[pos2]);
+        }
+
+        auto candidateAddresses = placeInOrder(buffers, overlaps, candidateOrder);
+        if (!candidateAddresses.has_value()) {
+            continue;
+        }
+        const auto candidatePeakUsage = getPeakUsage(buffers, candidateAddresses.value());
+        if (candidatePeakUsage < bestPeakUsage) {
+            bestPeakUsage = candidatePeakUsage;
+            bestAddresses = std::move(candidateAddresses);
+            order = std::move(candidateOrder);
+        }
+    }
+
+    return bestAddresses;
+}
+
+OfflinePlacement::Statistics vpux::OfflinePlacement::getStatistics(ArrayRef<Buffer> buffers,
+                                                                   ArrayRef<AddressType> addresses) {
+    VPUX_THROW_UNLESS(buffers.size() == addresses.size(), "Got {0} addresses for {1} buffers", addresses.size(),
+                      buffers.size());
+
+    Statistics statistics;
+    statistics.peakUsage = getPeakUsage(buffers, addresses);
+
+    size_t numSteps = 0;
+    for (const auto& buf : buffers) {
+        numSteps = std::max(numSteps, buf.end);
+    }
+
+    SmallVector<AddressType> liveSize(numSteps, 0);
+    SmallVector<AddressType> highWater(numSteps, 0);
+    for (auto ind : irange(buffers.size())) {
+        const auto& buf = buffers[ind];
+        for (auto step : irange(buf.begin, buf.end)) {
+            liveSize[step] += buf.size;
+            highWater[step] = std::max(highWater[step], addresses[ind] + buf.size);
+        }
+    }
+
+    size_t numAliveSteps = 0;
+    double fragmentationSum = 0.0;
+    for (auto step : irange(numSteps)) {
+        if (highWater[step] == 0) {
+            continue;
+        }
+        ++numAliveSteps;
+        const auto unusedSize = highWater[step] - liveSize[step];
+        fragmentationSum += static_cast<double>(unusedSize) / static_cast<double>(highWater[step]);
+    }
+    statistics.fragmentation = numAliveSteps == 0 ? 0.0 : fragmentationSum / static_cast<double>(numAliveSteps);
+
+    return statistics;
+}
@@ -5,12 +5,16 @@
 
 #include "vpux/compiler/utils/partitioner.hpp"
 
+#include "vpux/compiler/core/developer_build_utils.hpp"
+
+#include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/helper_macros.hpp"
 #include "vpux/utils/core/numeric.hpp"
 
 #include <algorithm>
 #include <limits>
 #include <numeric>
+#include <optional>
 #include <vector>
 
 #include <cassert>
@@ -66,9 +70,29 @@ private:
 
 }  // namespace
 
-vpux::Partitioner::Partitioner(AddressType totalSize): _totalSize(totalSize) {
+vpux::Partitioner::Partitioner(AddressType totalSize, Backend backend): _totalSize(totalSize), _backend(backend) {
     assert(_totalSize > 0);
-    _gaps.push_back({0, _totalSize});
+    if (_backend == Backend::Linear) {
+        _gaps.push_back({0, _totalSize});
+    } else {
+        insertIndexedGap(0, _totalSize);
+    }
+}
+
+Partitioner::Backend vpux::Partitioner::getDefaultBackend() {
+    static const auto defaultBackend = []() {
+        std::string backendName;
+#if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+        parseEnv("IE_NPU_PARTITIONER_BACKEND", backendName);
+#endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
+
+        if (backendName.empty() || backendName == "linear") {
+            return Backend::Linear;
+        }
+        VPUX_THROW_UNLESS(backendName == "indexed", "Unsupported partitioner backend '{0}'", backendName);
+        return Backend::Indexed;
+    }();
+    return defaultBackend;
 }
 
 AddressType vpux::Partitioner::alloc(AddressType size, AddressType alignment, Direction dir) {
@@ -77,6 +101,9 @@ AddressType vpux::Partitioner::alloc(AddressType size, AddressType alignment, Di
 
     const PartitionerValidator v(*this);
 
+    if (_backend == Backend::Indexed) {
+        return chooseMinimalIndexedGap(size, alignment, dir);
+    }
     return chooseMinimalGap(size, alignment, dir);
 }
 
@@ -84,10 +111,19 @@ void vpux::Partitioner::allocFixed(AddressType addr, AddressType size) {
     assert(addr != InvalidAddress);
     assert(size > 0);
     assert(addr + size <= _totalSize);
-    assert(!_gaps.empty());
 
     const PartitionerValidator v(*this);
 
+    if (_backend == Backend::Indexed) {
+        allocFixedIndexed(addr, size);
+    } else {
+        allocFixedLinear(addr, size);
+    }
+}
+
+void vpux::Partitioner::allocFixedLinear(AddressType addr, AddressType size) {
+    assert(!_gaps.empty());
+
     auto it = std::lower_bound(_gaps.begin(), _gaps.end(), Gap{addr, 0}, [](const Gap& g1, const Gap& g2) {
         return g1.begin < g2.begin;
     });
@@ -135,6 +171,14 @@ void vpux::Partitioner::free(AddressType addr, AddressType size) {
 
     v.checkNewGap(addr, size);
 
+    if (_backend == Backend::Indexed) {
+        freeIndexed(addr, size);
+    } else {
+        freeLinear(addr, size);
+    }
+}
+
+void vpux::Partitioner::freeLinear(AddressType addr, AddressType size) {
     const auto end = addr + size;
     if (_gaps.empty()) {
         _gaps.push_back(Gap{addr, end});
@@ -203,20 +247,41 @@ void vpux::Partitioner::free(AddressType addr, AddressType size) {
 }
 
 AddressType vpux::Partitioner::totalFreeSize() const {
+    if (_backend == Backend::Indexed) {
+        return _freeSize;
+    }
     return std::accumulate(_gaps.begin(), _gaps.end(), AddressType{0}, [](AddressType res, const Gap& g) {
         return res + g.size();
     });
 }
 
 AddressType vpux::Partitioner::maxFreeSize() const {
+    if (_backend == Backend::Indexed) {
+        return _gapsBySize.empty() ? 0 : _gapsBySize.rbegin()->first;
+    }
     return std::accumulate(_gaps.begin(), _gaps.end(), AddressType{0}, [](AddressType res, const Gap& g) {
         return std::max(res, g.size());
     });
 }
 
-AddressType vpux::Partitioner::getAddrFromGap(size_t pos, AddressType size, AddressType alignment, Direction dir) {
-    const auto& g = _gaps[pos];
+size_t vpux::Partitioner::numGaps() const {
+    return _backend == Backend::Indexed ? _gapsByBegin.size() : _gaps.size();
+}
+
+std::vector<Partitioner::Gap> vpux::Partitioner::gaps() const {
+    if (_backend == Backend::Linear) {
+        return _gaps;
+    }
 
+    std::vector<Gap> gaps;
+    gaps.reserve(_gapsByBegin.size());
+    for (const auto& [begin, end] : _gapsByBegin) {
+        gaps.push_back(Gap{begin, end});
+    }
+    return gaps;
+}
+
+AddressType vpux::Partitioner::getAddrFromGap(const Gap& g, AddressType size, AddressType alignment, Direction dir) {
     if (g.size() < size) {
         return InvalidAddress;
     }
@@ -287,7 +352,7 @@ AddressType vpux::Partitioner::chooseMinimalGap(AddressType size, AddressType al
 
     if (dir == Direction::Up) {
         for (size_t i = 0; i < numGaps - 1; ++i) {
-            const auto alignedBegin = getAddrFromGap(i, size, alignment, dir);
+            const auto alignedBegin = getAddrFromGap(_gaps[i], size, alignment, dir);
             if (alignedBegin != InvalidAddress) {
                 if (_gaps[i].size() < minGapSize) {
                     minGapInd = static_cast<int>(i);
@@ -297,14 +362,14 @@ AddressType vpux::Partitioner::chooseMinimalGap(AddressType size, AddressType al
         }
 
         if (minGapInd == -1) {
-            const auto alignedBegin = getAddrFromGap(numGaps - 1, size, alignment, dir);
+            const auto alignedBegin = getAddrFromGap(_gaps[numGaps - 1], size, alignment, dir);
             if (alignedBegin != InvalidAddress) {
                 minGapInd = static_cast<int>(numGaps - 1);
             }
         }
     } else {
         for (size_t i = numGaps - 1; i >= 1; --i) {
-            const auto alignedBegin = getAddrFromGap(i, size, alignment, dir);
+            const auto alignedBegin = getAddrFromGap(_gaps[i], size, alignment, dir);
             if (alignedBegin != InvalidAddress) {
                 if (_gaps[i].size() < minGapSize) {
                     minGapInd = static_cast<int>(i);
@@ -314,7 +379,7 @@ AddressType vpux::Partitioner::chooseMinimalGap(AddressType size, AddressType al
         }
 
         if (minGapInd == -1) {
-            const auto alignedBegin = getAddrFromGap(0, size, alignment, dir);
+            const auto alignedBegin = getAddrFromGap(_gaps[0], size, alignment, dir);
             if (alignedBegin != InvalidAddress) {
                 minGapInd = 0;
             }
@@ -322,13 +387,127 @@ AddressType vpux::Partitioner::chooseMinimalGap(AddressType size, AddressType al
     }
 
     if (minGapInd != -1) {
-        const auto alignedBegin = getAddrFromGap(static_cast<size_t>(minGapInd), size, alignment, dir);
+        const auto alignedBegin = getAddrFromGap(_gaps[static_cast<size_t>(minGapInd)], size, alignment, dir);
         return useGap(static_cast<size_t>(minGapInd), alignedBegin, size);
     }
 
     return InvalidAddress;
 }
 
+//
+// Indexed backend
+//
+
+void vpux::Partitioner::insertIndexedGap(AddressType begin, AddressType end) {
+    assert(end > begin);
+    _gapsByBegin.emplace(begin, end);
+    _gapsBySize.emplace(end - begin, begin);
+    _freeSize += end - begin;
+}
+
+void vpux::Partitioner::eraseIndexedGap(AddressType begin, AddressType end) {
+    assert(end > begin);
+    _gapsByBegin.erase(begin);
+    _gapsBySize.erase({end - begin, begin});
+    _freeSize -= end - begin;
+}
+
+AddressType vpux::Partitioner::useIndexedGap(const Gap& g, AddressType alignedBegin, AddressType size) {
+    assert(alignedBegin >= g.begin);
+    assert(alignedBegin + size <= g.end);
+
+    const auto gap = g;
+    eraseIndexedGap(gap.begin, gap.end);
+    if (alignedBegin > gap.begin) {
+        insertIndexedGap(gap.begin, alignedBegin);
+    }
+    if (alignedBegin + size < gap.end) {
+        insertIndexedGap(alignedBegin + size, gap.end);
+    }
+
+    return alignedBegin;
+}
+
+AddressType vpux::Partitioner::chooseMinimalIndexedGap(AddressType size, AddressType alignment, Direction dir) {
+    if (_gapsByBegin.empty()) {
+        return InvalidAddress;
+    }
+
+    // Same choice as the linear scan: the smallest suitable gap, the first one in current direction
+    // among the gaps of the same size. The last gap in current direction has the lowest priority
+    const auto lastGapBegin = dir == Direction::Up ? _gapsByBegin.rbegin()->first : _gapsByBegin.begin()->first;
+
+    std::optional<Gap> minGap;
+    for (auto it = _gapsBySize.lower_bound({size, 0}); it != _gapsBySize.end(); ++it) {
+        const auto [gapSize, gapBegin] = *it;
+        if (minGap.has_value() && gapSize != minGap->size()) {
+            break;
+        }
+        if (gapBegin == lastGapBegin) {
+            continue;
+        }
+
+        const Gap gap{gapBegin, gapBegin + gapSize};
+        if (getAddrFromGap(gap, size, alignment, dir) == InvalidAddress) {
+            continue;
+        }
+
+        minGap = gap;
+        if (dir == Direction::Up) {
+            // the gaps of the same size are ordered by address
+            break;
+        }
+    }
+
+    if (!minGap.has_value()) {
+        const Gap lastGap{lastGapBegin, _gapsByBegin.at(lastGapBegin)};
+        if (getAddrFromGap(lastGap, size, alignment, dir) == InvalidAddress) {
+            return InvalidAddress;
+        }
+        minGap = lastGap;
+    }
+
+    const auto alignedBegin = getAddrFromGap(minGap.value(), size, alignment, dir);
+    return useIndexedGap(minGap.value(), alignedBegin, size);
+}
+
+void vpux::Partitioner::allocFixedIndexed(AddressType addr, AddressType size) {
+    assert(!_gapsByBegin.empty());
+
+    auto it = _gapsByBegin.upper_bound(addr);
+    assert(it != _gapsByBegin.begin());
+    --it;
+
+    const Gap gap{it->first, it->second};
+    assert(gap.begin <= addr);
+    assert(gap.end >= addr + size);  // client is aware of this demand
+
+    useIndexedGap(gap, addr, size);
+}
+
+void vpux::Partitioner::freeIndexed(AddressType addr, AddressType size) {
+    auto begin = addr;
+    auto end = addr + size;
+
+    const auto next = _gapsByBegin.lower_bound(addr);
+    if (next != _gapsByBegin.begin()) {
+        const auto prev = std::prev(next);
+        assert(prev->second <= addr);
+        if (prev->second == addr) {
+            begin = prev->first;
+            eraseIndexedGap(prev->first, prev->second);
+        }
+    }
+
+    const auto following = _gapsByBegin.find(end);
+    if (following != _gapsByBegin.end()) {
+        end = following->second;
+        eraseIndexedGap(following->first, following->second);
+    }
+
+    insertIndexedGap(begin, end);
+}
+
 bool vpux::Partitioner::intersects(AddressType addr1, AddressType size1, AddressType addr2, AddressType size2) {
     assert(size1 > 0);
     assert(size2 > 0);
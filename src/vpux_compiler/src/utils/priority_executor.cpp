@@ -0,0 +1,331 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/priority_executor.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <tuple>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+using namespace vpux;
+
+namespace {
+
+// Switches the calling thread to the lowest scheduling priority, so that it gets CPU time only when no other
+// thread of the system is ready to run. Returns false if this is not supported or not permitted.
+bool lowerCurrentThreadPriority() {
+#if defined(__linux__)
+    sched_param param{};
+    param.sched_priority = 0;
+    return pthread_setschedparam(pthread_self(), SCHED_IDLE, &param) == 0;
+#elif defined(_WIN32)
+    return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_IDLE) != 0;
+#else
+    return false;
+#endif
+}
+
+// Restores the normal scheduling priority of the thread
+bool raiseThreadPriority(std::thread::native_handle_type thread) {
+#if defined(__linux__)
+    sched_param param{};
+    param.sched_priority = 0;
+    return pthread_setschedparam(thread, SCHED_OTHER, &param) == 0;
+#elif defined(_WIN32)
+    return SetThreadPriority(thread, THREAD_PRIORITY_NORMAL) != 0;
+#else
+    std::ignore = thread;
+    return false;
+#endif
+}
+
+std::thread::native_handle_type getCurrentThreadHandle() {
+#if defined(__linux__)
+    return pthread_self();
+#elif defined(_WIN32)
+    return GetCurrentThread();
+#else
+    return std::thread::native_handle_type{};
+#endif
+}
+
+// Unprivileged threads are not always allowed to leave the idle priority (e.g. on Linux it depends on RLIMIT_NICE),
+// so the round trip is checked on a short-lived thread before the workers lower their priority
+bool canRevertIdlePriority() {
+    bool result = false;
+    std::thread probe([&]() {
+        result = lowerCurrentThreadPriority() && raiseThreadPriority(getCurrentThreadHandle());
+    });
+    probe.join();
+    return result;
+}
+
+}  // namespace
+
+//
+// PriorityExecutor
+//
+
+vpux::PriorityExecutor::PriorityExecutor(size_t numThreads, size_t maxNormalPriorityTasks, Logger log)
+        : _log(log), _maxNormalPriorityTasks(maxNormalPriorityTasks) {
+    VPUX_THROW_UNLESS(numThreads > 0, "PriorityExecutor requires at least one worker thread");
+    VPUX_THROW_UNLESS(maxNormalPriorityTasks > 0, "PriorityExecutor requires at least one normal priority task slot");
+
+    _useIdlePriority = canRevertIdlePriority();
+    if (!_useIdlePriority) {
+        static std::once_flag fallbackLogged;
+        std::call_once(fallbackLogged, [&]() {
+            _log.info("Idle thread priority is not available, background tasks run with the normal priority on all "
+                      "{0} workers and yield the core between tasks",
+                      numThreads);
+        });
+    }
+    _boostedWorkers.resize(numThreads, false);
+
+    _workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        _workers.emplace_back([this, i]() {
+            workerLoop(i);
+        });
+    }
+}
+
+vpux::PriorityExecutor::~PriorityExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _statistics.numCanceledTasks += _foregroundQueue.size() + _backgroundQueue.size();
+        _foregroundQueue.clear();
+        _backgroundQueue.clear();
+        _stopped = true;
+    }
+    _taskAvailable.notify_all();
+    _taskFinished.notify_all();
+
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+PriorityExecutor::TaskId vpux::PriorityExecutor::submit(std::function<void()> task, TaskPriority priority) {
+    TaskId id = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        VPUX_THROW_WHEN(_stopped, "Cannot submit a task to a stopped PriorityExecutor");
+
+        id = _nextTaskId++;
+        auto& queue = priority == TaskPriority::Foreground ? _foregroundQueue : _backgroundQueue;
+        queue.push_back(Task{id, priority, std::move(task), std::chrono::steady_clock::now()});
+
+        if (priority == TaskPriority::Foreground) {
+            ++_statistics.numForegroundTasks;
+        } else {
+            ++_statistics.numBackgroundTasks;
+        }
+        _statistics.maxQueueDepth =
+                std::max(_statistics.maxQueueDepth, _foregroundQueue.size() + _backgroundQueue.size());
+    }
+    _taskAvailable.notify_one();
+    return id;
+}
+
+bool vpux::PriorityExecutor::promote(TaskId id) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        Task task;
+        if (!extractQueuedTask(_backgroundQueue, id, task)) {
+            return false;
+        }
+
+        task.priority = TaskPriority::Foreground;
+        _foregroundQueue.push_back(std::move(task));
+        ++_statistics.numPromotedTasks;
+    }
+    _taskAvailable.notify_one();
+    return true;
+}
+
+void vpux::PriorityExecutor::runOrWait(TaskId id) {
+    Task task;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!extractQueuedTask(_foregroundQueue, id, task) && !extractQueuedTask(_backgroundQueue, id, task)) {
+            const auto runningTask = _runningTasks.find(id);
+            if (runningTask != _runningTasks.end() && runningTask->second.has_value()) {
+                boostWorker(runningTask->second.value());
+            }
+
+            _taskFinished.wait(lock, [&]() {
+                return _stopped || _runningTasks.count(id) == 0;
+            });
+            return;
+        }
+
+        task.priority = TaskPriority::Foreground;
+        _runningTasks.emplace(task.id, std::nullopt);
+        ++_statistics.numTasksRunByWaiter;
+        updateWaitTime(task);
+    }
+
+    // The caller is blocked on the result anyway, so the task is executed with the caller's priority instead of
+    // waiting for a worker
+    runTask(task);
+    finishTask(task, /*idleWorkerIndex=*/std::nullopt);
+}
+
+void vpux::PriorityExecutor::cancelPending() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _statistics.numCanceledTasks += _foregroundQueue.size() + _backgroundQueue.size();
+    _foregroundQueue.clear();
+    _backgroundQueue.clear();
+
+    _taskFinished.wait(lock, [&]() {
+        return _runningTasks.empty();
+    });
+}
+
+size_t vpux::PriorityExecutor::getQueueDepth() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _foregroundQueue.size() + _backgroundQueue.size();
+}
+
+size_t vpux::PriorityExecutor::getNumIdlePriorityWorkers() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _numIdlePriorityWorkers;
+}
+
+PriorityExecutor::Statistics vpux::PriorityExecutor::getStatistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _statistics;
+}
+
+void vpux::PriorityExecutor::workerLoop(size_t workerIndex) {
+    const auto isIdlePriorityWorker = _useIdlePriority && lowerCurrentThreadPriority();
+    if (isIdlePriorityWorker) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_numIdlePriorityWorkers;
+    }
+
+    const auto idleWorkerIndex = isIdlePriorityWorker ? std::optional<size_t>(workerIndex) : std::nullopt;
+
+    Task task;
+    while (popTask(task, workerIndex, isIdlePriorityWorker)) {
+        runTask(task);
+        if (finishTask(task, idleWorkerIndex)) {
+            // The priority was raised for a waiter of the finished task only, the next one is not claimed yet
+            if (!lowerCurrentThreadPriority()) {
+                _log.warning("Failed to restore the idle priority of worker {0}", workerIndex);
+            }
+        }
+
+        // Without the idle priority the background tasks are not preempted by the foreground work of the process,
+        // so the core is offered to the other ready threads before the next task is claimed
+        if (!_useIdlePriority && task.priority == TaskPriority::Background) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool vpux::PriorityExecutor::popTask(Task& task, size_t workerIndex, bool isIdlePriorityWorker) {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Background tasks on a normal priority worker compete with the foreground work of the process for the cores,
+    // so their number is limited when the other workers can take them at the idle priority. If the idle priority
+    // is not available at all, every worker takes them to use the full width of the machine
+    const auto canRunBackgroundTask = [&]() {
+        return isIdlePriorityWorker || !_useIdlePriority ||
+               _numNormalPriorityBackgroundTasks < _maxNormalPriorityTasks;
+    };
+    _taskAvailable.wait(lock, [&]() {
+        return _stopped || !_foregroundQueue.empty() || (!_backgroundQueue.empty() && canRunBackgroundTask());
+    });
+    if (_stopped) {
+        return false;
+    }
+
+    auto& queue = !_foregroundQueue.empty() ? _foregroundQueue : _backgroundQueue;
+    task = std::move(queue.front());
+    queue.pop_front();
+
+    if (task.priority == TaskPriority::Background && !isIdlePriorityWorker) {
+        ++_numNormalPriorityBackgroundTasks;
+    }
+    _runningTasks.emplace(task.id, isIdlePriorityWorker ? std::optional<size_t>(workerIndex) : std::nullopt);
+    updateWaitTime(task);
+    return true;
+}
+
+void vpux::PriorityExecutor::runTask(const Task& task) {
+    try {
+        task.func();
+    } catch (const std::exception& e) {
+        _log.error("Task {0} failed: {1}", task.id, e.what());
+    } catch (...) {
+        _log.error("Task {0} failed with unknown exception", task.id);
+    }
+}
+
+bool vpux::PriorityExecutor::finishTask(const Task& task, std::optional<size_t> idleWorkerIndex) {
+    bool wasBoosted = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _runningTasks.erase(task.id);
+        if (task.priority == TaskPriority::Background && !idleWorkerIndex.has_value()) {
+            --_numNormalPriorityBackgroundTasks;
+        }
+        if (idleWorkerIndex.has_value()) {
+            wasBoosted = _boostedWorkers[idleWorkerIndex.value()];
+            _boostedWorkers[idleWorkerIndex.value()] = false;
+        }
+    }
+    _taskFinished.notify_all();
+    _taskAvailable.notify_one();
+    return wasBoosted;
+}
+
+// Must be called with the mutex locked
+void vpux::PriorityExecutor::boostWorker(size_t workerIndex) {
+    if (_boostedWorkers[workerIndex]) {
+        return;
+    }
+
+    if (!raiseThreadPriority(_workers[workerIndex].native_handle())) {
+        _log.warning("Failed to raise the priority of worker {0}", workerIndex);
+        return;
+    }
+
+    _boostedWorkers[workerIndex] = true;
+    ++_statistics.numBoostedTasks;
+}
+
+void vpux::PriorityExecutor::updateWaitTime(const Task& task) {
+    const auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                task.submitTime);
+    _statistics.totalWaitTime += waitTime;
+    _statistics.maxWaitTime = std::max(_statistics.maxWaitTime, waitTime);
+}
+
+bool vpux::PriorityExecutor::extractQueuedTask(std::deque<Task>& queue, TaskId id, Task& task) {
+    const auto it = std::find_if(queue.begin(), queue.end(), [&](const Task& queuedTask) {
+        return queuedTask.id == id;
+    });
+    if (it == queue.end()) {
+        return false;
+    }
+
+    task = std::move(*it);
+    queue.erase(it);
+    return true;
+}
@@ -12,6 +12,7 @@
 #include "vpux/utils/core/small_vector.hpp"
 #include "vpux/utils/core/string_ref.hpp"
 
+#include <mutex>
 #include <string>
 
 namespace intel_npu {
@@ -21,6 +22,7 @@ public:
     struct InferenceManagerDemo;
 
     IMDExecutor(const std::string_view, const std::shared_ptr<const NetworkDescription>& network, const Config& config);
+    ~IMDExecutor();
 
     std::shared_ptr<const NetworkDescription>& getNetworkDesc() {
         return _network;
@@ -30,6 +32,9 @@ public:
         return _app;
     }
 
+    // The compiled model is stored on the first call only, all the infer requests share the same file
+    const std::string& getCompiledModelPath();
+
     struct InferenceManagerDemo final {
         std::string elfFile;
         std::string runProgram;
@@ -56,6 +61,10 @@ private:
     vpux::Logger _log;
 
     InferenceManagerDemo _app;
+
+    std::once_flag _compiledModelStored;
+    vpux::SmallString _compiledModelDirectory;
+    std::string _compiledModelPath;
 };
 
 }  // namespace intel_npu
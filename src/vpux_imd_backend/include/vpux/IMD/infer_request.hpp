@@ -21,6 +21,7 @@ class IMDInferRequest final : public SyncInferRequest {
 public:
     explicit IMDInferRequest(const std::shared_ptr<const ICompiledModel>& compiledModel,
                              const std::shared_ptr<IExecutor>& executor, const Config& config);
+    ~IMDInferRequest();
 
     void infer() override;
     void infer_async() override;
@@ -34,7 +35,8 @@ private:
     std::vector<uint8_t> get_raw_profiling_data() const;
 
     vpux::SmallString create_temporary_work_directory();
-    void store_compiled_model();
+    void link_compiled_model();
+    void remove_network_outputs();
     void store_network_inputs();
     void run_app();
     void read_from_file(const std::string& path, const std::shared_ptr<ov::ITensor>& tensor,
@@ -281,4 +281,41 @@ IMDExecutor::IMDExecutor(const std::string_view platform, const std::shared_ptr<
     parseAppConfig(ov::intel_npu::Platform::standardize(platform), config);
 }
 
+IMDExecutor::~IMDExecutor() {
+    if (_compiledModelDirectory.empty()) {
+        return;
+    }
+
+    const auto errc = llvm::sys::fs::remove_directories(_compiledModelDirectory);
+    if (errc) {
+        _log.error("Failed to remove compiled model directory : {0}", errc.message());
+    }
+}
+
+//
+// getCompiledModelPath
+//
+
+const std::string& IMDExecutor::getCompiledModelPath() {
+    std::call_once(_compiledModelStored, [&]() {
+        _log.trace("Store the compiled model");
+
+        const auto errc = llvm::sys::fs::createUniqueDirectory("vpux-IMD-model", _compiledModelDirectory);
+        VPUX_THROW_WHEN(errc, "Failed to create compiled model directory : {0}", errc.message());
+
+        const auto modelFilePath = printToString("{0}/vpuip.blob", _compiledModelDirectory.str());
+        std::ofstream file(modelFilePath, std::ios::binary);
+        VPUX_THROW_UNLESS(file.is_open(), "Can't open file '{0}' for write", modelFilePath);
+
+        const auto& compiledModel = _network->compiledNetwork;
+        file.write(reinterpret_cast<const char*>(compiledModel.data()), compiledModel.size());
+        VPUX_THROW_UNLESS(file.good(), "Failed to write the compiled model to '{0}'", modelFilePath);
+
+        _compiledModelPath = modelFilePath;
+        _log.nest().trace("{0}", _compiledModelPath);
+    });
+
+    return _compiledModelPath;
+}
+
 }  // namespace intel_npu
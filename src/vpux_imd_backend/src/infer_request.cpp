@@ -21,9 +21,9 @@
 #include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/format.hpp"
 #include "vpux/utils/core/range.hpp"
-#include "vpux/utils/core/scope_exit.hpp"
 
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/Program.h>
 
 using vpux::printToString;
@@ -68,13 +68,30 @@ void IMDInferRequest::infer() {
     get_result();
 }
 
+IMDInferRequest::~IMDInferRequest() {
+    if (_workDirectory.empty()) {
+        return;
+    }
+
+    _logger.trace("Remove the temporary working directory '{0}'", _workDirectory);
+    const auto errc = llvm::sys::fs::remove_directories(_workDirectory);
+
+    if (errc) {
+        _logger.error("Failed to remove temporary working directory : {0}", errc.message());
+    }
+}
+
 void IMDInferRequest::infer_async() {
     _logger.debug("InferRequest::infer_async started");
     _logger.info("Run inference using InferenceManagerDemo application");
 
-    _workDirectory = create_temporary_work_directory();
+    // The working directory and the compiled model in it are kept between the inferences of the request
+    if (_workDirectory.empty()) {
+        _workDirectory = create_temporary_work_directory();
+        link_compiled_model();
+    }
 
-    store_compiled_model();
+    remove_network_outputs();
     store_network_inputs();
     run_app();
     _logger.debug("InferRequest::infer_async finished");
@@ -85,13 +102,6 @@ void IMDInferRequest::get_result() {
 
     load_network_outputs();
 
-    _logger.trace("Remove the temporary working directory '{0}'", _workDirectory);
-    const auto errc = llvm::sys::fs::remove_directories(_workDirectory);
-
-    if (errc) {
-        _logger.error("Failed to remove temporary working directory : {0}", errc.message());
-    }
-
     _logger.debug("InferRequest::get_result finished");
 }
 
@@ -107,21 +117,33 @@ vpux::SmallString IMDInferRequest::create_temporary_work_directory() {
     return _workDirectory;
 }
 
-void IMDInferRequest::store_compiled_model() {
-    _logger.trace("Store the compile model");
+void IMDInferRequest::link_compiled_model() {
+    _logger.trace("Link the compiled model");
 
+    // The application expects the model in its working directory, the file stored by the executor is shared
+    // by all the infer requests of the compiled model instead of writing it for every inference
     IMDExecutor* executor = static_cast<IMDExecutor*>(_executorPtr.get());
-    const auto& compiledModel = executor->getNetworkDesc()->compiledNetwork;
-
-    const std::string fileName = "vpuip.blob";
-    const auto modelFilePath = printToString("{0}/{1}", _workDirectory.str(), fileName);
-    std::ofstream file(modelFilePath, std::ios::binary);
+    const auto& compiledModelPath = executor->getCompiledModelPath();
 
-    VPUX_THROW_UNLESS(file.is_open(), "Can't open file '{0}' for write", modelFilePath);
+    const auto modelFilePath = printToString("{0}/vpuip.blob", _workDirectory.str());
+    const auto errc = llvm::sys::fs::create_link(compiledModelPath, modelFilePath);
+    VPUX_THROW_WHEN(errc, "Failed to link the compiled model '{0}' to '{1}' : {2}", compiledModelPath, modelFilePath,
+                    errc.message());
 
-    file.write(reinterpret_cast<const char*>(compiledModel.data()), compiledModel.size());
+    _logger.nest().trace("{0} -> {1}", modelFilePath, compiledModelPath);
+}
 
-    _logger.nest().trace("{0}", modelFilePath);
+void IMDInferRequest::remove_network_outputs() {
+    // The outputs of the previous inference must not be taken for the results of a failed one
+    std::error_code errc;
+    llvm::sys::fs::directory_iterator it(_workDirectory, errc), end;
+    for (; !errc && it != end; it.increment(errc)) {
+        const auto fileName = llvm::sys::path::filename(it->path());
+        if (fileName.startswith("output-") || fileName.startswith("profiling-")) {
+            errc = llvm::sys::fs::remove(it->path());
+        }
+    }
+    VPUX_THROW_WHEN(errc, "Failed to remove the outputs of the previous inference : {0}", errc.message());
 }
 
 void IMDInferRequest::store_network_inputs() {
@@ -159,24 +181,7 @@ void IMDInferRequest::store_network_inputs() {
 }
 
 void IMDInferRequest::run_app() {
-    _logger.trace("Run the application");
-
-    vpux::SmallString curPath;
-    auto errc = llvm::sys::fs::current_path(curPath);
-    VPUX_THROW_WHEN(errc, "Failed to get current path : {0}", errc.message());
-
-    VPUX_SCOPE_EXIT {
-        _logger.nest().trace("Restore current working directory '{0}'", curPath);
-        errc = llvm::sys::fs::set_current_path(curPath);
-
-        if (errc) {
-            _logger.error("Failed to restore current path : {0}", errc.message());
-        }
-    };
-
-    _logger.nest().trace("Change current working directory to the new temporary folder '{0}'", _workDirectory.str());
-    errc = llvm::sys::fs::set_current_path(_workDirectory.str());
-    VPUX_THROW_WHEN(errc, "Failed to change current path : {0}", errc.message());
+    _logger.trace("Run the application in '{0}'", _workDirectory.str());
 
     const std::string emptyString;
     llvm::SmallVector<std::optional<llvm::StringRef>> redirects = {
@@ -197,11 +202,21 @@ void IMDInferRequest::run_app() {
 
     std::string errMsg;
     auto app = static_cast<IMDExecutor*>(_executorPtr.get())->getApp();
-    llvm::SmallVector<llvm::StringRef> args(app.runArgs.begin(), app.runArgs.end());
+    llvm::SmallVector<llvm::StringRef> appArgs(app.runArgs.begin(), app.runArgs.end());
     _logger.trace("exec: {0}", app.runProgram);
-    _logger.trace("args: {0}", args);
+    _logger.trace("args: {0}", appArgs);
+
+    // The application reads and writes the files in its current directory. The shell changes the directory
+    // of the child process only and replaces itself with the application, so the working directory of this
+    // process stays the same and several infer requests can run at the same time
+    const auto shellProgram = llvm::sys::findProgramByName("sh");
+    VPUX_THROW_UNLESS(shellProgram, "Failed to find the shell : {0}", shellProgram.getError().message());
+
+    llvm::SmallVector<llvm::StringRef> args = {shellProgram.get(), "-c", "cd \"$0\" && exec \"$@\"",
+                                               _workDirectory.str(), app.runProgram};
+    args.append(std::next(appArgs.begin()), appArgs.end());
 
-    const auto procErr = llvm::sys::ExecuteAndWait(app.runProgram, args,
+    const auto procErr = llvm::sys::ExecuteAndWait(shellProgram.get(), args,
                                                    /*Env=*/std::nullopt, llvm::ArrayRef(redirects),
                                                    vpux::checked_cast<uint32_t>(app.timeoutSec),
                                                    /*MemoryLimit=*/0, &errMsg);
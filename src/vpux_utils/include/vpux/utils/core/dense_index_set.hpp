@@ -0,0 +1,148 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include <llvm/ADT/BitVector.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace vpux {
+
+//
+// DenseIndexSet
+//
+
+// Ordered set of indices from the dense [0, capacity) range, stored as a bit mask.
+// Insertion, removal and lookup are constant time and iteration visits the indices in increasing order.
+// The iterator only keeps the current index, so unlike std::set the current element can be erased during iteration.
+// As for std::set, the elements inserted after the current position are visited by the iteration.
+
+class DenseIndexSet final {
+public:
+    using value_type = size_t;
+
+    class iterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const size_t*;
+        using reference = size_t;
+
+    public:
+        iterator(const llvm::BitVector& mask, int ind): _mask(&mask), _ind(ind) {
+        }
+
+        size_t operator*() const {
+            assert(_ind >= 0);
+            return static_cast<size_t>(_ind);
+        }
+
+        iterator& operator++() {
+            _ind = _mask->find_next(static_cast<unsigned>(_ind));
+            return *this;
+        }
+        iterator operator++(int) {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const iterator& other) const {
+            return _mask == other._mask && _ind == other._ind;
+        }
+        bool operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        const llvm::BitVector* _mask;
+        // -1 for the end
+        int _ind;
+    };
+    using const_iterator = iterator;
+
+public:
+    DenseIndexSet() = default;
+
+    explicit DenseIndexSet(size_t capacity): _mask(static_cast<unsigned>(capacity)) {
+    }
+
+public:
+    // Returns `true` if the index was not in the set
+    bool insert(size_t ind) {
+        if (ind >= _mask.size()) {
+            _mask.resize(static_cast<unsigned>(std::max(ind + 1, 2 * static_cast<size_t>(_mask.size()))));
+        }
+        if (_mask.test(static_cast<unsigned>(ind))) {
+            return false;
+        }
+        _mask.set(static_cast<unsigned>(ind));
+        ++_size;
+        return true;
+    }
+
+    // Returns the number of removed elements
+    size_t erase(size_t ind) {
+        if (!contains(ind)) {
+            return 0;
+        }
+        _mask.reset(static_cast<unsigned>(ind));
+        assert(_size > 0);
+        --_size;
+        return 1;
+    }
+
+    void clear() {
+        _mask.reset();
+        _size = 0;
+    }
+
+    void reset(size_t capacity) {
+        _mask.clear();
+        _mask.resize(static_cast<unsigned>(capacity));
+        _size = 0;
+    }
+
+public:
+    bool contains(size_t ind) const {
+        return ind < _mask.size() && _mask.test(static_cast<unsigned>(ind));
+    }
+
+    size_t count(size_t ind) const {
+        return contains(ind) ? 1 : 0;
+    }
+
+    bool empty() const {
+        return _size == 0;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    size_t capacity() const {
+        return _mask.size();
+    }
+
+public:
+    iterator begin() const {
+        return iterator(_mask, _mask.find_first());
+    }
+    iterator end() const {
+        return iterator(_mask, -1);
+    }
+
+private:
+    llvm::BitVector _mask;
+    size_t _size = 0;
+};
+
+}  // namespace vpux
@@ -0,0 +1,30 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Lookup of the sections of an ELF64 image through its section header table.
+// Only the ELF header, the section header table (and the section names for the lookup by name) are read,
+// the content of the other sections is never accessed. So the blob may be a memory-mapped file:
+// the pages holding the weights are not loaded to find a small section like the network metadata.
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace vpux {
+
+// Returns the content of the first section with the given `sh_type` or std::nullopt if there is no such section.
+// Throws if the blob is not a little endian ELF64 image or the located headers are out of its bounds
+std::optional<ArrayRef<uint8_t>> findElfSectionByType(ArrayRef<uint8_t> blob, uint32_t sectionType);
+
+// Same as above, but the section is identified by its name
+std::optional<ArrayRef<uint8_t>> findElfSectionByName(ArrayRef<uint8_t> blob, StringRef sectionName);
+
+}  // namespace vpux
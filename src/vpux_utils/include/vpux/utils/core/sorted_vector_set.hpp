@@ -0,0 +1,215 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace vpux {
+
+//
+// SortedVectorSet
+//
+
+// Ordered set stored as a sorted contiguous vector, the first N elements don't require heap allocation.
+// Unlike llvm::SmallSet it doesn't switch to a node based std::set for large sizes: lookup is a binary search
+// and union, intersection and difference are linear merges of two sorted arrays.
+// Insertion and removal in the middle are linear, but insertion of increasing values is amortized constant.
+// As for a vector, any modification invalidates the iterators.
+
+template <typename T, unsigned N = 16>
+class SortedVectorSet final {
+    using Storage = SmallVector<T, N>;
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = typename Storage::const_iterator;
+    using const_iterator = iterator;
+
+public:
+    SortedVectorSet() = default;
+
+    SortedVectorSet(std::initializer_list<T> values) {
+        insert(values.begin(), values.end());
+    }
+
+    template <typename InputIt>
+    SortedVectorSet(InputIt first, InputIt last) {
+        insert(first, last);
+    }
+
+public:
+    std::pair<iterator, bool> insert(const T& val) {
+        if (_data.empty() || _data.back() < val) {
+            _data.push_back(val);
+            return {std::prev(_data.end()), true};
+        }
+
+        const auto pos = std::lower_bound(_data.begin(), _data.end(), val);
+        assert(pos != _data.end());
+        if (!(val < *pos)) {
+            return {pos, false};
+        }
+        return {_data.insert(pos, val), true};
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        const auto oldSize = _data.size();
+        _data.append(first, last);
+
+        const auto middle = _data.begin() + oldSize;
+        if (!std::is_sorted(middle, _data.end())) {
+            std::sort(middle, _data.end());
+        }
+        std::inplace_merge(_data.begin(), middle, _data.end());
+        _data.erase(std::unique(_data.begin(), _data.end()), _data.end());
+    }
+
+    // Returns the number of removed elements
+    size_t erase(const T& val) {
+        const auto pos = std::lower_bound(_data.begin(), _data.end(), val);
+        if (pos == _data.end() || val < *pos) {
+            return 0;
+        }
+        _data.erase(pos);
+        return 1;
+    }
+
+    iterator erase(iterator pos) {
+        return _data.erase(_data.begin() + (pos - _data.begin()));
+    }
+
+    void clear() {
+        _data.clear();
+    }
+
+    void reserve(size_t size) {
+        _data.reserve(size);
+    }
+
+public:
+    // Set operations, each of them returns `true` if the set was changed
+
+    bool merge(const SortedVectorSet& other) {
+        if (other.empty() || this == &other) {
+            return false;
+        }
+        if (empty()) {
+            _data = other._data;
+            return true;
+        }
+        if (_data.back() < other.front()) {
+            _data.append(other.begin(), other.end());
+            return true;
+        }
+
+        Storage result;
+        result.reserve(size() + other.size());
+        std::set_union(_data.begin(), _data.end(), other.begin(), other.end(), std::back_inserter(result));
+        if (result.size() == size()) {
+            return false;
+        }
+        _data = std::move(result);
+        return true;
+    }
+
+    bool subtract(const SortedVectorSet& other) {
+        if (this == &other) {
+            const auto changed = !empty();
+            clear();
+            return changed;
+        }
+        return filter(other, /*keepCommon=*/false);
+    }
+
+    bool intersect(const SortedVectorSet& other) {
+        if (this == &other) {
+            return false;
+        }
+        return filter(other, /*keepCommon=*/true);
+    }
+
+public:
+    bool contains(const T& val) const {
+        return std::binary_search(_data.begin(), _data.end(), val);
+    }
+
+    size_t count(const T& val) const {
+        return contains(val) ? 1 : 0;
+    }
+
+    iterator find(const T& val) const {
+        const auto pos = std::lower_bound(_data.begin(), _data.end(), val);
+        return pos != _data.end() && !(val < *pos) ? pos : _data.end();
+    }
+
+    bool empty() const {
+        return _data.empty();
+    }
+
+    size_t size() const {
+        return _data.size();
+    }
+
+    const T& front() const {
+        return _data.front();
+    }
+
+    const T& back() const {
+        return _data.back();
+    }
+
+public:
+    iterator begin() const {
+        return _data.begin();
+    }
+    iterator end() const {
+        return _data.end();
+    }
+
+public:
+    bool operator==(const SortedVectorSet& other) const {
+        return _data == other._data;
+    }
+    bool operator!=(const SortedVectorSet& other) const {
+        return !(*this == other);
+    }
+
+private:
+    // Keeps either the elements which are also in `other` or the ones which are not, both sets are walked once
+    bool filter(const SortedVectorSet& other, bool keepCommon) {
+        auto otherPos = other.begin();
+        auto out = _data.begin();
+        for (auto pos = _data.begin(); pos != _data.end(); ++pos) {
+            while (otherPos != other.end() && *otherPos < *pos) {
+                ++otherPos;
+            }
+            const bool isCommon = otherPos != other.end() && !(*pos < *otherPos);
+            if (isCommon == keepCommon) {
+                *out++ = std::move(*pos);
+            }
+        }
+        if (out == _data.end()) {
+            return false;
+        }
+        _data.erase(out, _data.end());
+        return true;
+    }
+
+private:
+    Storage _data;
+};
+
+}  // namespace vpux
@@ -62,6 +62,8 @@ ProfInfo getProfInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* pr
 /**
  * @fn getLayerInfo
  * @brief Parse raw profiling output to get per-layer info.
+ * The statistics are accumulated from the tasks of each engine, the time-ordered list of all tasks is not built.
+ * Prefer it to \b getTaskInfo when only the per-layer info is needed.
  * @param blobData pointer to the buffer with blob binary
  * @param blobSize blob size in bytes
  * @param profData pointer to the buffer with raw profiling data
@@ -0,0 +1,133 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/core/elf_section_lookup.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <llvm/BinaryFormat/ELF.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace vpux;
+
+namespace {
+
+template <typename T>
+T readHeader(ArrayRef<uint8_t> blob, uint64_t offset) {
+    VPUX_THROW_UNLESS(offset <= blob.size() && sizeof(T) <= blob.size() - offset,
+                      "ELF header of {0} bytes at offset {1} is out of the blob of {2} bytes", sizeof(T), offset,
+                      blob.size());
+    // The blob gives no alignment guarantees
+    T header;
+    std::memcpy(&header, blob.data() + offset, sizeof(T));
+    return header;
+}
+
+ArrayRef<uint8_t> getSectionData(ArrayRef<uint8_t> blob, const llvm::ELF::Elf64_Shdr& header) {
+    if (header.sh_type == llvm::ELF::SHT_NOBITS) {
+        return {};
+    }
+    VPUX_THROW_UNLESS(header.sh_offset <= blob.size() && header.sh_size <= blob.size() - header.sh_offset,
+                      "ELF section of {0} bytes at offset {1} is out of the blob of {2} bytes", header.sh_size,
+                      header.sh_offset, blob.size());
+    return blob.slice(header.sh_offset, header.sh_size);
+}
+
+StringRef getSectionName(ArrayRef<uint8_t> names, const llvm::ELF::Elf64_Shdr& header) {
+    VPUX_THROW_UNLESS(header.sh_name < names.size(), "ELF section name offset {0} is out of the string table",
+                      header.sh_name);
+    const auto name = names.drop_front(header.sh_name);
+    const auto nameEnd = std::find(name.begin(), name.end(), '\0');
+    return StringRef(reinterpret_cast<const char*>(name.data()), static_cast<size_t>(nameEnd - name.begin()));
+}
+
+//
+// SectionHeaderTable
+//
+
+class SectionHeaderTable final {
+public:
+    explicit SectionHeaderTable(ArrayRef<uint8_t> blob): _blob(blob) {
+        const auto elfHeader = readHeader<llvm::ELF::Elf64_Ehdr>(_blob, 0);
+        VPUX_THROW_UNLESS(elfHeader.checkMagic(), "Blob is not an ELF image");
+        VPUX_THROW_UNLESS(elfHeader.getFileClass() == llvm::ELF::ELFCLASS64, "Only ELF64 images are supported");
+        VPUX_THROW_UNLESS(elfHeader.getDataEncoding() == llvm::ELF::ELFDATA2LSB,
+                          "Only little endian ELF images are supported");
+
+        _offset = elfHeader.e_shoff;
+        if (_offset == 0) {
+            return;
+        }
+        _entrySize = elfHeader.e_shentsize;
+        VPUX_THROW_UNLESS(_entrySize >= sizeof(llvm::ELF::Elf64_Shdr), "Unexpected ELF section header size {0}",
+                          _entrySize);
+
+        // With the extended numbering the actual values are stored in the first section header
+        _size = elfHeader.e_shnum;
+        _namesIndex = elfHeader.e_shstrndx;
+        if (_size == 0 || _namesIndex == llvm::ELF::SHN_XINDEX) {
+            const auto firstHeader = (*this)[0];
+            if (_size == 0) {
+                _size = firstHeader.sh_size;
+            }
+            if (_namesIndex == llvm::ELF::SHN_XINDEX) {
+                _namesIndex = firstHeader.sh_link;
+            }
+        }
+        VPUX_THROW_UNLESS(_offset <= _blob.size() && _size <= (_blob.size() - _offset) / _entrySize,
+                          "ELF section header table of {0} entries at offset {1} is out of the blob of {2} bytes",
+                          _size, _offset, _blob.size());
+    }
+
+public:
+    uint64_t size() const {
+        return _size;
+    }
+
+    llvm::ELF::Elf64_Shdr operator[](uint64_t index) const {
+        return readHeader<llvm::ELF::Elf64_Shdr>(_blob, _offset + index * _entrySize);
+    }
+
+    // Content of the section name string table
+    ArrayRef<uint8_t> getNames() const {
+        VPUX_THROW_UNLESS(_namesIndex != llvm::ELF::SHN_UNDEF && _namesIndex < _size,
+                          "ELF image has no section names");
+        return getSectionData(_blob, (*this)[_namesIndex]);
+    }
+
+private:
+    ArrayRef<uint8_t> _blob;
+    uint64_t _offset = 0;
+    uint64_t _entrySize = 0;
+    uint64_t _size = 0;
+    uint64_t _namesIndex = llvm::ELF::SHN_UNDEF;
+};
+
+}  // namespace
+
+std::optional<ArrayRef<uint8_t>> vpux::findElfSectionByType(ArrayRef<uint8_t> blob, uint32_t sectionType) {
+    const SectionHeaderTable headers(blob);
+    for (uint64_t index = 0; index < headers.size(); ++index) {
+        const auto header = headers[index];
+        if (header.sh_type == sectionType) {
+            return getSectionData(blob, header);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<ArrayRef<uint8_t>> vpux::findElfSectionByName(ArrayRef<uint8_t> blob, StringRef sectionName) {
+    const SectionHeaderTable headers(blob);
+    const auto names = headers.getNames();
+    for (uint64_t index = 0; index < headers.size(); ++index) {
+        const auto header = headers[index];
+        if (getSectionName(names, header) == sectionName) {
+            return getSectionData(blob, header);
+        }
+    }
+    return std::nullopt;
+}
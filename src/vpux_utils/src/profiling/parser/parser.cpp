@@ -14,7 +14,11 @@
 
 #include "schema/profiling_generated.h"
 
+#include <exception>
+#include <functional>
+#include <future>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace vpux::profiling {
@@ -35,6 +39,7 @@ void warnOrFail(bool failOnError, vpux::Logger& log, bool condition, llvm::Strin
 
 void fillTaskInfoWithParsedRawRecords(std::vector<TaskInfo>& vec, const RawProfilingRecords& rawTasks,
                                       FrequenciesSetup frequenciesSetup) {
+    vec.reserve(vec.size() + rawTasks.size());
     for (const auto& task : rawTasks) {
         vec.push_back(task->getTaskInfo(frequenciesSetup));
     }
@@ -323,59 +328,120 @@ std::vector<std::pair<WorkpointConfiguration_t, size_t>> getWorkpointData(const
     return workpoints;
 }
 
+// Profiling buffers and record lists smaller than these limits are processed in the calling thread, spawning the
+// threads would take longer than the processing itself
+constexpr size_t MIN_PARALLEL_PARSING_DATA_SIZE = 256 * 1024;
+constexpr size_t MIN_PARALLEL_CONVERSION_RECORDS = 16 * 1024;
+
+// Runs independent jobs, concurrently if requested. Waits for all of them and rethrows the first failure
+void runJobs(const std::vector<std::function<void()>>& jobs, bool parallel) {
+    if (!parallel || jobs.size() < 2) {
+        for (const auto& job : jobs) {
+            job();
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> results;
+    results.reserve(jobs.size());
+    for (const auto& job : jobs) {
+        results.push_back(std::async(std::launch::async, job));
+    }
+    std::exception_ptr firstError;
+    for (auto& result : results) {
+        try {
+            result.get();
+        } catch (...) {
+            if (firstError == nullptr) {
+                firstError = std::current_exception();
+            }
+        }
+    }
+    if (firstError != nullptr) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+RawProfilingRecords parseEngineSection(ExecutorType execType, MVCNN::TargetDevice device, const uint8_t* sectionData,
+                                       size_t length, const ProfilingFB::ProfilingMeta* profilingSchema,
+                                       vpux::Logger& log, bool ignoreSanitizationErrors) {
+    switch (execType) {
+    case ExecutorType::DMA_SW:
+        return parseDmaSwTaskProfiling(profilingSchema->dmaTasks(), sectionData, length, device);
+    case ExecutorType::DMA_HW:
+        return parseDmaHwTaskProfiling(profilingSchema->dmaTasks(), sectionData, length);
+    case ExecutorType::UPA:
+        return parseUPATaskProfiling(profilingSchema->swTasks(), sectionData, length);
+    case ExecutorType::ACTSHAVE:
+        return parseActShaveTaskProfiling(profilingSchema->swTasks(), sectionData, length);
+    case ExecutorType::DPU:
+        return parseDPUTaskProfiling(profilingSchema->dpuTasks(), sectionData, length, device, log,
+                                     ignoreSanitizationErrors);
+    case ExecutorType::M2I:
+        return parseM2ITaskProfiling(profilingSchema->m2iTasks(), sectionData, length);
+    default:
+        VPUX_THROW("Invalid profiling executor.");
+    }
+}
+
+RawProfilingRecords& getEngineRecords(RawProfilingData& rawProfData, ExecutorType execType) {
+    switch (execType) {
+    case ExecutorType::DMA_SW:
+    case ExecutorType::DMA_HW:
+        return rawProfData.dmaTasks;
+    case ExecutorType::UPA:
+    case ExecutorType::ACTSHAVE:
+        return rawProfData.swTasks;
+    case ExecutorType::DPU:
+        return rawProfData.dpuTasks;
+    case ExecutorType::M2I:
+        return rawProfData.m2iTasks;
+    default:
+        VPUX_THROW("Invalid profiling executor.");
+    }
+}
+
 RawProfilingData parseProfilingTaskLists(const RawDataLayout& sections, MVCNN::TargetDevice device,
                                          const uint8_t* profData, const ProfilingFB::ProfilingMeta* profilingSchema,
                                          vpux::Logger& log, bool ignoreSanitizationErrors) {
     RawProfilingData rawProfData;
 
+    // Every engine has its own section in the buffer and its own task list in the metadata,
+    // so the sections are parsed independently and the results are collected in the layout order
+    std::vector<std::pair<ExecutorType, uint32_t>> engineSections;
+    size_t engineDataSize = 0;
     for (const auto& section : sections) {
         const auto offset = section.second.first;
         const auto length = section.second.second;
 
-        switch (section.first) {
-        case ExecutorType::DMA_SW: {
-            rawProfData.dmaTasks =
-                    parseDmaSwTaskProfiling(profilingSchema->dmaTasks(), profData + offset, length, device);
-            rawProfData.parseOrder.emplace_back(ExecutorType::DMA_SW, offset);
-            break;
-        }
-        case ExecutorType::DMA_HW: {
-            rawProfData.dmaTasks = parseDmaHwTaskProfiling(profilingSchema->dmaTasks(), profData + offset, length);
-            rawProfData.parseOrder.emplace_back(ExecutorType::DMA_HW, offset);
-            break;
-        }
-        case ExecutorType::UPA: {
-            rawProfData.swTasks = parseUPATaskProfiling(profilingSchema->swTasks(), profData + offset, length);
-            rawProfData.parseOrder.emplace_back(ExecutorType::UPA, offset);
-            break;
-        }
-        case ExecutorType::ACTSHAVE: {
-            rawProfData.swTasks = parseActShaveTaskProfiling(profilingSchema->swTasks(), profData + offset, length);
-            rawProfData.parseOrder.emplace_back(ExecutorType::ACTSHAVE, offset);
-            break;
-        }
-        case ExecutorType::DPU: {
-            rawProfData.dpuTasks = parseDPUTaskProfiling(profilingSchema->dpuTasks(), profData + offset, length, device,
-                                                         log, ignoreSanitizationErrors);
-            rawProfData.parseOrder.emplace_back(ExecutorType::DPU, offset);
-            break;
-        }
-        case ExecutorType::WORKPOINT: {
+        if (section.first == ExecutorType::WORKPOINT) {
             const auto isWorkpointAccessible = device == MVCNN::TargetDevice::TargetDevice_VPUX37XX ||
                                                device == MVCNN::TargetDevice::TargetDevice_VPUX40XX;
             if (isWorkpointAccessible && length != 0) {
                 rawProfData.workpoints = getWorkpointData(profData + offset, length, offset);
             }
-            break;
-        }
-        case ExecutorType::M2I: {
-            rawProfData.m2iTasks = parseM2ITaskProfiling(profilingSchema->m2iTasks(), profData + offset, length);
-            rawProfData.parseOrder.emplace_back(ExecutorType::M2I, offset);
-            break;
-        }
-        default:
-            VPUX_THROW("Invalid profiling executor.");
+            continue;
         }
+        engineSections.emplace_back(section.first, offset);
+        engineDataSize += length;
+    }
+
+    std::vector<RawProfilingRecords> engineRecords(engineSections.size());
+    std::vector<std::function<void()>> jobs;
+    for (size_t index = 0; index < engineSections.size(); ++index) {
+        jobs.push_back([&, index]() {
+            const auto execType = engineSections[index].first;
+            const auto& layout = sections.at(execType);
+            engineRecords[index] = parseEngineSection(execType, device, profData + layout.first, layout.second,
+                                                      profilingSchema, log, ignoreSanitizationErrors);
+        });
+    }
+    runJobs(jobs, engineDataSize >= MIN_PARALLEL_PARSING_DATA_SIZE);
+
+    for (size_t index = 0; index < engineSections.size(); ++index) {
+        const auto execType = engineSections[index].first;
+        getEngineRecords(rawProfData, execType) = std::move(engineRecords[index]);
+        rawProfData.parseOrder.emplace_back(execType, engineSections[index].second);
     }
     return rawProfData;
 }
@@ -436,33 +502,57 @@ RawProfilingRecords makeFakeDpuInvariants(const RawProfilingRecords& variants) {
     return invariants;
 }
 
-// At parse time we don't know frequency for some platforms, so data is collected in cycles format. We need
-// to determine frequency to convert from cycles to nanoseconds
-std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawProfilingData& rawTasks,
-                                                const FrequenciesSetup& frequenciesSetup, VerbosityLevel verbosity,
-                                                vpux::Logger& log) {
-    for (const auto& taskList : {rawTasks.dmaTasks, rawTasks.dpuTasks, rawTasks.swTasks, rawTasks.m2iTasks}) {
-        for (const auto& task : taskList) {
-            task->sanitize(log, frequenciesSetup);
-        }
-    }
-
+// Tasks of every engine converted to TaskInfo and shifted to the common zero point. The lists are not merged
+struct EngineTaskInfo {
     std::vector<TaskInfo> dmaTaskInfo;
     std::vector<TaskInfo> swTaskInfo;
     std::vector<TaskInfo> dpuTaskInfo;
     std::vector<TaskInfo> m2iTaskInfo;
+};
 
-    fillTaskInfoWithParsedRawRecords(dmaTaskInfo, rawTasks.dmaTasks, frequenciesSetup);
-
-    fillTaskInfoWithParsedRawRecords(swTaskInfo, rawTasks.swTasks, frequenciesSetup);
-
-    RawProfilingRecords dpuInvariantTasks = makeFakeDpuInvariants(rawTasks.dpuTasks);
-    fillTaskInfoWithParsedRawRecords(dpuTaskInfo, dpuInvariantTasks, frequenciesSetup);
-    if (verbosity >= VerbosityLevel::MEDIUM) {
-        fillTaskInfoWithParsedRawRecords(dpuTaskInfo, rawTasks.dpuTasks, frequenciesSetup);
-    }
-
-    fillTaskInfoWithParsedRawRecords(m2iTaskInfo, rawTasks.m2iTasks, frequenciesSetup);
+// At parse time we don't know frequency for some platforms, so data is collected in cycles format. We need
+// to determine frequency to convert from cycles to nanoseconds
+EngineTaskInfo convertRawTasksToEngineTaskInfo(const RawProfilingData& rawTasks,
+                                               const FrequenciesSetup& frequenciesSetup, VerbosityLevel verbosity,
+                                               vpux::Logger& log) {
+    const auto sanitize = [&](const RawProfilingRecords& taskList) {
+        for (const auto& task : taskList) {
+            task->sanitize(log, frequenciesSetup);
+        }
+    };
+
+    EngineTaskInfo engines;
+    auto& dmaTaskInfo = engines.dmaTaskInfo;
+    auto& swTaskInfo = engines.swTaskInfo;
+    auto& dpuTaskInfo = engines.dpuTaskInfo;
+    auto& m2iTaskInfo = engines.m2iTaskInfo;
+
+    // Records of different engines are independent until the timers are aligned below
+    const std::vector<std::function<void()>> jobs = {
+            [&]() {
+                sanitize(rawTasks.dmaTasks);
+                fillTaskInfoWithParsedRawRecords(dmaTaskInfo, rawTasks.dmaTasks, frequenciesSetup);
+            },
+            [&]() {
+                sanitize(rawTasks.swTasks);
+                fillTaskInfoWithParsedRawRecords(swTaskInfo, rawTasks.swTasks, frequenciesSetup);
+            },
+            [&]() {
+                sanitize(rawTasks.dpuTasks);
+                RawProfilingRecords dpuInvariantTasks = makeFakeDpuInvariants(rawTasks.dpuTasks);
+                fillTaskInfoWithParsedRawRecords(dpuTaskInfo, dpuInvariantTasks, frequenciesSetup);
+                if (verbosity >= VerbosityLevel::MEDIUM) {
+                    fillTaskInfoWithParsedRawRecords(dpuTaskInfo, rawTasks.dpuTasks, frequenciesSetup);
+                }
+            },
+            [&]() {
+                sanitize(rawTasks.m2iTasks);
+                fillTaskInfoWithParsedRawRecords(m2iTaskInfo, rawTasks.m2iTasks, frequenciesSetup);
+            },
+    };
+    const auto numRecords =
+            rawTasks.dmaTasks.size() + rawTasks.swTasks.size() + rawTasks.dpuTasks.size() + rawTasks.m2iTasks.size();
+    runJobs(jobs, numRecords >= MIN_PARALLEL_CONVERSION_RECORDS);
 
     const auto earliestDpuNs = getEarliestTaskBegin(dpuTaskInfo);
     const auto earliestDmaNs = getEarliestTaskBegin(dmaTaskInfo);
@@ -522,18 +612,92 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawProfilingData& rawTasks
 
     adjustZeroPoint(m2iTaskInfo, 0, earliestDmaNs);
 
+    return engines;
+}
+
+std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawProfilingData& rawTasks,
+                                                const FrequenciesSetup& frequenciesSetup, VerbosityLevel verbosity,
+                                                vpux::Logger& log) {
+    const auto engines = convertRawTasksToEngineTaskInfo(rawTasks, frequenciesSetup, verbosity, log);
+
     std::vector<TaskInfo> allTaskInfo;
-    allTaskInfo.reserve(dpuTaskInfo.size() + dmaTaskInfo.size() + swTaskInfo.size() + m2iTaskInfo.size());
-    allTaskInfo.insert(allTaskInfo.end(), dpuTaskInfo.begin(), dpuTaskInfo.end());
-    allTaskInfo.insert(allTaskInfo.end(), dmaTaskInfo.begin(), dmaTaskInfo.end());
-    allTaskInfo.insert(allTaskInfo.end(), swTaskInfo.begin(), swTaskInfo.end());
-    allTaskInfo.insert(allTaskInfo.end(), m2iTaskInfo.begin(), m2iTaskInfo.end());
+    allTaskInfo.reserve(engines.dpuTaskInfo.size() + engines.dmaTaskInfo.size() + engines.swTaskInfo.size() +
+                        engines.m2iTaskInfo.size());
+    for (const auto* taskInfo : {&engines.dpuTaskInfo, &engines.dmaTaskInfo, &engines.swTaskInfo,
+                                 &engines.m2iTaskInfo}) {
+        allTaskInfo.insert(allTaskInfo.end(), taskInfo->begin(), taskInfo->end());
+    }
 
     std::sort(allTaskInfo.begin(), allTaskInfo.end(), profilingTaskStartTimeComparator<TaskInfo>);
 
     return allTaskInfo;
 }
 
+//
+// LayerInfoAggregator
+//
+
+// Accumulates per-layer statistics task by task, the tasks may come in any order
+class LayerInfoAggregator final {
+public:
+    void add(const TaskInfo& task);
+
+    // Layers ordered by their start time
+    std::vector<LayerInfo> getLayers() &&;
+
+private:
+    std::vector<LayerInfo> _layers;
+    std::unordered_map<std::string, size_t> _layerIndices;
+};
+
+void copyName(char* dst, size_t dstSize, const std::string& src) {
+    const auto len = src.copy(dst, dstSize - 1);
+    dst[len] = 0;
+}
+
+void LayerInfoAggregator::add(const TaskInfo& task) {
+    if (!getVariantFromName(task.name).empty()) {
+        // Skipping high verbose tasks with variant info
+        return;
+    }
+
+    std::string layerName = getLayerName(task.name);
+    const auto [indexIt, isNewLayer] = _layerIndices.try_emplace(std::move(layerName), _layers.size());
+    if (isNewLayer) {
+        auto& layer = _layers.emplace_back();
+        layer.status = LayerInfo::layer_status_t::EXECUTED;
+        layer.start_time_ns = task.start_time_ns;
+        layer.duration_ns = 0;
+        copyName(layer.name, sizeof(layer.name), indexIt->first);
+        copyName(layer.layer_type, sizeof(layer.layer_type), task.layer_type);
+    }
+
+    auto& layer = _layers[indexIt->second];
+    if (task.start_time_ns < layer.start_time_ns) {
+        layer.duration_ns += layer.start_time_ns - task.start_time_ns;
+        layer.start_time_ns = task.start_time_ns;
+        // Type is taken from the earliest task like for the time-ordered tasks
+        copyName(layer.layer_type, sizeof(layer.layer_type), task.layer_type);
+    }
+    auto duration = (int64_t)task.start_time_ns + task.duration_ns - layer.start_time_ns;
+    if (duration > layer.duration_ns) {
+        layer.duration_ns = duration;
+    }
+
+    if (task.exec_type == TaskInfo::ExecType::DPU) {
+        layer.dpu_ns += task.duration_ns;
+    } else if (task.exec_type == TaskInfo::ExecType::SW || task.exec_type == TaskInfo::ExecType::UPA) {
+        layer.sw_ns += task.duration_ns;
+    } else if (task.exec_type == TaskInfo::ExecType::DMA) {
+        layer.dma_ns += task.duration_ns;
+    }
+}
+
+std::vector<LayerInfo> LayerInfoAggregator::getLayers() && {
+    std::sort(_layers.begin(), _layers.end(), profilingTaskStartTimeComparator<LayerInfo>);
+    return std::move(_layers);
+}
+
 }  // namespace
 
 RawData getRawProfilingTasks(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
@@ -587,60 +751,34 @@ std::vector<TaskInfo> getTaskInfo(const uint8_t* blobData, size_t blobSize, cons
 }
 
 std::vector<LayerInfo> getLayerInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
-                                    bool fpga, bool highFreqPerfClk) {
-    std::vector<TaskInfo> taskInfo =
-            getTaskInfo(blobData, blobSize, profData, profSize, VerbosityLevel::LOW, fpga, highFreqPerfClk);
-    return getLayerInfo(taskInfo);
+                                    bool fpga, bool highFreqPerfClk) try {
+    const auto rawData = getRawProfilingTasks(blobData, blobSize, profData, profSize);
+
+    auto log = vpux::Logger::global();
+    FrequenciesSetup frequenciesSetup =
+            getFrequencySetup(rawData.device, rawData.rawRecords.workpoints, highFreqPerfClk, fpga, log);
+    const auto engines =
+            convertRawTasksToEngineTaskInfo(rawData.rawRecords, frequenciesSetup, VerbosityLevel::LOW, log);
+
+    // Statistics don't depend on the order of tasks, so the merged time-ordered task list is not built
+    LayerInfoAggregator aggregator;
+    for (const auto* taskInfo : {&engines.dpuTaskInfo, &engines.dmaTaskInfo, &engines.swTaskInfo,
+                                 &engines.m2iTaskInfo}) {
+        for (const auto& task : *taskInfo) {
+            aggregator.add(task);
+        }
+    }
+    return std::move(aggregator).getLayers();
+} catch (const std::exception& ex) {
+    VPUX_THROW("Profiling post-processing failed. {0}", ex.what());
 }
 
 std::vector<LayerInfo> getLayerInfo(const std::vector<TaskInfo>& taskInfo) {
-    std::vector<LayerInfo> layerInfo;
+    LayerInfoAggregator aggregator;
     for (const auto& task : taskInfo) {
-        LayerInfo* layer;
-        if (!getVariantFromName(task.name).empty()) {
-            // Skipping high verbose tasks with variant info
-            continue;
-        }
-
-        std::string layerName = getLayerName(task.name);
-        auto result = std::find_if(begin(layerInfo), end(layerInfo), [&](const LayerInfo& item) {
-            return layerName == item.name;
-        });
-        if (result == end(layerInfo)) {
-            layer = &layerInfo.emplace_back();
-            layer->status = LayerInfo::layer_status_t::EXECUTED;
-            layer->start_time_ns = task.start_time_ns;
-            layer->duration_ns = 0;
-
-            const auto nameLen = layerName.copy(layer->name, sizeof(layer->name) - 1);
-            layer->name[nameLen] = 0;
-
-            const std::string layerTypeStr(task.layer_type);
-            const auto typeLen = layerTypeStr.copy(layer->layer_type, sizeof(layer->layer_type) - 1);
-            layer->layer_type[typeLen] = 0;
-        } else {
-            layer = &(*result);
-        }
-        if (task.start_time_ns < layer->start_time_ns) {
-            layer->duration_ns += layer->start_time_ns - task.start_time_ns;
-            layer->start_time_ns = task.start_time_ns;
-        }
-        auto duration = (int64_t)task.start_time_ns + task.duration_ns - layer->start_time_ns;
-        if (duration > layer->duration_ns) {
-            layer->duration_ns = duration;
-        }
-
-        if (task.exec_type == TaskInfo::ExecType::DPU) {
-            layer->dpu_ns += task.duration_ns;
-        } else if (task.exec_type == TaskInfo::ExecType::SW || task.exec_type == TaskInfo::ExecType::UPA) {
-            layer->sw_ns += task.duration_ns;
-        } else if (task.exec_type == TaskInfo::ExecType::DMA) {
-            layer->dma_ns += task.duration_ns;
-        }
+        aggregator.add(task);
     }
-
-    std::sort(layerInfo.begin(), layerInfo.end(), profilingTaskStartTimeComparator<LayerInfo>);
-    return layerInfo;
+    return std::move(aggregator).getLayers();
 }
 
 }  // namespace vpux::profiling
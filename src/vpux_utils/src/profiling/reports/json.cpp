@@ -68,7 +68,10 @@ public:
     ~TraceEventExporter() noexcept(false);
 
     /**
-     * @brief flush queued trace events to output stream.
+     * @brief write queued trace events to output stream.
+     *
+     * Until this call only the selected tasks and layers and their thread placement are kept, the events are
+     * built and written one by one here.
      */
     void flushAsTraceEvents();
 
@@ -132,7 +135,18 @@ private:
      */
     void validateTaskNameAndDuration(const TaskInfo& task) const;
 
-    std::vector<TraceEventDesc> _events;
+    void writeTraceEvent(const TraceEventDesc& event);
+
+    // Events of one process/thread group which are written after all the metadata events
+    struct PendingEvents {
+        int processId;
+        TaskList tasks;
+        std::vector<LayerInfo> layers;
+        std::vector<int> threadIds;
+    };
+
+    std::vector<PendingEvents> _pendingEvents;
+    size_t _numWrittenEvents = 0;
     std::ostream& _outStream;
     Logger _log;
     int _processId = -1;
@@ -198,24 +212,68 @@ std::string formatDuration(uint64_t timeNs) {
     return timeString;
 }
 
+TraceEventDesc makeTaskTraceEvent(const TaskInfo& task, int processId, int threadId) {
+    TraceEventDesc ted;
+    ted.name = task.name;
+    ted.category = enumToStr.at(task.exec_type);
+    ted.pid = processId;
+    ted.tid = threadId;
+    // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
+    ted.timestamp = task.start_time_ns / 1000.;
+    ted.duration = task.duration_ns / 1000.;
+
+    if (task.active_cycles != 0) {
+        ted.customArgs.push_back({"Active cycles:", std::to_string(task.active_cycles)});
+    }
+    if (task.stall_cycles != 0) {
+        ted.customArgs.push_back({"Stall cycles:", std::to_string(task.stall_cycles)});
+    }
+    return ted;
+}
+
+TraceEventDesc makeLayerTraceEvent(const LayerInfo& layer, int processId, int threadId) {
+    TraceEventDesc ted;
+    ted.name = layer.name;
+    ted.category = "Layer";
+    ted.pid = processId;
+    ted.tid = threadId;
+    // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
+    ted.timestamp = layer.start_time_ns / 1000.;
+    ted.duration = layer.duration_ns / 1000.;
+    ted.customArgs.push_back({"Layer type", layer.layer_type});
+
+    if (layer.dpu_ns != 0) {
+        ted.customArgs.push_back({"DPU time:", formatDuration(layer.dpu_ns)});
+    }
+    if (layer.sw_ns != 0) {
+        ted.customArgs.push_back({"Shave time:", formatDuration(layer.sw_ns)});
+    }
+    if (layer.dma_ns != 0) {
+        ted.customArgs.push_back({"DMA time:", formatDuration(layer.dma_ns)});
+    }
+    return ted;
+}
+
 void TraceEventExporter::processTasks(const std::vector<TaskInfo>& tasks) {
     for (auto& task : tasks) {
         validateTaskNameAndDuration(task);
     }
 
+    const TaskList taskList(tasks);
+
     //
     // Export DMA tasks
     //
-    auto dmaTasks = TaskList(tasks).selectDMAtasks();
+    auto dmaTasks = taskList.selectDMAtasks();
     processTraceEvents(dmaTasks, DMA_PROCESS_NAME, /* createNewProcess= */ true);
 
     //
     // Export cluster tasks (DPU and SW)
     //
-    unsigned clusterCount = TaskList(tasks).getClusterCount();
+    unsigned clusterCount = taskList.getClusterCount();
 
-    TaskList dpuTasks = TaskList(tasks).selectDPUtasks();
-    TaskList swTasks = TaskList(tasks).selectSWtasks();
+    TaskList dpuTasks = taskList.selectDPUtasks();
+    TaskList swTasks = taskList.selectSWtasks();
 
     for (unsigned clusterId = 0; clusterId < clusterCount; clusterId++) {
         std::string processName = std::string(CLUSTER_PROCESS_NAME) + " (" + std::to_string(clusterId) + ")";
@@ -228,13 +286,13 @@ void TraceEventExporter::processTasks(const std::vector<TaskInfo>& tasks) {
     //
     // Export non-clustered SW tasks into separate UPA process
     //
-    TaskList upaTasks = TaskList(tasks).selectUPAtasks();
+    TaskList upaTasks = taskList.selectUPAtasks();
     processTraceEvents(upaTasks, UPA_PROCESS_NAME, /* createNewProcess= */ true);
 
     VPUX_THROW_WHEN(!upaTasks.empty() && !swTasks.empty(),
                     "UPA and Shave tasks should be mutually exclusive but are found to coexist");
 
-    TaskList m2iTasks = TaskList(tasks).selectM2Itasks();
+    TaskList m2iTasks = taskList.selectM2Itasks();
     processTraceEvents(m2iTasks, M2I_PROCESS_NAME, /* createNewProcess= */ true);
 }
 
@@ -247,28 +305,12 @@ void TraceEventExporter::processLayers(const std::vector<LayerInfo>& layers) {
     _threadId = 0;
 
     TraceEventTimeOrderedDistribution layersDistr;
+    auto& pending = _pendingEvents.emplace_back();
+    pending.processId = _processId;
+    pending.layers = layers;
+    pending.threadIds.reserve(layers.size());
     for (auto& layer : layers) {
-        TraceEventDesc ted;
-        ted.name = layer.name;
-        ted.category = "Layer";
-        ted.pid = _processId;
-        ted.tid = layersDistr.getThreadId(layer.start_time_ns, layer.duration_ns);
-        // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
-        ted.timestamp = layer.start_time_ns / 1000.;
-        ted.duration = layer.duration_ns / 1000.;
-        ted.customArgs.push_back({"Layer type", layer.layer_type});
-
-        if (layer.dpu_ns != 0) {
-            ted.customArgs.push_back({"DPU time:", formatDuration(layer.dpu_ns)});
-        }
-        if (layer.sw_ns != 0) {
-            ted.customArgs.push_back({"Shave time:", formatDuration(layer.sw_ns)});
-        }
-        if (layer.dma_ns != 0) {
-            ted.customArgs.push_back({"DMA time:", formatDuration(layer.dma_ns)});
-        }
-
-        _events.push_back(ted);
+        pending.threadIds.push_back(layersDistr.getThreadId(layer.start_time_ns, layer.duration_ns));
     }
 
     setTraceEventProcessName(LAYER_PROCESS_NAME, _processId);
@@ -309,31 +351,17 @@ void TraceEventExporter::processTraceEvents(const TaskList& tasks, const std::st
 
     TraceEventTimeOrderedDistribution threadDistr;
 
-    auto sortedTasks = tasks.getSortedByStartTime();
-    for (const auto& task : sortedTasks) {
+    auto& pending = _pendingEvents.emplace_back();
+    pending.processId = _processId;
+    pending.tasks = tasks.getSortedByStartTime();
+    pending.threadIds.reserve(tasks.size());
+    for (const auto& task : pending.tasks) {
         auto thId = _threadId + threadDistr.getThreadId(task.start_time_ns, task.duration_ns);
         if (thId > lastThreadId) {
             setTraceEventThreadName(getTraceEventThreadName(task), thId, _processId);
             lastThreadId = thId;
         }
-
-        TraceEventDesc ted;
-        ted.name = task.name;
-        ted.category = enumToStr.at(task.exec_type);
-        ted.pid = _processId;
-        ted.tid = thId;
-        // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
-        ted.timestamp = task.start_time_ns / 1000.;
-        ted.duration = task.duration_ns / 1000.;
-
-        if (task.active_cycles != 0) {
-            ted.customArgs.push_back({"Active cycles:", std::to_string(task.active_cycles)});
-        }
-        if (task.stall_cycles != 0) {
-            ted.customArgs.push_back({"Stall cycles:", std::to_string(task.stall_cycles)});
-        }
-
-        _events.push_back(ted);
+        pending.threadIds.push_back(thId);
     }
 
     _threadId = lastThreadId;
@@ -356,14 +384,28 @@ TraceEventExporter::~TraceEventExporter() noexcept(false) {
     _outStream.flush();
 }
 
+void TraceEventExporter::writeTraceEvent(const TraceEventDesc& event) {
+    if (_numWrittenEvents != 0) {
+        _outStream << ",\n";
+    }
+    _outStream << event;
+    ++_numWrittenEvents;
+}
+
 void TraceEventExporter::flushAsTraceEvents() {
-    if (!_events.empty()) {
-        for (auto tedIt = _events.begin(); tedIt != std::prev(_events.end()); ++tedIt) {
-            _outStream << *tedIt << ",\n";
+    for (const auto& pending : _pendingEvents) {
+        for (size_t i = 0; i < pending.tasks.size(); ++i) {
+            writeTraceEvent(makeTaskTraceEvent(pending.tasks[i], pending.processId, pending.threadIds[i]));
+        }
+        for (size_t i = 0; i < pending.layers.size(); ++i) {
+            writeTraceEvent(makeLayerTraceEvent(pending.layers[i], pending.processId, pending.threadIds[i]));
         }
-        _outStream << _events.back() << std::endl;
-        _events.clear();
     }
+    if (_numWrittenEvents != 0) {
+        _outStream << "\n";
+    }
+    _pendingEvents.clear();
+    _numWrittenEvents = 0;
     // close traceEvents block
     _outStream << "],\n";
     _outStream.flush();
@@ -372,19 +414,19 @@ void TraceEventExporter::flushAsTraceEvents() {
 void TraceEventExporter::setTraceEventProcessName(const std::string& processName, int processId,
                                                   const std::string& suffixStr) {
     _outStream << std::string(R"({"name": "process_name", "ph": "M", "pid":)") << processId
-               << R"(, "args": {"name" : ")" << processName << R"("}})" << suffixStr << std::endl;
+               << R"(, "args": {"name" : ")" << processName << R"("}})" << suffixStr << '\n';
 }
 
 void TraceEventExporter::setTraceEventThreadName(const std::string& threadName, int threadId, int processId,
                                                  const std::string& suffixStr) {
     _outStream << std::string(R"({"name": "thread_name", "ph": "M", "pid":)") << processId << R"(, "tid":)" << threadId
-               << R"(, "args": {"name" : ")" << threadName << R"("}})" << suffixStr << std::endl;
+               << R"(, "args": {"name" : ")" << threadName << R"("}})" << suffixStr << '\n';
 }
 
 void TraceEventExporter::setTraceEventProcessSortIndex(int processId, unsigned sortIndex,
                                                        const std::string& suffixStr) {
     _outStream << std::string(R"({"name": "process_sort_index", "ph": "M", "pid":)") << processId
-               << R"(, "args": {"sort_index" : ")" << sortIndex << R"("}})" << suffixStr << std::endl;
+               << R"(, "args": {"sort_index" : ")" << sortIndex << R"("}})" << suffixStr << '\n';
 }
 
 const char* to_string(const FreqStatus& freqStatus) {
@@ -25,33 +25,33 @@ void vpux::profiling::printProfilingAsText(const std::vector<TaskInfo>& tasks, c
             exec_type_str = "DMA";
             output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
                    << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
-                   << (float)task.start_time_ns / 1000 << std::endl;
+                   << (float)task.start_time_ns / 1000 << '\n';
             break;
         case TaskInfo::ExecType::DPU:
             exec_type_str = "DPU";
             output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
                    << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
-                   << (float)task.start_time_ns / 1000 << std::endl;
+                   << (float)task.start_time_ns / 1000 << '\n';
             break;
         case TaskInfo::ExecType::SW:
             exec_type_str = "SW";
             output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
                    << (float)task.duration_ns / 1000 << "\tCycles:" << task.active_cycles << "(" << task.stall_cycles
                    << ")"
-                   << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << std::endl;
+                   << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << '\n';
             break;
         case TaskInfo::ExecType::UPA:
             exec_type_str = "UPA";
             output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
                    << (float)task.duration_ns / 1000 << "\tCycles:" << task.active_cycles << "(" << task.stall_cycles
                    << ")"
-                   << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << std::endl;
+                   << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << '\n';
             break;
         case TaskInfo::ExecType::M2I:
             exec_type_str = "M2I";
             output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
                    << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
-                   << (float)task.start_time_ns / 1000 << std::endl;
+                   << (float)task.start_time_ns / 1000 << '\n';
             break;
         default:
             break;
@@ -68,7 +68,7 @@ void vpux::profiling::printProfilingAsText(const std::vector<TaskInfo>& tasks, c
         output << "Layer: " << std::setw(40) << layer.name << " Type: " << std::setw(20) << layer.layer_type
                << " DPU: " << std::setw(8) << (float)layer.dpu_ns / 1000 << " SW: " << std::setw(8)
                << (float)layer.sw_ns / 1000 << " DMA: " << std::setw(8) << (float)layer.dma_ns / 1000
-               << "\tStart: " << (float)layer.start_time_ns / 1000 << std::endl;
+               << "\tStart: " << (float)layer.start_time_ns / 1000 << '\n';
         total_time += layer.dpu_ns + layer.sw_ns + layer.dma_ns;
     }
 
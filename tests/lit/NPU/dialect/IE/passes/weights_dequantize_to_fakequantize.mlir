@@ -414,3 +414,37 @@ func.func @DontBlockArgMultToFakeQuantize(%input: tensor<1x4x28x28xui8>) -> tens
 
   // CHECK:   return [[ADD]] : tensor<1x4x28x28xf32>
 }
+
+// -----
+
+{-#
+  dialect_resources: {
+    // Note: first 4 bytes in the dense_resource blob specify alignment, the I4 elements are packed two per byte
+    builtin: {
+      packed_i4_weights: "0x040000006745152300"
+    }
+  }
+#-}
+
+// CHECK-LABEL: @SharedPackedI4WeightsMultToFakeQuantize
+// CHECK-SAME:      [[INPUT:%.*]]: tensor<1x1x28x28xf16>
+func.func @SharedPackedI4WeightsMultToFakeQuantize(%input: tensor<1x1x28x28xf16>) -> tensor<1x1x28x28xf16> {
+  %cst_0 = const.Declare tensor<1x1x3x3xsi4> = dense_resource<packed_i4_weights> : tensor<1x1x3x3xsi4>
+  %cst_1 = const.Declare tensor<1x1x1x1xf16> = dense<[[[[0.00294781756]]]]> : tensor<1x1x1x1xf16>
+  %0 = IE.Convert(%cst_0) { dstElemType = f16 } : tensor<1x1x3x3xsi4> -> tensor<1x1x3x3xf16>
+  %1 = IE.Multiply(%0, %cst_1) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x1x3x3xf16>, tensor<1x1x1x1xf16> -> tensor<1x1x3x3xf16>
+  %2 = IE.Convolution(%input, %1) {dilations = [1, 1], pads_begin = [1, 1], pads_end = [1, 1], strides = [1, 1]} : tensor<1x1x28x28xf16>, tensor<1x1x3x3xf16> -> tensor<1x1x28x28xf16>
+
+  return %2 : tensor<1x1x28x28xf16>
+
+  // CHECK-DAG:   [[CST_0:%.*]] = const.Declare tensor<1x1x1x1xf16> = dense<-8.000000e+00> : tensor<1x1x1x1xf16>
+  // CHECK-DAG:   [[CST_1:%.*]] = const.Declare tensor<1x1x1x1xf16> = dense<7.000000e+00> : tensor<1x1x1x1xf16>
+  // CHECK-DAG:   [[CST_2:%.*]] = const.Declare tensor<1x1x1x1xf16> = dense<-2.359010e-02> : tensor<1x1x1x1xf16>
+  // CHECK-DAG:   [[CST_3:%.*]] = const.Declare tensor<1x1x1x1xf16> = dense<2.064510e-02> : tensor<1x1x1x1xf16>
+  // CHECK-DAG:   [[CST_4:%.*]] = const.Declare tensor<1x1x3x3xf16>
+  // CHECK-SAME{LITERAL}  = dense<[[[[7.000000e+00, 6.000000e+00, 5.000000e+00], [4.000000e+00, 5.000000e+00, 1.000000e+00], [3.000000e+00, 2.000000e+00, 0.000000e+00]]]]> : tensor<1x1x3x3xf16>
+  // CHECK:   [[WT_FQ:%.*]] = IE.FakeQuantize([[CST_4]], [[CST_0]], [[CST_1]], [[CST_2]], [[CST_3]]) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>, levels = 16 : i64} : tensor<1x1x3x3xf16>, tensor<1x1x1x1xf16>, tensor<1x1x1x1xf16>, tensor<1x1x1x1xf16>, tensor<1x1x1x1xf16> -> tensor<1x1x3x3xf16>
+  // CHECK:   [[CONV:%.*]] = IE.Convolution([[INPUT]], [[WT_FQ]]) {dilations = [1, 1], pads_begin = [1, 1], pads_end = [1, 1], strides = [1, 1]} : tensor<1x1x28x28xf16>, tensor<1x1x3x3xf16> -> tensor<1x1x28x28xf16>
+
+  // CHECK:   return [[CONV]] : tensor<1x1x28x28xf16>
+}
@@ -0,0 +1,88 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --static-allocation="memory-space=DDR" %s | FileCheck %s --check-prefix=SCAN
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --static-allocation="memory-space=DDR offline-placement=true" %s | FileCheck %s --check-prefix=OFFLINE
+// REQUIRES: arch-NPU37XX || arch-NPU40XX
+
+// The buffer %bufA dies before %bufC is allocated, but the hole it leaves below %bufB is too small for %bufC.
+// Knowing all the live ranges, the offline placement puts %bufC first and %bufA into the space %bufC doesn't use yet
+
+// SCAN-LABEL: @HoleBelowLongLivingBuffer
+// OFFLINE-LABEL: @HoleBelowLongLivingBuffer
+module @HoleBelowLongLivingBuffer {
+
+IE.CNNNetwork
+    entryPoint : @main
+    inputsInfo : {
+        DataInfo "data" : tensor<1x1x1x32xf16>
+        DataInfo "data2" : tensor<1x1x1x64xf16>
+    }
+    outputsInfo : {
+        DataInfo "prob" : tensor<1x1x1x32xf16>
+        DataInfo "prob2" : tensor<1x1x1x32xf16>
+        DataInfo "prob3" : tensor<1x1x1x64xf16>
+    }
+
+func.func @main(%in: memref<1x1x1x32xf16>, %in2: memref<1x1x1x64xf16>,
+                %out: memref<1x1x1x32xf16>, %out2: memref<1x1x1x32xf16>, %out3: memref<1x1x1x64xf16>)
+        -> (memref<1x1x1x32xf16>, memref<1x1x1x32xf16>, memref<1x1x1x64xf16>) {
+    %bufA = memref.alloc() : memref<1x1x1x32xf16, @DDR>
+    %bufB = memref.alloc() : memref<1x1x1x32xf16, @DDR>
+    %bufC = memref.alloc() : memref<1x1x1x64xf16, @DDR>
+
+    %t0, %f0 = async.execute -> !async.value<memref<1x1x1x32xf16, @DDR>>
+        attributes {VPUIP.executor = @SHAVE_UPA, VPUIP.num_units = 1 : i64, "async-deps-index" = 0 : i64} {
+        %0 = VPUIP.ReLUUPA inputs(%in : memref<1x1x1x32xf16>) outputs(%bufA : memref<1x1x1x32xf16, @DDR>) -> memref<1x1x1x32xf16, @DDR>
+        async.yield %0 : memref<1x1x1x32xf16, @DDR>
+    }
+
+    %t1, %f1 = async.execute [%t0] -> !async.value<memref<1x1x1x32xf16, @DDR>>
+        attributes {VPUIP.executor = @SHAVE_UPA, VPUIP.num_units = 1 : i64, "async-deps-index" = 1 : i64} {
+        %1 = VPUIP.ReLUUPA inputs(%in : memref<1x1x1x32xf16>) outputs(%bufB : memref<1x1x1x32xf16, @DDR>) -> memref<1x1x1x32xf16, @DDR>
+        async.yield %1 : memref<1x1x1x32xf16, @DDR>
+    }
+
+    %t2, %f2 = async.execute [%t1] (%f0 as %0 : !async.value<memref<1x1x1x32xf16, @DDR>>) -> !async.value<memref<1x1x1x32xf16>>
+        attributes {VPUIP.executor = @SHAVE_UPA, VPUIP.num_units = 1 : i64, "async-deps-index" = 2 : i64} {
+        %2 = VPUIP.ReLUUPA inputs(%0 : memref<1x1x1x32xf16, @DDR>) outputs(%out : memref<1x1x1x32xf16>) -> memref<1x1x1x32xf16>
+        async.yield %2 : memref<1x1x1x32xf16>
+    }
+
+    %t3, %f3 = async.execute [%t2] -> !async.value<memref<1x1x1x64xf16, @DDR>>
+        attributes {VPUIP.executor = @SHAVE_UPA, VPUIP.num_units = 1 : i64, "async-deps-index" = 3 : i64} {
+        %3 = VPUIP.ReLUUPA inputs(%in2 : memref<1x1x1x64xf16>) outputs(%bufC : memref<1x1x1x64xf16, @DDR>) -> memref<1x1x1x64xf16, @DDR>
+        async.yield %3 : memref<1x1x1x64xf16, @DDR>
+    }
+
+    %t4, %f4 = async.execute [%t3] (%f1 as %1 : !async.value<memref<1x1x1x32xf16, @DDR>>) -> !async.value<memref<1x1x1x32xf16>>
+        attributes {VPUIP.executor = @SHAVE_UPA, VPUIP.num_units = 1 : i64, "async-deps-index" = 4 : i64} {
+        %4 = VPUIP.ReLUUPA inputs(%1 : memref<1x1x1x32xf16, @DDR>) outputs(%out2 : memref<1x1x1x32xf16>) -> memref<1x1x1x32xf16>
+        async.yield %4 : memref<1x1x1x32xf16>
+    }
+
+    %t5, %f5 = async.execute [%t4] (%f3 as %3 : !async.value<memref<1x1x1x64xf16, @DDR>>) -> !async.value<memref<1x1x1x64xf16>>
+        attributes {VPUIP.executor = @SHAVE_UPA, VPUIP.num_units = 1 : i64, "async-deps-index" = 5 : i64} {
+        %5 = VPUIP.ReLUUPA inputs(%3 : memref<1x1x1x64xf16, @DDR>) outputs(%out3 : memref<1x1x1x64xf16>) -> memref<1x1x1x64xf16>
+        async.yield %5 : memref<1x1x1x64xf16>
+    }
+
+    %r0 = async.await %f2 : !async.value<memref<1x1x1x32xf16>>
+    %r1 = async.await %f4 : !async.value<memref<1x1x1x32xf16>>
+    %r2 = async.await %f5 : !async.value<memref<1x1x1x64xf16>>
+    return %r0, %r1, %r2 : memref<1x1x1x32xf16>, memref<1x1x1x32xf16>, memref<1x1x1x64xf16>
+
+    // SCAN:        IE.MemoryResource 256 bytes of @DDR
+    // SCAN:        VPUIP.StaticAlloc<0> -> memref<1x1x1x32xf16, @DDR>
+    // SCAN:        VPUIP.StaticAlloc<64> -> memref<1x1x1x32xf16, @DDR>
+    // SCAN:        VPUIP.StaticAlloc<128> -> memref<1x1x1x64xf16, @DDR>
+
+    // OFFLINE:     IE.MemoryResource 192 bytes of @DDR
+    // OFFLINE:     VPUIP.StaticAlloc<0> -> memref<1x1x1x32xf16, @DDR>
+    // OFFLINE:     VPUIP.StaticAlloc<128> -> memref<1x1x1x32xf16, @DDR>
+    // OFFLINE:     VPUIP.StaticAlloc<0> -> memref<1x1x1x64xf16, @DDR>
+}
+
+}
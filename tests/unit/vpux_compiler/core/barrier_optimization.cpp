@@ -814,3 +814,41 @@ TEST_F(BarrierInfoTests, optimizeParallelBlocksWithTooFewVariantsPerBarrier) {
     optimizedResult = barrierInfoTest.optimizeBarriers(/* checkValidSlotCount */ false);
     checkBarrierMaps(expectedResult, optimizedResult);
 }
+
+/**
+ * Test that blocks optimized together in BarrierInfo::optimizeBarriers give the same result
+ * as the blocks optimized one after another
+ */
+TEST_F(BarrierInfoTests, optimizeBarriersWithTwoTaskBlocks) {
+    auto [barrierConfig, expectedResult] = redundantConsumersWithTwoBlockTaskSplitConfig({0, 1});
+    BarrierInfoTest barrierInfoTest(barrierConfig);
+    barrierInfoTest.setMaxVariantCountPerBarrier(64);
+    auto optimizedResult = barrierInfoTest.optimizeBarriers();
+    checkBarrierMaps(expectedResult, optimizedResult);
+}
+
+/**
+ * Test BarrierInfo::updateTaskControlMap
+ * Tasks 1 and 2 are independent, a new dependency 1 -> 2 is added by making task 2 a consumer of barrier 1.
+ * Updated control map should be the same as the map built from scratch.
+ */
+TEST_F(BarrierInfoTests, updateTaskControlMap) {
+    auto [barrierConfig, expectedResult] = redundantProducerConfig();
+    BarrierInfoTest barrierInfoTest(barrierConfig);
+
+    auto [taskControlMap, controlMapOffset] =
+            barrierInfoTest.buildTaskControlMap(/* blockIdx */ 0, /* considerTaskFifoDependency */ false);
+    ASSERT_EQ(controlMapOffset, 0);
+    EXPECT_FALSE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 1, 2));
+
+    barrierInfoTest.addConsumer(/* barrierInd */ 1, /* taskInd */ 2);
+    barrierInfoTest.updateTaskControlMap(taskControlMap, controlMapOffset, barrierInfoTest.getBarrierProducers(1),
+                                         barrierInfoTest.getBarrierConsumers(1));
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 1, 2,
+                                                                         /* biDirection */ false));
+
+    auto [expectedTaskControlMap, expectedControlMapOffset] =
+            barrierInfoTest.buildTaskControlMap(/* blockIdx */ 0, /* considerTaskFifoDependency */ false);
+    EXPECT_EQ(controlMapOffset, expectedControlMapOffset);
+    EXPECT_EQ(taskControlMap, expectedTaskControlMap);
+}
@@ -0,0 +1,138 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/compilation_cache.hpp"
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+class MLIR_CompilationCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("npu-compilation-cache", _directory));
+    }
+
+    void TearDown() override {
+        std::ignore = llvm::sys::fs::remove_directories(_directory);
+    }
+
+    CompilationCache createCache(uint64_t maxSize = 1024 * 1024) const {
+        return CompilationCache(_directory, maxSize, std::chrono::hours(1), Logger::global());
+    }
+
+    llvm::SmallString<128> getPath(StringRef fileName) const {
+        llvm::SmallString<128> path(_directory);
+        llvm::sys::path::append(path, fileName);
+        return path;
+    }
+
+    void createFile(StringRef fileName) const {
+        std::error_code errc;
+        llvm::raw_fd_ostream os(getPath(fileName), errc);
+        ASSERT_FALSE(errc);
+        os << "content";
+    }
+
+    // Eviction relies on the modification times, set them explicitly instead of depending on the time between
+    // the calls and the timestamp granularity of the file system
+    void setLastUse(StringRef fileName, std::chrono::seconds age) const {
+        int fd = -1;
+        ASSERT_FALSE(llvm::sys::fs::openFileForWrite(getPath(fileName), fd, llvm::sys::fs::CD_OpenExisting,
+                                                     llvm::sys::fs::OF_Append));
+        const auto time = std::chrono::system_clock::now() - age;
+        EXPECT_FALSE(llvm::sys::fs::setLastAccessAndModificationTime(fd, time, time));
+        llvm::sys::fs::closeFile(fd);
+    }
+
+    bool exists(StringRef fileName) const {
+        return llvm::sys::fs::exists(getPath(fileName));
+    }
+
+    llvm::SmallString<128> _directory;
+};
+
+TEST_F(MLIR_CompilationCacheTests, StoreAndLookup) {
+    const auto cache = createCache();
+    const std::vector<uint8_t> blob = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    const auto statsBefore = CompilationCache::getStatistics();
+
+    EXPECT_FALSE(cache.lookup("key").has_value());
+    cache.store("key", blob);
+
+    const auto cachedBlob = cache.lookup("key");
+    ASSERT_TRUE(cachedBlob.has_value());
+    EXPECT_EQ(cachedBlob.value(), blob);
+
+    const auto statsAfter = CompilationCache::getStatistics();
+    EXPECT_EQ(statsAfter.hits - statsBefore.hits, 1u);
+    EXPECT_EQ(statsAfter.misses - statsBefore.misses, 1u);
+    EXPECT_EQ(statsAfter.stores - statsBefore.stores, 1u);
+}
+
+TEST_F(MLIR_CompilationCacheTests, CorruptedEntryIsIgnored) {
+    const auto cache = createCache();
+    cache.store("key", std::vector<uint8_t>(16, 0xAB));
+
+    llvm::SmallString<128> entryPath(_directory);
+    llvm::sys::path::append(entryPath, "key.blob");
+
+    std::error_code errc;
+    llvm::raw_fd_ostream os(entryPath, errc);
+    ASSERT_FALSE(errc);
+    os << "garbage";
+    os.close();
+
+    EXPECT_FALSE(cache.lookup("key").has_value());
+}
+
+TEST_F(MLIR_CompilationCacheTests, EvictLeastRecentlyUsed) {
+    // Each entry takes 1 KB of payload plus the header, so only two of them fit
+    const auto cache = createCache(2 * 1024 + 64);
+    const std::vector<uint8_t> blob(1024, 0);
+
+    cache.store("first", blob);
+    cache.store("second", blob);
+    setLastUse("first.blob", std::chrono::minutes(3));
+    setLastUse("second.blob", std::chrono::minutes(2));
+
+    // Make "first" the most recently used entry
+    ASSERT_TRUE(cache.lookup("first").has_value());
+
+    cache.store("third", blob);
+
+    EXPECT_TRUE(cache.lookup("first").has_value());
+    EXPECT_FALSE(cache.lookup("second").has_value());
+    EXPECT_TRUE(cache.lookup("third").has_value());
+}
+
+TEST_F(MLIR_CompilationCacheTests, EvictExpiredEntriesOnly) {
+    const auto cache = createCache();
+    cache.store("expired", std::vector<uint8_t>(16, 0));
+    cache.store("fresh", std::vector<uint8_t>(16, 0));
+    createFile("stale.blob.tmp-12345678");
+    createFile("foreign.txt");
+    createFile("foreign.blob.bak");
+
+    const auto age = std::chrono::hours(2);
+    for (const auto fileName : {"expired.blob", "stale.blob.tmp-12345678", "foreign.txt", "foreign.blob.bak"}) {
+        setLastUse(fileName, age);
+    }
+
+    cache.evict();
+
+    EXPECT_FALSE(exists("expired.blob"));
+    EXPECT_FALSE(exists("stale.blob.tmp-12345678"));
+    EXPECT_TRUE(exists("fresh.blob"));
+
+    // Unrelated files in a shared directory are never removed
+    EXPECT_TRUE(exists("foreign.txt"));
+    EXPECT_TRUE(exists("foreign.blob.bak"));
+}
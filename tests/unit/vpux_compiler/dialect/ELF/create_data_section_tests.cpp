@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/NPU40XX/dialect/ELF/ops.hpp"
+#include "vpux/compiler/dialect/VPUASM/ops.hpp"
+#include "vpux/compiler/utils/ELF/utils.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser/Parser.h>
+
+#include <vpux_elf/writer.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+using MLIR_ELF_CreateDataSection = vpux::VPU::arch40xx::UnitTest;
+
+TEST_F(MLIR_ELF_CreateDataSection, ParallelSerializationMatchesSequential) {
+    // The second constant is larger than the 64 MB chunk of the parallel serialization, so it takes a chunk alone
+    constexpr llvm::StringLiteral inputIR = R"(
+    module @test {
+        func.func @main() {
+            ELF.Main @ELFMain {
+                ELF.CreateSection @buffer.Constant.0.constant aligned(64) secType(SHT_PROGBITS) secFlags(SHF_ALLOC) {
+                    VPUASM.ConstBuffer @Declare0 !VPUASM.Buffer< "Constant"[0] <0> : memref<1x1x2x4xf16> : swizzling(0)> = dense<[[[[1.0, 2.0, 3.0, 4.0], [5.0, 6.0, 7.0, 8.0]]]]> : tensor<1x1x2x4xf16>
+                    ELF.Pad size(48) value(171)
+                    VPUASM.ConstBuffer @Declare1 !VPUASM.Buffer< "Constant"[0] <64> : memref<1x1x65537x1024xui8> : swizzling(0)> = dense<7> : tensor<1x1x65537x1024xui8>
+                    ELF.Pad size(13)
+                    VPUASM.ConstBuffer @Declare2 !VPUASM.Buffer< "Constant"[0] <67109965> : memref<1x1x1x3xsi32> : swizzling(0)> = dense<[[[[-1, 0, 1]]]]> : tensor<1x1x1x3xsi32>
+                }
+            }
+            return
+        }
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+    auto elfMain = *func.getOps<ELF::MainOp>().begin();
+    auto sectionOp = *elfMain.getOps<ELF::DataSectionOp>().begin();
+
+    ELF::SymbolReferenceMap symRefMap(elfMain, true);
+
+    elf::Writer parallelWriter;
+    ELF::SectionMapType sectionMap;
+    ELF::SymbolMapType symbolMap;
+    sectionOp.serialize(parallelWriter, sectionMap, symbolMap, symRefMap);
+
+    // Reference: the ops appended one by one, as for the sections which can't be serialized to a buffer
+    elf::Writer sequentialWriter;
+    auto section = sequentialWriter.addBinaryDataSection<uint8_t>(sectionOp.getSymName().str(),
+                                                                  static_cast<uint32_t>(sectionOp.getSecType()));
+    section->maskFlags(static_cast<elf::Elf_Xword>(sectionOp.getSecFlags()));
+    section->setAddrAlign(sectionOp.getSecAddrAlign());
+    for (auto binaryOp : sectionOp.getBody()->getOps<ELF::BinaryOpInterface>()) {
+        ASSERT_TRUE(binaryOp.canSerializeToBuffer());
+        binaryOp.serializeCached(*section, symRefMap);
+    }
+
+    const auto parallelBlob = parallelWriter.generateELF();
+    const auto sequentialBlob = sequentialWriter.generateELF();
+    EXPECT_GT(parallelBlob.size(), 64 * 1024 * 1024);
+    EXPECT_TRUE(parallelBlob == sequentialBlob);
+}
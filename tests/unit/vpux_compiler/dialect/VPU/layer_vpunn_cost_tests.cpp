@@ -10,6 +10,7 @@
 
 #include "common/utils.hpp"
 #include "vpux/compiler/core/cost_model_utils.hpp"
+#include "vpux/compiler/utils/VPU/tile_utils.hpp"
 
 #include <mlir/IR/MLIRContext.h>
 #include <mlir/Parser/Parser.h>
@@ -293,3 +294,57 @@ TEST_F(MLIR_VPU_LayerVPUNNCost, DMA_Cost) {
                   spillRefCost);
     });
 }
+
+TEST_F(MLIR_VPU_LayerVPUNNCost, StrategyEvaluationKeepsIR) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+    module @main {
+        func.func @main(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>, %wt: tensor<16x1x1x4xsi32>, %weights: tensor<16x16x1x1xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+        %1 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [16, 16, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x16x16x16xf16, {order = #NHWC}> loc(fused["Conv_100", "t_Convolution"])
+
+        return %1 : tensor<1x16x16x16xf16, {order = #NHWC}>
+    }
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+    auto initCompilerOptions = VPU::InitCompilerOptions(ArchKind::NPU37XX, VPU::CompilationMode::DefaultHW);
+
+    VPU::buildInitCompilerPipeline(pm, initCompilerOptions, vpux::Logger::global());
+
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+
+    VPU::LayerVPUNNCost layerCost(func);
+
+    func->walk([&](VPU::NCEConvolutionOp convOp) {
+        const auto outTile = TileInfo(getShape(convOp.getResult()));
+        for (auto strategy : {VPU::MultiClusterStrategy::Clustering, VPU::MultiClusterStrategy::SplitOverHeight,
+                              VPU::MultiClusterStrategy::SplitOverKernel}) {
+            const auto tileTypes = VPU::getTileTypesForStrategy(convOp, outTile, strategy);
+            const auto cost = layerCost.getStrategyCost(convOp, strategy);
+            layerCost.getSpillingReadCost(convOp, strategy, nullptr, [](mlir::Value operand) {
+                return operand.isa<mlir::BlockArgument>();
+            });
+
+            // The evaluation doesn't leave any strategy in the IR
+            EXPECT_FALSE(convOp->hasAttr(VPU::multiClusterStrategy));
+
+            // and gives the same result as the evaluation with the strategy assigned to the operation
+            convOp.setMultiClusterStrategy(strategy);
+            EXPECT_EQ(tileTypes, VPU::getTileTypes(convOp.getOperation(), outTile));
+            EXPECT_EQ(cost, layerCost.getStrategyCost(convOp, strategy));
+            convOp->removeAttr(VPU::multiClusterStrategy);
+        }
+    });
+}
@@ -20,6 +20,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 namespace {
 
 constexpr int64_t numDPU = 5;
@@ -107,3 +109,77 @@ TEST(MLIR_VPU_WorkloadCost, VPUNNCostInterface) {
         }
     }
 }
+
+TEST(MLIR_VPU_WorkloadCost, SharedCostModel) {
+    mlir::MLIRContext ctx;
+
+    const auto costModel = vpux::VPU::createCostModel(vpux::VPU::ArchKind::NPU37XX);
+    EXPECT_EQ(costModel, vpux::VPU::createCostModel(vpux::VPU::ArchKind::NPU37XX));
+    EXPECT_NE(vpux::VPU::createLayerCostModel(vpux::VPU::ArchKind::NPU37XX, /*isFastModel=*/true),
+              vpux::VPU::createLayerCostModel(vpux::VPU::ArchKind::NPU37XX, /*isFastModel=*/false));
+
+    // VPUNN models are not thread-safe, so each thread gets its own instance
+    std::shared_ptr<VPUNN::VPUCostModel> otherThreadCostModel;
+    std::thread([&]() {
+        otherThreadCostModel = vpux::VPU::createCostModel(vpux::VPU::ArchKind::NPU37XX);
+    }).join();
+    EXPECT_NE(costModel, otherThreadCostModel);
+
+    const NceOpTensorShape tensorShape(vpux::ShapeRef({1, 64, 32, 32}), vpux::ShapeRef({1, 64, 32, 32}));
+    const auto costParams = buildWorkloadCost(tensorShape, &ctx);
+    const auto workloadTile =
+            vpux::VPUIP::WorkloadTile(vpux::TileInfo(costParams.outputShape), vpux::VPU::MPEMode::CUBOID_16x16);
+    const auto workload = vpux::VPU::getDPUWorkload(costParams, workloadTile);
+
+    std::string info;
+    const auto expectedCost = costModel->DPU(workload, info);
+    EXPECT_EQ(vpux::VPU::getDPUWorkloadCost(*costModel, workload, info), expectedCost);
+
+    // The same query from another thread is served by the process-wide memoization table
+    VPUNN::CyclesInterfaceType otherThreadCost = 0;
+    std::thread([&]() {
+        std::string threadInfo;
+        const auto threadCostModel = vpux::VPU::createCostModel(vpux::VPU::ArchKind::NPU37XX);
+        otherThreadCost = vpux::VPU::getDPUWorkloadCost(*threadCostModel, workload, threadInfo);
+    }).join();
+    EXPECT_EQ(otherThreadCost, expectedCost);
+}
+
+TEST(MLIR_VPU_WorkloadCost, BatchedSplitPoolCost) {
+    mlir::MLIRContext ctx;
+
+    const auto costModel = vpux::VPU::createCostModel(vpux::VPU::ArchKind::NPU37XX);
+    const NceOpTensorShape tensorShape(vpux::ShapeRef({1, 64, 32, 32}), vpux::ShapeRef({1, 64, 32, 32}));
+    const auto costParams = buildWorkloadCost(tensorShape, &ctx);
+
+    vpux::VPUIP::DpuTiler dpuTiler(costParams.outputShape, vpux::VPU::MPEMode::CUBOID_16x16);
+    vpux::VPUIP::WorkloadSplitPool splitPoolSet;
+    dpuTiler.tileOverH(numDPU, splitPoolSet);
+    for (auto& splitNum : dpuTiler.generateSplitNumberPool(numDPU, maxSplitNum)) {
+        dpuTiler.tileOverZ(splitNum, splitPoolSet);
+    }
+    const auto splitPool = vpux::to_std_vector(splitPoolSet);
+    ASSERT_FALSE(splitPool.empty());
+
+    auto splitCostCb = vpux::VPUIP::getSplitCostCb(costParams.arch);
+    auto splitPoolCostCb = vpux::VPUIP::getSplitPoolCostCb(costParams.arch);
+    const auto splitPoolCosts = splitPoolCostCb(splitPool, costParams, *costModel, vpux::emptyLogCb);
+    ASSERT_EQ(splitPoolCosts.size(), splitPool.size());
+    for (const auto ind : vpux::irange(splitPool.size())) {
+        EXPECT_EQ(splitPoolCosts[ind], splitCostCb(splitPool[ind], costParams, *costModel, vpux::emptyLogCb));
+    }
+
+    // Identical workloads of a batch get identical costs
+    const auto workload = vpux::VPU::getDPUWorkload(
+            costParams,
+            vpux::VPUIP::WorkloadTile(vpux::TileInfo(costParams.outputShape), vpux::VPU::MPEMode::CUBOID_16x16));
+    const std::vector<VPUNN::DPUWorkload> workloads(3, workload);
+    llvm::SmallVector<std::string> infos;
+    const auto costs = vpux::VPU::getDPUWorkloadCosts(*costModel, workloads, infos);
+    ASSERT_EQ(costs.size(), workloads.size());
+    ASSERT_EQ(infos.size(), workloads.size());
+    std::string info;
+    for (const auto cost : costs) {
+        EXPECT_EQ(cost, costModel->DPU(workload, info));
+    }
+}
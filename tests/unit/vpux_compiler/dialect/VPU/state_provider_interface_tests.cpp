@@ -601,3 +601,120 @@ TEST_F(StateProviderInterfaceTests, StateProvider_InitTemp) {
     size_t initTemp = getInitialTemperature(storage);
     EXPECT_EQ(1200, initTemp);
 }
+
+TEST_F(StateProviderInterfaceTests, ParallelTempering_tests) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+    module @main {
+        func.func @main(%arg0: tensor<1x64x28x28xf16, {order = #NHWC}>) -> tensor<1x80x28x28xf16, {order = #NHWC}> {
+        %cst = const.Declare tensor<80x1x1x4xsi32> = dense<10> : tensor<80x1x1x4xsi32>
+        %cst_0 = const.Declare tensor<80x64x3x3xf16, {order = #NHWC}> = dense<1.000000e+00> : tensor<80x64x3x3xf16>, [#const.Reorder<#NHWC>]
+        %cst_1 = const.Declare tensor<1x1x1x16xui8> = dense<10> : tensor<1x1x1x16xui8>
+        %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst)
+            { pad =  #VPU.Padding<bottom = 1 : i64, left = 1 : i64, right = 1 : i64, top = 1 : i64>,
+            rawFilterShape = [80, 64, 3, 3], strides = [1, 1]}
+            -> tensor<1x80x28x28xf16, {order = #NHWC}> loc(fused["Conv_100", "t_Convolution"])
+        %1 = VPU.Tanh(%0) : tensor<1x80x28x28xf16, {order = #NHWC}>
+            -> tensor<1x80x28x28xf16, {order = #NHWC}> loc(fused["Tanh_1", "t_Convolution"])
+        %2 = VPU.NCE.MaxPool(%1, %cst, %cst_1)
+            {kernel_size = [1, 1],
+            pad =  #VPU.Padding<bottom = 0, left = 0, right = 0, top = 0>, strides = [1, 1],
+            activation_window_channel_length = 4}
+            -> tensor<1x80x28x28xf16, {order = #NHWC}> loc(fused["Maxpool_1", "fused","t_Convolution"])
+        return %2 : tensor<1x80x28x28xf16, {order = #NHWC}>
+    }
+  }
+)";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+    auto initCompilerOptions = VPU::InitCompilerOptions(ArchKind::NPU37XX, VPU::CompilationMode::DefaultHW);
+
+    VPU::buildInitCompilerPipeline(pm, initCompilerOptions, vpux::Logger::global());
+
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+
+    auto storage = std::make_shared<OperationStrategies>();
+
+    VPU::Strategy splitOverHStrategy(VPU::MultiClusterStrategy::SplitOverHeight, nullptr);
+    VPU::Strategy splitOverKStrategy(VPU::MultiClusterStrategy::SplitOverKernel,
+                                     getIntArrayAttr(&ctx, ArrayRef({1, 1, 2, 1})));
+    VPU::Strategy multiClusteringStrategy(VPU::MultiClusterStrategy::Clustering, nullptr);
+
+    func->walk([&](VPU::NCEConvolutionOp convOp) {
+        auto convSOH = std::make_pair(convOp, splitOverHStrategy);
+        auto convSOK = std::make_pair(convOp, splitOverKStrategy);
+        auto convClst = std::make_pair(convOp, multiClusteringStrategy);
+
+        storage->addStrategy(convSOH, 1000);
+        storage->addStrategy(convSOK, 1200);
+        storage->addStrategy(convClst, 1400);
+
+        storage->setCurrentStrategy(convSOK);
+        storage->setBestStrategy(convSOK);
+    });
+
+    func->walk([&](VPU::TanhOp tanhOp) {
+        auto tanhSOH = std::make_pair(tanhOp, splitOverHStrategy);
+        auto tanhSOK = std::make_pair(tanhOp, splitOverKStrategy);
+
+        storage->addStrategy(tanhSOH, 2000);
+        storage->addStrategy(tanhSOK, 2200);
+
+        storage->setCurrentStrategy(tanhSOK);
+        storage->setBestStrategy(tanhSOK);
+    });
+
+    func->walk([&](VPU::NCEMaxPoolOp maxOp) {
+        auto maxSOH = std::make_pair(maxOp, splitOverHStrategy);
+        auto maxSOK = std::make_pair(maxOp, splitOverKStrategy);
+        auto maxClst = std::make_pair(maxOp, multiClusteringStrategy);
+
+        storage->addStrategy(maxSOH, 3000);
+        storage->addStrategy(maxSOK, 3200);
+        storage->addStrategy(maxClst, 3400);
+
+        storage->setCurrentStrategy(maxClst);
+        storage->setBestStrategy(maxClst);
+    });
+    const auto vpunnCostFunc = std::make_shared<LayerVPUNNCost>(func);
+    const auto stateProvider = std::make_shared<DefaultStateProvider>(storage, vpunnCostFunc);
+    stateProvider->fillInTransitionCosts();
+
+    // Storage views share the costs, which can't be updated through them
+    const auto view = storage->createView();
+    func->walk([&](VPU::NCEConvolutionOp convOp) {
+        const auto convSOH = std::make_pair(convOp.getOperation(), splitOverHStrategy);
+        view->setCurrentStrategy(convSOH);
+        EXPECT_EQ(storage->getCurrentStrategy(convOp), splitOverKStrategy);
+        EXPECT_ANY_THROW(view->setTransitionCost(convSOH, convSOH, 0));
+    });
+
+    vpux::VPU::TilingOptions options;
+    options.numStrategyReplicas = 4;
+    auto testAlgorithm = createAlgorithm(options, stateProvider, storage,
+                                         [&](const std::shared_ptr<OperationStrategies>& storageView, uint32_t seed) {
+                                             return std::make_shared<DefaultStateProvider>(storageView, vpunnCostFunc,
+                                                                                           seed);
+                                         });
+    ASSERT_NE(dynamic_cast<ParallelTemperingStrategy*>(testAlgorithm.get()), nullptr);
+    testAlgorithm->optimize();
+
+    func->walk([&](VPU::NCEConvolutionOp convOp) {
+        EXPECT_EQ(splitOverHStrategy, storage->getBestStrategy(convOp));
+    });
+
+    func->walk([&](VPU::TanhOp tanhOp) {
+        EXPECT_EQ(splitOverHStrategy, storage->getBestStrategy(tanhOp));
+    });
+
+    func->walk([&](VPU::NCEMaxPoolOp maxOp) {
+        EXPECT_EQ(splitOverHStrategy, storage->getBestStrategy(maxOp));
+    });
+}
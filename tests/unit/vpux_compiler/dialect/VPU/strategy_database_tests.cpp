@@ -0,0 +1,199 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/IR/ops.hpp"
+#include "vpux/compiler/dialect/VPU/utils/strategy_database.hpp"
+
+#include "common/utils.hpp"
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser/Parser.h>
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+using namespace vpux;
+
+using MLIR_VPU_StrategyDatabase = vpux::VPU::arch37xx::UnitTest;
+
+namespace {
+
+// Removes the temporary database file at the end of the test
+class TemporaryFile final {
+public:
+    TemporaryFile() {
+        VPUX_THROW_WHEN(llvm::sys::fs::createTemporaryFile("strategy_database", "json", _path),
+                        "Failed to create temporary file");
+    }
+
+    ~TemporaryFile() {
+        std::ignore = llvm::sys::fs::remove(_path);
+    }
+
+    StringRef path() const {
+        return _path;
+    }
+
+private:
+    llvm::SmallString<128> _path;
+};
+
+}  // namespace
+
+TEST_F(MLIR_VPU_StrategyDatabase, Key) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+    module @main {
+        func.func @first(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>, %wt: tensor<16x1x1x4xsi32>, %weights: tensor<16x16x1x1xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+            %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                    pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                    rawFilterShape = [16, 16, 1, 1],
+                    strides = [1, 1]
+                } -> tensor<1x16x16x16xf16, {order = #NHWC}> loc(fused["Conv_100", "t_Convolution"])
+            return %0 : tensor<1x16x16x16xf16, {order = #NHWC}>
+        }
+
+        func.func @second(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>, %wt: tensor<16x1x1x4xsi32>, %weights: tensor<16x16x1x1xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+            %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                    multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>,
+                    pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                    rawFilterShape = [16, 16, 1, 1],
+                    strides = [1, 1]
+                } -> tensor<1x16x16x16xf16, {order = #NHWC}> loc(fused["Conv_200", "t_Convolution"])
+            return %0 : tensor<1x16x16x16xf16, {order = #NHWC}>
+        }
+
+        func.func @third(%arg0: tensor<1x16x32x16xf16, {order = #NHWC}>, %wt: tensor<16x1x1x4xsi32>, %weights: tensor<16x16x1x1xf16, {order = #NHWC}>) -> tensor<1x16x32x16xf16, {order = #NHWC}> {
+            %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                    pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                    rawFilterShape = [16, 16, 1, 1],
+                    strides = [1, 1]
+                } -> tensor<1x16x32x16xf16, {order = #NHWC}> loc(fused["Conv_100", "t_Convolution"])
+            return %0 : tensor<1x16x32x16xf16, {order = #NHWC}>
+        }
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    const auto getKey = [&](StringRef funcName, StringRef context, bool withMCStrategy = false) {
+        auto func = module.get().lookupSymbol<mlir::func::FuncOp>(funcName);
+        VPUX_THROW_WHEN(func == nullptr, "Function '{0}' is not found", funcName);
+        std::string key;
+        func->walk([&](VPU::NCEConvolutionOp convOp) {
+            key = VPU::getStrategyDatabaseKey(convOp, context, withMCStrategy);
+        });
+        return key;
+    };
+
+    // Location and strategy attributes don't affect the key
+    EXPECT_EQ(getKey("first", "NPU37XX"), getKey("second", "NPU37XX"));
+    // Shapes and the context do
+    EXPECT_NE(getKey("first", "NPU37XX"), getKey("third", "NPU37XX"));
+    EXPECT_NE(getKey("first", "NPU37XX"), getKey("first", "NPU40XX"));
+    // The multi-cluster strategy does on request
+    EXPECT_NE(getKey("first", "NPU37XX", true), getKey("second", "NPU37XX", true));
+    EXPECT_EQ(getKey("first", "NPU37XX", true), getKey("first", "NPU37XX"));
+}
+
+TEST(MLIR_VPU_StrategyDatabaseFile, SaveAndLoad) {
+    TemporaryFile file;
+
+    VPU::StrategyRecord tiledRecord;
+    tiledRecord.mcStrategy = VPU::MultiClusterStrategy::SplitOverHeight;
+    tiledRecord.tilingStrategy = {1, 1, 2, 1};
+    tiledRecord.tilingMode = TilingMode::PREFETCHING;
+
+    VPU::StrategyRecord clusteringRecord;
+    clusteringRecord.mcStrategy = VPU::MultiClusterStrategy::Clustering;
+
+    {
+        VPU::StrategyDatabase database(file.path());
+        EXPECT_EQ(database.size(), 0);
+
+        database.record("tiled", tiledRecord);
+        database.record("clustering", clusteringRecord);
+        database.save();
+    }
+
+    // Another compilation adds its own strategy, the existing ones are kept
+    {
+        VPU::StrategyDatabase database(file.path());
+        EXPECT_EQ(database.size(), 2);
+        EXPECT_EQ(database.lookup("tiled"), tiledRecord);
+        EXPECT_EQ(database.lookup("clustering"), clusteringRecord);
+        EXPECT_FALSE(database.lookup("unknown").has_value());
+
+        VPU::StrategyRecord tilingOnlyRecord;
+        tilingOnlyRecord.tilingStrategy = {1, 2, 1, 1};
+        database.record("tilingOnly", tilingOnlyRecord);
+        database.save();
+    }
+
+    VPU::StrategyDatabase database(file.path());
+    EXPECT_EQ(database.size(), 3);
+    EXPECT_FALSE(database.lookup("tilingOnly")->mcStrategy.has_value());
+}
+
+TEST(MLIR_VPU_StrategyDatabaseFile, CorruptedFile) {
+    TemporaryFile file;
+    {
+        std::error_code errc;
+        llvm::raw_fd_ostream os(file.path(), errc);
+        ASSERT_FALSE(errc);
+        os << R"({"version": 1, "strategies": {"valid": {"multiClusterStrategy": "Clustering"},)"
+           << R"( "invalid": {"multiClusterStrategy": "Unknown"}}})";
+    }
+
+    // Invalid entries are dropped, the database is a cache
+    VPU::StrategyDatabase database(file.path());
+    EXPECT_EQ(database.size(), 1);
+    EXPECT_TRUE(database.lookup("valid").has_value());
+
+    {
+        std::error_code errc;
+        llvm::raw_fd_ostream os(file.path(), errc);
+        ASSERT_FALSE(errc);
+        os << "{ not a json";
+    }
+    EXPECT_EQ(VPU::StrategyDatabase(file.path()).size(), 0);
+}
+
+TEST(MLIR_VPU_StrategyDatabaseFile, PruneLeastRecentlyUsed) {
+    TemporaryFile file;
+    {
+        std::error_code errc;
+        llvm::raw_fd_ostream os(file.path(), errc);
+        ASSERT_FALSE(errc);
+        os << R"({"version": 1, "strategies": {)"
+           << R"("old": {"multiClusterStrategy": "Clustering", "lastUseDay": 1},)"
+           << R"( "looked-up": {"multiClusterStrategy": "Clustering", "lastUseDay": 1},)"
+           << R"( "untracked": {"multiClusterStrategy": "Clustering"}}})";
+    }
+
+    {
+        VPU::StrategyDatabase database(file.path(), Logger::global(), /*maxRecords=*/2);
+        EXPECT_EQ(database.size(), 3);
+
+        // The lookup and the new record make their entries the most recently used ones
+        EXPECT_TRUE(database.lookup("looked-up").has_value());
+        VPU::StrategyRecord record;
+        record.mcStrategy = VPU::MultiClusterStrategy::SplitOverHeight;
+        database.record("new", record);
+        database.save();
+        EXPECT_EQ(database.size(), 2);
+    }
+
+    VPU::StrategyDatabase database(file.path());
+    EXPECT_EQ(database.size(), 2);
+    EXPECT_TRUE(database.lookup("looked-up").has_value());
+    EXPECT_TRUE(database.lookup("new").has_value());
+    EXPECT_FALSE(database.lookup("old").has_value());
+    EXPECT_FALSE(database.lookup("untracked").has_value());
+}
@@ -0,0 +1,148 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/utils/strategy_manager/strategy_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <limits>
+#include <random>
+
+using namespace vpux;
+using namespace vpux::VPU;
+
+namespace {
+
+StrategyGraph::Node makeNode(SmallVector<double> costs) {
+    StrategyGraph::Node node;
+    node.costs = std::move(costs);
+    return node;
+}
+
+StrategyGraph::Edge makeEdge(size_t src, size_t dst, SmallVector<double> costs) {
+    StrategyGraph::Edge edge;
+    edge.src = src;
+    edge.dst = dst;
+    edge.costs = std::move(costs);
+    return edge;
+}
+
+// Minimal cost over all the assignments and the assignment itself
+std::pair<double, SmallVector<size_t>> bruteForce(const StrategyGraph& graph) {
+    SmallVector<size_t> strategyInds(graph.nodes.size(), 0);
+    SmallVector<size_t> bestInds;
+    double bestCost = std::numeric_limits<double>::max();
+
+    std::function<void(size_t)> enumerate = [&](size_t node) {
+        if (node == graph.nodes.size()) {
+            const auto cost = graph.getCost(strategyInds);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestInds = strategyInds;
+            }
+            return;
+        }
+        for (auto ind : irange(graph.nodes[node].costs.size())) {
+            strategyInds[node] = ind;
+            enumerate(node + 1);
+        }
+    };
+    enumerate(0);
+
+    return {bestCost, bestInds};
+}
+
+}  // namespace
+
+TEST(MLIR_VPU_StrategyGraph, Chain) {
+    // Each operation prefers the first strategy, but switching the strategy between neighbours is expensive
+    StrategyGraph graph;
+    graph.nodes.push_back(makeNode({10, 20}));
+    graph.nodes.push_back(makeNode({10, 0}));
+    graph.nodes.push_back(makeNode({10, 0}));
+    graph.edges.push_back(makeEdge(0, 1, {0, 100, 100, 0}));
+    graph.edges.push_back(makeEdge(1, 2, {0, 100, 100, 0}));
+
+    const StrategyGraphSolver solver(graph);
+    EXPECT_TRUE(solver.getKernelNodes().empty());
+
+    const auto strategyInds = solver.solve();
+    EXPECT_EQ(strategyInds, SmallVector<size_t>({1, 1, 1}));
+    EXPECT_EQ(graph.getCost(strategyInds), 20);
+}
+
+TEST(MLIR_VPU_StrategyGraph, SeriesParallel) {
+    // Diamond with parallel edges is reduced completely
+    StrategyGraph graph;
+    for (size_t ind = 0; ind < 4; ++ind) {
+        graph.nodes.push_back(makeNode({5, 1, 3}));
+    }
+    const SmallVector<double> switchCosts = {0, 7, 7, 7, 0, 7, 7, 7, 0};
+    graph.edges.push_back(makeEdge(0, 1, switchCosts));
+    graph.edges.push_back(makeEdge(0, 2, switchCosts));
+    graph.edges.push_back(makeEdge(1, 3, switchCosts));
+    graph.edges.push_back(makeEdge(2, 3, switchCosts));
+    graph.edges.push_back(makeEdge(0, 3, switchCosts));
+
+    const StrategyGraphSolver solver(graph);
+    EXPECT_TRUE(solver.getKernelNodes().empty());
+    EXPECT_EQ(graph.getCost(solver.solve()), bruteForce(graph).first);
+}
+
+TEST(MLIR_VPU_StrategyGraph, Kernel) {
+    // Complete graph of four nodes can't be reduced
+    StrategyGraph graph;
+    for (size_t ind = 0; ind < 4; ++ind) {
+        graph.nodes.push_back(makeNode({1, 2}));
+    }
+    for (size_t src = 0; src < 4; ++src) {
+        for (size_t dst = src + 1; dst < 4; ++dst) {
+            graph.edges.push_back(makeEdge(src, dst, {3, 0, 0, 3}));
+        }
+    }
+
+    const StrategyGraphSolver solver(graph);
+    EXPECT_EQ(solver.getKernelNodes().size(), 4);
+    EXPECT_ANY_THROW(solver.solve());
+}
+
+TEST(MLIR_VPU_StrategyGraph, RandomGraphs) {
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<size_t> costDistribution(0, 100);
+
+    for (size_t iteration = 0; iteration < 500; ++iteration) {
+        StrategyGraph graph;
+        const auto numNodes = 1 + generator() % 7;
+        for (size_t node = 0; node < numNodes; ++node) {
+            SmallVector<double> costs(1 + generator() % 3);
+            for (auto& cost : costs) {
+                cost = costDistribution(generator);
+            }
+            graph.nodes.push_back(makeNode(costs));
+        }
+
+        const auto numEdges = generator() % (2 * numNodes + 1);
+        for (size_t edge = 0; edge < numEdges; ++edge) {
+            const auto src = generator() % numNodes;
+            const auto dst = generator() % numNodes;
+            SmallVector<double> costs(graph.nodes[src].costs.size() * graph.nodes[dst].costs.size());
+            for (auto& cost : costs) {
+                cost = costDistribution(generator);
+            }
+            graph.edges.push_back(makeEdge(src, dst, costs));
+        }
+
+        const auto [bestCost, bestInds] = bruteForce(graph);
+
+        // The remainder is assigned optimally for the optimal kernel assignment
+        const StrategyGraphSolver solver(graph);
+        StrategyGraphSolver::KernelAssignment kernelAssignment;
+        for (auto node : solver.getKernelNodes()) {
+            kernelAssignment[node] = bestInds[node];
+        }
+        EXPECT_EQ(graph.getCost(solver.solve(kernelAssignment)), bestCost);
+    }
+}
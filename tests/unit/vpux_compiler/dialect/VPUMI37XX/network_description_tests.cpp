@@ -0,0 +1,153 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/ELFNPU37XX/attributes.hpp"
+#include "vpux/compiler/dialect/VPUMI37XX/network_description.hpp"
+
+#include <vpux_headers/serial_metadata.hpp>
+
+#include <llvm/BinaryFormat/ELF.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/FileUtilities.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <openvino/core/partial_shape.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+void copyName(char* dst, const std::string& src) {
+    ASSERT_LT(src.size(), elf::MAX_STRING_LEN);
+    std::memcpy(dst, src.data(), src.size());
+    dst[src.size()] = '\0';
+}
+
+elf::OVNode makeNode(const std::string& name, const std::vector<uint64_t>& shape) {
+    elf::OVNode node{};
+    node.type = elf::OVNodeType::OVNodeType_F16;
+    copyName(node.friendly_name, name);
+    copyName(node.input_name, name);
+    node.tensor_names_count = 1;
+    copyName(node.tensor_names[0], name);
+    node.shape_size = static_cast<uint32_t>(shape.size());
+    std::copy(shape.begin(), shape.end(), node.shape);
+    return node;
+}
+
+template <typename T>
+void append(std::vector<uint8_t>& blob, const T& value) {
+    const auto offset = blob.size();
+    blob.resize(offset + sizeof(T));
+    std::memcpy(blob.data() + offset, &value, sizeof(T));
+}
+
+/*
+   ELF64 image with a large weights section followed by the serialized network metadata, the section header table is
+   at the end like in the compiled blobs
+*/
+std::vector<uint8_t> makeBlob(const std::vector<uint8_t>& metadata) {
+    std::vector<uint8_t> blob(sizeof(llvm::ELF::Elf64_Ehdr));
+    std::vector<llvm::ELF::Elf64_Shdr> headers(1);
+    std::memset(headers.data(), 0, sizeof(llvm::ELF::Elf64_Shdr));
+
+    const std::vector<uint8_t> weights(1024 * 1024, 0x5A);
+    const std::string names = std::string(1, '\0') + ".weights" + '\0' + ".metadata" + '\0' + ".shstrtab" + '\0';
+    const std::vector<std::pair<uint32_t, const std::vector<uint8_t>*>> sections = {
+            {llvm::ELF::SHT_PROGBITS, &weights},
+            {static_cast<uint32_t>(ELFNPU37XX::SectionTypeAttr::VPU_SHT_NETDESC), &metadata},
+    };
+    uint32_t nameOffset = 1;
+    for (const auto& section : sections) {
+        llvm::ELF::Elf64_Shdr header = {};
+        header.sh_name = nameOffset;
+        header.sh_type = section.first;
+        header.sh_offset = blob.size();
+        header.sh_size = section.second->size();
+        headers.push_back(header);
+
+        nameOffset += static_cast<uint32_t>(std::strlen(names.data() + nameOffset)) + 1;
+        blob.insert(blob.end(), section.second->begin(), section.second->end());
+    }
+
+    llvm::ELF::Elf64_Shdr namesHeader = {};
+    namesHeader.sh_name = nameOffset;
+    namesHeader.sh_type = llvm::ELF::SHT_STRTAB;
+    namesHeader.sh_offset = blob.size();
+    namesHeader.sh_size = names.size();
+    headers.push_back(namesHeader);
+    blob.insert(blob.end(), names.begin(), names.end());
+
+    llvm::ELF::Elf64_Ehdr elfHeader = {};
+    std::memcpy(elfHeader.e_ident, llvm::ELF::ElfMagic, std::strlen(llvm::ELF::ElfMagic));
+    elfHeader.e_ident[llvm::ELF::EI_CLASS] = llvm::ELF::ELFCLASS64;
+    elfHeader.e_ident[llvm::ELF::EI_DATA] = llvm::ELF::ELFDATA2LSB;
+    elfHeader.e_ident[llvm::ELF::EI_VERSION] = llvm::ELF::EV_CURRENT;
+    elfHeader.e_ehsize = sizeof(llvm::ELF::Elf64_Ehdr);
+    elfHeader.e_shoff = blob.size();
+    elfHeader.e_shentsize = sizeof(llvm::ELF::Elf64_Shdr);
+    elfHeader.e_shnum = static_cast<uint16_t>(headers.size());
+    elfHeader.e_shstrndx = static_cast<uint16_t>(headers.size() - 1);
+    std::memcpy(blob.data(), &elfHeader, sizeof(elfHeader));
+
+    for (const auto& header : headers) {
+        append(blob, header);
+    }
+    return blob;
+}
+
+std::vector<uint8_t> makeSerializedMetadata() {
+    elf::NetworkMetadata metadata{};
+    copyName(metadata.mIdentification.blob_name, "cached_network");
+    metadata.mOVParameters.push_back(makeNode("input", {1, 16, 8, 8}));
+    metadata.mOVResults.push_back(makeNode("output", {1, 16, 4, 4}));
+    metadata.mResourceRequirements.nn_slice_count_ = 2;
+
+    const auto serialized = elf::MetadataSerialization::serialize(metadata);
+    return std::vector<uint8_t>(serialized.begin(), serialized.end());
+}
+
+}  // namespace
+
+TEST(MLIR_NetworkDescription, MetadataFromFile) {
+    const auto blob = makeBlob(makeSerializedMetadata());
+
+    int fd = -1;
+    llvm::SmallString<128> blobPath;
+    ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("network_description", "blob", fd, blobPath));
+    llvm::FileRemover blobRemover(blobPath);
+    {
+        llvm::raw_fd_ostream blobFile(fd, /*shouldClose=*/true);
+        blobFile.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+    }
+
+    const auto fromFile = VPUMI37XX::getNetworkMetadataFromFile(blobPath);
+    EXPECT_EQ(fromFile.name, "cached_network");
+    EXPECT_EQ(fromFile.numStreams, 2);
+    ASSERT_EQ(fromFile.inputNames, std::vector<std::string>({"input"}));
+    ASSERT_EQ(fromFile.outputNames, std::vector<std::string>({"output"}));
+    EXPECT_EQ(fromFile.parameters.at("input").precision, ov::element::Type_t::f16);
+    EXPECT_EQ(fromFile.parameters.at("input").transposedShape, ov::PartialShape({1, 16, 8, 8}));
+    EXPECT_EQ(fromFile.results.at("output").transposedShape, ov::PartialShape({1, 16, 4, 4}));
+    EXPECT_EQ(fromFile.outputOrder.at("output"), 0);
+
+    // The mapped file gives the same result as the blob in memory
+    const auto fromMemory = VPUMI37XX::getNetworkMetadata(blob);
+    EXPECT_EQ(fromMemory.name, fromFile.name);
+    EXPECT_EQ(fromMemory.inputNames, fromFile.inputNames);
+    EXPECT_EQ(fromMemory.outputNames, fromFile.outputNames);
+}
+
+TEST(MLIR_NetworkDescription, MissingFileThrows) {
+    EXPECT_ANY_THROW(VPUMI37XX::getNetworkMetadataFromFile("nonexistent_directory/network.blob"));
+}
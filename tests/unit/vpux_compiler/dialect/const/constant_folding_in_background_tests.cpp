@@ -16,7 +16,11 @@
 #include <mlir/IR/Types.h>
 
 #include <gtest/gtest.h>
+
+#include <functional>
+#include <numeric>
 #include <thread>
+#include <tuple>
 
 using namespace vpux;
 using namespace std::chrono_literals;
@@ -200,4 +204,159 @@ TEST_F(ConstantFoldingInBackgroundUnit, EquivalenceRequest) {
     EXPECT_TRUE(cache.hasContent(contentAttr2));
 }
 
+TEST_F(ConstantFoldingInBackgroundUnit, CompressedTier) {
+    mlir::DialectRegistry registry;
+    vpux::registerDialects(registry);
+    vpux::registerCommonInterfaces(registry);
+
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    auto& cacheManager = Const::ConstantFoldingCacheManager::getInstance();
+    ASSERT_TRUE(cacheManager.addCache(&ctx));
+    auto& cache = cacheManager.get(&ctx);
+
+    const size_t numElements = 256;
+    const auto contentSize = numElements * sizeof(float);
+    cache.setMemoryUsageLimit(vpux::Byte(5 * contentSize / 2));
+    cache.setCompressedMemoryUsageLimit(vpux::Byte(16 * contentSize));
+    cache.enableStatisticsCollection();
+
+    const auto baseType = mlir::RankedTensorType::get({numElements}, mlir::Float32Type::get(&ctx));
+    std::vector<float> baseValues(numElements);
+    std::iota(baseValues.begin(), baseValues.end(), 0.0f);
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(baseValues));
+
+    // The longer transformation chains are more expensive to recompute, so the shortest one is evicted first
+    const auto shortChainAttr = Const::ContentAttr::get(baseAttr).rescale(2.0);
+    const auto longChainAttr = Const::ContentAttr::get(baseAttr).rescale(2.0).add(1.0).add(1.0);
+    const auto newAttr = Const::ContentAttr::get(baseAttr).add(3.0).rescale(2.0);
+
+    for (auto attr : {shortChainAttr, longChainAttr, newAttr}) {
+        cache.addContent(attr, attr.fold(/*bypassCache=*/true).copyUnownedBuffer());
+    }
+
+    EXPECT_EQ(cache.getStatistics().numElementsCompressed, 1);
+    EXPECT_GT(cache.getMemoryUsedCompressedCache(), 0);
+    EXPECT_TRUE(cache.hasContent(shortChainAttr));
+
+    const auto restoredContent = cache.getContent(shortChainAttr);
+    ASSERT_TRUE(restoredContent.has_value());
+    EXPECT_EQ(cache.getStatistics().numCompressedCacheHits, 1);
+
+    const auto restoredValues = restoredContent->getValues<float>();
+    ASSERT_EQ(restoredValues.size(), numElements);
+    for (size_t i = 0; i < numElements; ++i) {
+        EXPECT_EQ(restoredValues[i], 2.0f * baseValues[i]);
+    }
+
+    cacheManager.removeCache(&ctx);
+}
+
+TEST_F(ConstantFoldingInBackgroundUnit, CleanUpInBackground) {
+    mlir::DialectRegistry registry;
+    vpux::registerDialects(registry);
+    vpux::registerCommonInterfaces(registry);
+
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    auto& cacheManager = Const::ConstantFoldingCacheManager::getInstance();
+    ASSERT_TRUE(cacheManager.addCache(&ctx));
+    auto& cache = cacheManager.get(&ctx);
+
+    const size_t numElements = 256;
+    const auto contentSize = numElements * sizeof(float);
+    cache.setMemoryUsageLimit(vpux::Byte(3 * contentSize / 2));
+    cache.setCompressedMemoryUsageLimit(vpux::Byte(16 * contentSize));
+    cache.enableStatisticsCollection();
+
+    std::vector<std::function<void()>> backgroundTasks;
+    cache.setBackgroundTaskHandler([&](std::function<void()> task) {
+        backgroundTasks.push_back(std::move(task));
+    });
+
+    const auto baseType = mlir::RankedTensorType::get({numElements}, mlir::Float32Type::get(&ctx));
+    std::vector<float> baseValues(numElements);
+    std::iota(baseValues.begin(), baseValues.end(), 0.0f);
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(baseValues));
+
+    for (auto scale : {2.0, 3.0, 4.0}) {
+        const auto attr = Const::ContentAttr::get(baseAttr).rescale(scale);
+        cache.addContent(attr, attr.fold(/*bypassCache=*/true).copyUnownedBuffer());
+    }
+
+    // The thread adding the content only schedules the clean-up, once
+    EXPECT_EQ(backgroundTasks.size(), 1);
+    EXPECT_EQ(cache.getStatistics().numElementsCompressed, 0);
+    EXPECT_EQ(cache.getMemoryUsedCache(), 3 * contentSize);
+
+    backgroundTasks.front()();
+    EXPECT_EQ(cache.getStatistics().numElementsCompressed, 2);
+    EXPECT_EQ(cache.getMemoryUsedCache(), contentSize);
+
+    cache.setBackgroundTaskHandler(nullptr);
+    cacheManager.removeCache(&ctx);
+}
+
+
+TEST_F(ConstantFoldingInBackgroundUnit, ConcurrentCleanUpAndUpdates) {
+    mlir::DialectRegistry registry;
+    vpux::registerDialects(registry);
+    vpux::registerCommonInterfaces(registry);
+
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    auto& cacheManager = Const::ConstantFoldingCacheManager::getInstance();
+    ASSERT_TRUE(cacheManager.addCache(&ctx));
+    auto& cache = cacheManager.get(&ctx);
+
+    const size_t numElements = 256;
+    const auto contentSize = numElements * sizeof(float);
+    cache.setMemoryUsageLimit(vpux::Byte(4 * contentSize));
+    cache.setCompressedMemoryUsageLimit(vpux::Byte(8 * contentSize));
+
+    const auto baseType = mlir::RankedTensorType::get({numElements}, mlir::Float32Type::get(&ctx));
+    std::vector<float> baseValues(numElements);
+    std::iota(baseValues.begin(), baseValues.end(), 0.0f);
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(baseValues));
+
+    const size_t numThreads = 4;
+    const size_t numAttrsPerThread = 16;
+    std::vector<std::vector<std::pair<Const::ContentAttr, Const::Content>>> threadContents(numThreads);
+    for (size_t thread = 0; thread < numThreads; ++thread) {
+        for (size_t i = 0; i < numAttrsPerThread; ++i) {
+            const auto attr = Const::ContentAttr::get(baseAttr).rescale(static_cast<double>(thread * 100 + i + 1));
+            threadContents[thread].emplace_back(attr, attr.fold(/*bypassCache=*/true).copyUnownedBuffer());
+        }
+    }
+
+    // The clean-up runs synchronously on the threads which reach the memory limit and traverses the maps while the
+    // other threads insert and erase their entries
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < numThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (size_t iteration = 0; iteration < 8; ++iteration) {
+                for (const auto& [attr, content] : threadContents[thread]) {
+                    cache.addContent(attr, content);
+                }
+                for (const auto& [attr, content] : threadContents[thread]) {
+                    std::ignore = cache.getContent(attr);
+                    cache.removeContent(attr);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // An entry can be compressed by the clean-up of another thread right after its removal, so only the main cache
+    // is known to be empty
+    EXPECT_EQ(cache.getMemoryUsedCache(), 0);
+
+    cacheManager.removeCache(&ctx);
+}
+
 #endif
@@ -233,6 +233,47 @@ TEST_F(MLIR_ConstContentAttrTest, FromDenseResourceElementsAttrNonOwning) {
     }
 }
 
+TEST_F(MLIR_ConstContentAttrTest, FromPackedSubByteDenseResourceElementsAttr) {
+    const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, getUInt4Type(&ctx));
+    const auto numElems = baseType.getNumElements();
+
+    // Two elements per byte, the first one in the low bits, as stored in the OV constants
+    std::vector<uint8_t> unpackedVals(numElems);
+    std::vector<char> packedVals(numElems / 2);
+    for (int64_t i = 0; i < numElems; ++i) {
+        unpackedVals[i] = static_cast<uint8_t>((i * 7) % 16);
+        packedVals[i / 2] |= static_cast<char>(unpackedVals[i] << (4 * (i % 2)));
+    }
+
+    constexpr auto noop = [](char*, size_t, size_t) {};
+    constexpr bool isMutable = false;
+    mlir::AsmResourceBlob blob(mlir::ArrayRef<char>(packedVals), noop, isMutable);
+
+    auto& manager = mlir::DenseResourceElementsHandle::getManagerInterface(&ctx);
+    const auto baseAttr = mlir::DenseResourceElementsAttr::get(
+            baseType, manager.insert("FromPackedSubByteDenseResourceElementsAttr", std::move(blob)));
+
+    const auto contentAttr = Const::ContentAttr::get(baseAttr);
+    ASSERT_NE(contentAttr, nullptr);
+    EXPECT_EQ(contentAttr.getType(), baseType);
+    EXPECT_FALSE(contentAttr.isSplat());
+
+    // The elements are unpacked into one element per byte only when folded
+    const auto content = contentAttr.fold();
+    EXPECT_EQ(content.getType(), baseType);
+    EXPECT_EQ(content.getStorageElemType(), getUInt8Type(&ctx));
+
+    const auto contentVals = content.getValues<uint8_t>();
+    ASSERT_EQ(contentVals.size(), unpackedVals.size());
+    for (size_t i = 0; i < contentVals.size(); ++i) {
+        EXPECT_EQ(contentVals[i], unpackedVals[i]) << i;
+    }
+
+    std::vector<char> copiedVals(packedVals.size());
+    content.copyTo(MutableArrayRef(copiedVals.data(), copiedVals.size()));
+    EXPECT_EQ(copiedVals, packedVals);
+}
+
 TEST_F(MLIR_ConstContentAttrTest, FromSplatDenseResourceElementsAttr) {
     const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, mlir::Float32Type::get(&ctx));
     const float splatVal = 4.0f;
@@ -2517,3 +2558,55 @@ TEST_F(MLIR_ConstContentAttrTest, DequantizeQuantize) {
         EXPECT_EQ(contentVals[i], vals[i]);
     }
 }
+
+TEST_F(MLIR_ConstContentAttrTest, FusedTransformations) {
+    // Applies the transformations one by one, without the fusion
+    const auto foldSequentially = [](Const::ContentAttr contentAttr) {
+        auto content = Const::ContentAttr::get(contentAttr.getBaseContent()).fold();
+        for (const auto& attr : contentAttr.getTransformations()) {
+            content = attr.transform(content);
+        }
+        return content;
+    };
+
+    const auto checkFusedChain = [&](Const::ContentAttr contentAttr) {
+        const auto content = contentAttr.fold();
+        const auto expectedContent = foldSequentially(contentAttr);
+        EXPECT_EQ(content.getType(), expectedContent.getType());
+        EXPECT_EQ(content.getType(), contentAttr.getType());
+        EXPECT_FALSE(content.isSplat());
+
+        const auto contentVals = content.getValues<float>();
+        const auto expectedVals = expectedContent.getValues<float>();
+        ASSERT_EQ(contentVals.size(), expectedVals.size());
+        for (size_t i = 0; i < contentVals.size(); ++i) {
+            EXPECT_EQ(contentVals[i], expectedVals[i]) << i;
+        }
+    };
+
+    const auto u8Type = mlir::RankedTensorType::get({2, 4, 8, 16}, getUInt8Type(&ctx));
+    const auto u8Vals = generateValues<uint8_t>(u8Type.getNumElements());
+    const auto u8ContentAttr = Const::ContentAttr::get(mlir::DenseElementsAttr::get(u8Type, ArrayRef(u8Vals)));
+
+    const auto f32Type = mlir::RankedTensorType::get({2, 4, 8, 16}, mlir::Float32Type::get(&ctx));
+    const auto f32Vals = generateValues<float>(f32Type.getNumElements());
+    const auto f32ContentAttr = Const::ContentAttr::get(mlir::DenseElementsAttr::get(f32Type, ArrayRef(f32Vals)));
+
+    for (const auto& baseContentAttr : {u8ContentAttr, f32ContentAttr}) {
+        // Element-wise only
+        checkFusedChain(baseContentAttr.rescale(0.5).reshape(Shape({8, 128})).add(3.0).rescale(-1.5));
+
+        // Element-wise with index remapping, the trailing Reorder is applied separately
+        checkFusedChain(baseContentAttr.subview(Shape({0, 1, 2, 3}), Shape({2, 2, 4, 8}))
+                                .rescale(0.25)
+                                .reshape(Shape({2, 2, 32}))
+                                .add(-7.0)
+                                .subview(Shape({1, 0, 5}), Shape({1, 2, 20}))
+                                .reorder(DimsOrder::HCW));
+
+        // Index remapping only
+        checkFusedChain(baseContentAttr.subview(Shape({1, 0, 0, 0}), Shape({1, 4, 8, 16}))
+                                .reshape(Shape({32, 16}))
+                                .subview(Shape({3, 5}), Shape({20, 9})));
+    }
+}
@@ -0,0 +1,88 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/convert_elements.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace vpux;
+using vpux::type::float16;
+
+namespace {
+
+template <typename InT, typename OutT>
+void checkBitExact(mlir::MLIRContext* ctx, const std::vector<InT>& inVals, size_t expectedClampedCount) {
+    std::vector<OutT> actual(inVals.size());
+    const auto clampedCount = Const::details::convertElementsParallel(ctx, ArrayRef<InT>(inVals),
+                                                                      MutableArrayRef<OutT>(actual));
+    EXPECT_EQ(clampedCount, expectedClampedCount);
+
+    for (size_t i = 0; i < inVals.size(); ++i) {
+        size_t dummy = 0;
+        const auto expected = Const::details::SaturateCvtHelper<OutT>::cvt(inVals[i], dummy);
+        EXPECT_EQ(std::memcmp(&expected, &actual[i], sizeof(OutT)), 0) << "Mismatch at index " << i;
+    }
+}
+
+}  // namespace
+
+TEST(MLIR_ConvertElementsTests, F32ToF16) {
+    mlir::MLIRContext ctx;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+
+    std::vector<float> inVals(100003);
+    for (auto& val : inVals) {
+        val = dist(gen);
+    }
+
+    // Special values, including the ones which are converted by the scalar fallback
+    inVals[0] = 65519.0f;
+    inVals[1] = 65520.0f;
+    inVals[2] = -100000.0f;
+    inVals[3] = std::numeric_limits<float>::infinity();
+    inVals[4] = std::numeric_limits<float>::quiet_NaN();
+    inVals[5] = 1e-6f;
+    inVals[6] = -0.0f;
+    inVals[7] = std::numeric_limits<float>::denorm_min();
+
+    checkBitExact<float, float16>(&ctx, inVals, 3);
+}
+
+TEST(MLIR_ConvertElementsTests, F16ToF32) {
+    mlir::MLIRContext ctx;
+
+    // All the possible FP16 values, including denormals, infinities and NaNs
+    std::vector<float16> inVals(std::numeric_limits<uint16_t>::max() + 1);
+    for (size_t i = 0; i < inVals.size(); ++i) {
+        inVals[i] = float16::from_bits(static_cast<uint16_t>(i));
+    }
+
+    checkBitExact<float16, float>(&ctx, inVals, 0);
+}
+
+TEST(MLIR_ConvertElementsTests, I8ToFloat) {
+    mlir::MLIRContext ctx;
+
+    std::vector<int8_t> signedVals(1027);
+    std::vector<uint8_t> unsignedVals(1027);
+    for (size_t i = 0; i < signedVals.size(); ++i) {
+        signedVals[i] = static_cast<int8_t>(i);
+        unsignedVals[i] = static_cast<uint8_t>(i);
+    }
+
+    checkBitExact<int8_t, float16>(&ctx, signedVals, 0);
+    checkBitExact<uint8_t, float16>(&ctx, unsignedVals, 0);
+    checkBitExact<int8_t, float>(&ctx, signedVals, 0);
+    checkBitExact<uint8_t, float>(&ctx, unsignedVals, 0);
+}
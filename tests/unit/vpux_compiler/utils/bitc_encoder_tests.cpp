@@ -0,0 +1,178 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/bitc/bitc.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+// Odd number of 64-byte blocks: several 16 KB chunks of the encoder plus a partial last one
+constexpr size_t INPUT_SIZE = 40002;
+
+enum class InputKind { Random, Ramp, Sparse, FP16Weights };
+enum class ConfigKind { NPU37XX, NPU40XX, NPU40XX_FP16, NPU40XX_Activations };
+
+std::string stringifyInputKind(InputKind kind) {
+    switch (kind) {
+    case InputKind::Random:
+        return "Random";
+    case InputKind::Ramp:
+        return "Ramp";
+    case InputKind::Sparse:
+        return "Sparse";
+    case InputKind::FP16Weights:
+        return "FP16Weights";
+    }
+    return "Unknown";
+}
+
+std::string stringifyConfigKind(ConfigKind kind) {
+    switch (kind) {
+    case ConfigKind::NPU37XX:
+        return "NPU37XX";
+    case ConfigKind::NPU40XX:
+        return "NPU40XX";
+    case ConfigKind::NPU40XX_FP16:
+        return "NPU40XX_FP16";
+    case ConfigKind::NPU40XX_Activations:
+        return "NPU40XX_Activations";
+    }
+    return "Unknown";
+}
+
+// std::mt19937 output is fixed by the standard, the distributions are not, so the bytes are taken directly
+std::vector<uint8_t> makeInput(InputKind kind) {
+    std::mt19937 gen(42);
+    std::vector<uint8_t> data(INPUT_SIZE);
+    switch (kind) {
+    case InputKind::Random:
+        for (auto& value : data) {
+            value = static_cast<uint8_t>(gen());
+        }
+        break;
+    case InputKind::Ramp:
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(i / 16);
+        }
+        break;
+    case InputKind::Sparse:
+        for (auto& value : data) {
+            const auto rand = gen();
+            value = (rand % 8 == 0) ? static_cast<uint8_t>(rand >> 8) : 0;
+        }
+        break;
+    case InputKind::FP16Weights:
+        // Small values of both signs: the exponent varies in a narrow range, the mantissa is random
+        for (size_t i = 0; i + 1 < data.size(); i += 2) {
+            const auto rand = gen();
+            const uint16_t sign = (rand & 1) << 15;
+            const uint16_t exponent = (11 + (rand >> 1) % 5) << 10;
+            const uint16_t mantissa = (rand >> 4) & 0x3FF;
+            const uint16_t value = sign | exponent | mantissa;
+            data[i] = static_cast<uint8_t>(value & 0xFF);
+            data[i + 1] = static_cast<uint8_t>(value >> 8);
+        }
+        break;
+    }
+    return data;
+}
+
+bitc::BitCompactorConfig makeConfig(ConfigKind kind) {
+    bitc::BitCompactorConfig config;
+    config.arch_type = kind == ConfigKind::NPU37XX ? bitc::ArchType::NPU27 : bitc::ArchType::NPU4;
+    config.mode_fp16_enable = kind == ConfigKind::NPU40XX_FP16;
+    config.weight_compress_enable = kind != ConfigKind::NPU40XX_Activations;
+    return config;
+}
+
+// FNV-1a, the golden values are the size and the digest of the output of the original sequential encoder
+uint64_t getDigest(const std::vector<uint8_t>& data) {
+    uint64_t digest = 0xcbf29ce484222325ull;
+    for (auto value : data) {
+        digest = (digest ^ value) * 0x100000001b3ull;
+    }
+    return digest;
+}
+
+struct Golden {
+    ConfigKind config;
+    InputKind input;
+    size_t size;
+    uint64_t digest;
+};
+
+const Golden goldens[] = {
+    {ConfigKind::NPU37XX, InputKind::Random, 40160, 0x3b7e43de996cf49cull},
+    {ConfigKind::NPU37XX, InputKind::Ramp, 16384, 0xa2482f19a9ea8485ull},
+    {ConfigKind::NPU37XX, InputKind::Sparse, 15872, 0xc9ec9f66af73c97aull},
+    {ConfigKind::NPU37XX, InputKind::FP16Weights, 40160, 0xbb665bdccf05e443ull},
+    {ConfigKind::NPU40XX, InputKind::Random, 40640, 0xfd02d6109a3a58acull},
+    {ConfigKind::NPU40XX, InputKind::Ramp, 16864, 0xe9f093c252b13ec9ull},
+    {ConfigKind::NPU40XX, InputKind::Sparse, 20768, 0x0c65217ee93ef920ull},
+    {ConfigKind::NPU40XX, InputKind::FP16Weights, 40640, 0x993128a4ac56829eull},
+    {ConfigKind::NPU40XX_FP16, InputKind::Random, 40640, 0x291fdf7fd2f44057ull},
+    {ConfigKind::NPU40XX_FP16, InputKind::Ramp, 19072, 0x3cc87dc7851c400dull},
+    {ConfigKind::NPU40XX_FP16, InputKind::Sparse, 20800, 0x8bc5478f5d206118ull},
+    {ConfigKind::NPU40XX_FP16, InputKind::FP16Weights, 36288, 0x61b4679653831008ull},
+    {ConfigKind::NPU40XX_Activations, InputKind::Random, 40640, 0xfd02d6109a3a58acull},
+    {ConfigKind::NPU40XX_Activations, InputKind::Ramp, 16864, 0xe9f093c252b13ec9ull},
+    {ConfigKind::NPU40XX_Activations, InputKind::Sparse, 20768, 0x0c65217ee93ef920ull},
+    {ConfigKind::NPU40XX_Activations, InputKind::FP16Weights, 40640, 0x993128a4ac56829eull},
+};
+
+void runParallel(size_t count, const std::function<void(size_t)>& body) {
+    const auto numThreads = std::min<size_t>(count, 4);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (size_t thread = 0; thread < numThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (size_t ind = thread; ind < count; ind += numThreads) {
+                body(ind);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
+class MLIR_BitCompactorEncoderTest : public testing::TestWithParam<Golden> {};
+
+TEST_P(MLIR_BitCompactorEncoderTest, MatchesGolden) {
+    const auto& golden = GetParam();
+    const auto config = makeConfig(golden.config);
+    const auto input = makeInput(golden.input);
+
+    std::vector<uint8_t> sequentialOut;
+    bitc::Encoder sequentialEncoder;
+    sequentialEncoder.encode(config, input, sequentialOut);
+    EXPECT_EQ(sequentialOut.size(), golden.size);
+    EXPECT_EQ(getDigest(sequentialOut), golden.digest);
+
+    // The chunks are encoded in separate streams, the result must not depend on the order they are run in
+    std::vector<uint8_t> parallelOut;
+    bitc::Encoder parallelEncoder(runParallel);
+    parallelEncoder.encode(config, input, parallelOut);
+    EXPECT_EQ(parallelOut, sequentialOut);
+}
+
+INSTANTIATE_TEST_SUITE_P(Encoder, MLIR_BitCompactorEncoderTest, testing::ValuesIn(goldens),
+                         [](const testing::TestParamInfo<Golden>& info) {
+                             return stringifyConfigKind(info.param.config) + "_" +
+                                    stringifyInputKind(info.param.input);
+                         });
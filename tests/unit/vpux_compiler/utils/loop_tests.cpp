@@ -0,0 +1,93 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/loop.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+void checkVisitedOnce(const std::vector<std::atomic<int>>& visits) {
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+}  // namespace
+
+TEST(MLIR_LoopTests, GrainSize) {
+    // Unknown cost: balance the iterations between the threads
+    EXPECT_EQ(details::getLoopGrainSize(16, 8, LOOP_COST_UNKNOWN), 1);
+    EXPECT_EQ(details::getLoopGrainSize(3200, 8, LOOP_COST_UNKNOWN), 100);
+
+    // Cheap iterations are grouped into bigger chunks
+    EXPECT_EQ(details::getLoopGrainSize(3200, 8, 1), 16 * 1024);
+    EXPECT_EQ(details::getLoopGrainSize(3200, 8, 1024), 100);
+}
+
+TEST(MLIR_LoopTests, AllIndicesVisitedOnce) {
+    mlir::MLIRContext ctx;
+
+    for (const auto costHint : {LOOP_COST_UNKNOWN, int64_t(1), int64_t(1024)}) {
+        std::vector<std::atomic<int>> visits1d(1000);
+        loop_1d(
+                LoopExecPolicy::Parallel, &ctx, 1000,
+                [&](int64_t i) {
+                    ++visits1d[i];
+                },
+                costHint);
+        checkVisitedOnce(visits1d);
+
+        std::vector<std::atomic<int>> visits2d(7 * 13);
+        loop_2d(
+                LoopExecPolicy::Parallel, &ctx, 7, 13,
+                [&](int64_t i0, int64_t i1) {
+                    ++visits2d[i0 * 13 + i1];
+                },
+                costHint);
+        checkVisitedOnce(visits2d);
+
+        std::vector<std::atomic<int>> visits3d(5 * 3 * 11);
+        loop_3d(
+                LoopExecPolicy::Parallel, &ctx, 5, 3, 11,
+                [&](int64_t i0, int64_t i1, int64_t i2) {
+                    ++visits3d[(i0 * 3 + i1) * 11 + i2];
+                },
+                costHint);
+        checkVisitedOnce(visits3d);
+
+        std::vector<std::atomic<int>> visits4d(2 * 9 * 4 * 6);
+        loop_4d(
+                LoopExecPolicy::Parallel, &ctx, 2, 9, 4, 6,
+                [&](int64_t i0, int64_t i1, int64_t i2, int64_t i3) {
+                    ++visits4d[((i0 * 9 + i1) * 4 + i2) * 6 + i3];
+                },
+                costHint);
+        checkVisitedOnce(visits4d);
+    }
+}
+
+TEST(MLIR_LoopTests, NestedParallelLoops) {
+    mlir::MLIRContext ctx;
+
+    constexpr int64_t OUTER = 64;
+    constexpr int64_t INNER = 256;
+    std::vector<std::atomic<int>> visits(OUTER * INNER);
+
+    loop_1d(LoopExecPolicy::Parallel, &ctx, OUTER, [&](int64_t outer) {
+        loop_1d(LoopExecPolicy::Parallel, &ctx, INNER, [&](int64_t inner) {
+            ++visits[outer * INNER + inner];
+        });
+    });
+
+    checkVisitedOnce(visits);
+}
@@ -0,0 +1,130 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/offline_placement.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace vpux;
+
+namespace {
+
+using Buffer = OfflinePlacement::Buffer;
+
+Buffer makeBuffer(AddressType size, size_t begin, size_t end, AddressType alignment = 1) {
+    Buffer buf;
+    buf.size = size;
+    buf.alignment = alignment;
+    buf.begin = begin;
+    buf.end = end;
+    return buf;
+}
+
+void checkPlacement(ArrayRef<Buffer> buffers, ArrayRef<AddressType> addresses, AddressType totalSize) {
+    ASSERT_EQ(buffers.size(), addresses.size());
+    for (size_t ind1 = 0; ind1 < buffers.size(); ++ind1) {
+        const auto& buf1 = buffers[ind1];
+        EXPECT_EQ(addresses[ind1] % buf1.alignment, 0);
+        EXPECT_LE(addresses[ind1] + buf1.size, totalSize);
+        if (buf1.fixedAddress.has_value()) {
+            EXPECT_EQ(addresses[ind1], buf1.fixedAddress.value());
+        }
+
+        for (size_t ind2 = ind1 + 1; ind2 < buffers.size(); ++ind2) {
+            const auto& buf2 = buffers[ind2];
+            const bool overlapsInTime = buf1.begin < buf2.end && buf2.begin < buf1.end;
+            const bool overlapsInMemory =
+                    addresses[ind1] < addresses[ind2] + buf2.size && addresses[ind2] < addresses[ind1] + buf1.size;
+            EXPECT_FALSE(overlapsInTime && overlapsInMemory) << "Buffers " << ind1 << " and " << ind2 << " overlap";
+        }
+    }
+}
+
+}  // namespace
+
+TEST(MLIR_OfflinePlacementTests, BetterThanScheduleOrder) {
+    // In schedule order the short living buffer 0 is placed below the buffer 1,
+    // and the hole it leaves is too small for the buffer 2
+    const SmallVector<Buffer> buffers = {makeBuffer(1, 0, 1), makeBuffer(1, 0, 3), makeBuffer(2, 1, 3)};
+
+    const auto addresses = OfflinePlacement(1024).place(buffers);
+    ASSERT_TRUE(addresses.has_value());
+    checkPlacement(buffers, addresses.value(), 1024);
+
+    const auto statistics = OfflinePlacement::getStatistics(buffers, addresses.value());
+    EXPECT_EQ(statistics.peakUsage, 3);
+    // Only the first step has a hole: buffer 0 is at the bottom and buffer 1 is above the buffer 2
+    EXPECT_DOUBLE_EQ(statistics.fragmentation, 1.0 / 9.0);
+}
+
+TEST(MLIR_OfflinePlacementTests, FixedAndReserved) {
+    SmallVector<Buffer> buffers = {makeBuffer(16, 0, 4), makeBuffer(32, 1, 3, 32), makeBuffer(8, 2, 5)};
+    buffers[0].fixedAddress = 16;
+
+    const SmallVector<std::pair<AddressType, AddressType>> reserved = {{0, 8}};
+    const auto addresses = OfflinePlacement(128, reserved).place(buffers);
+    ASSERT_TRUE(addresses.has_value());
+    checkPlacement(buffers, addresses.value(), 128);
+
+    EXPECT_EQ(addresses.value()[0], 16);
+    EXPECT_EQ(addresses.value()[1], 32);
+    // The gap between the reserved range and the fixed buffer is the best fit
+    EXPECT_EQ(addresses.value()[2], 8);
+}
+
+TEST(MLIR_OfflinePlacementTests, OutOfMemory) {
+    const SmallVector<Buffer> buffers = {makeBuffer(64, 0, 2), makeBuffer(65, 1, 3)};
+    EXPECT_FALSE(OfflinePlacement(128).place(buffers).has_value());
+
+    // Same buffers fit if they are not alive at the same time
+    const SmallVector<Buffer> disjointBuffers = {makeBuffer(64, 0, 1), makeBuffer(65, 1, 3)};
+    EXPECT_TRUE(OfflinePlacement(128).place(disjointBuffers).has_value());
+}
+
+TEST(MLIR_OfflinePlacementTests, RandomLiveRanges) {
+    constexpr AddressType totalSize = 1024 * 1024;
+    std::mt19937 generator(1);
+
+    for (size_t test = 0; test < 20; ++test) {
+        SmallVector<Buffer> buffers;
+        for (size_t ind = 0; ind < 100; ++ind) {
+            const size_t begin = generator() % 50;
+            const size_t end = begin + 1 + generator() % 10;
+            buffers.push_back(makeBuffer(1 + generator() % 4096, begin, end, 1 << (generator() % 7)));
+        }
+
+        const auto addresses = OfflinePlacement(totalSize).place(buffers);
+        ASSERT_TRUE(addresses.has_value());
+        checkPlacement(buffers, addresses.value(), totalSize);
+
+        // The search is deterministic
+        EXPECT_EQ(addresses.value(), OfflinePlacement(totalSize).place(buffers).value());
+
+        // The refinement never makes the placement worse
+        const auto initialAddresses = OfflinePlacement(totalSize).place(buffers, 0);
+        ASSERT_TRUE(initialAddresses.has_value());
+        EXPECT_LE(OfflinePlacement::getStatistics(buffers, addresses.value()).peakUsage,
+                  OfflinePlacement::getStatistics(buffers, initialAddresses.value()).peakUsage);
+    }
+}
+
+TEST(MLIR_OfflinePlacementTests, LongSchedule) {
+    constexpr AddressType totalSize = 64 * 1024 * 1024;
+    std::mt19937 generator(1);
+
+    // The live ranges of a long schedule are short compared to it, the placement only looks at the overlapping ones
+    SmallVector<Buffer> buffers;
+    for (size_t ind = 0; ind < 4096; ++ind) {
+        const size_t begin = ind / 4 + generator() % 8;
+        const size_t end = begin + 1 + generator() % 16;
+        buffers.push_back(makeBuffer(1 + generator() % 65536, begin, end, 64));
+    }
+
+    const auto addresses = OfflinePlacement(totalSize).place(buffers);
+    ASSERT_TRUE(addresses.has_value());
+    checkPlacement(buffers, addresses.value(), totalSize);
+}
@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/logging.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser/Parser.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Transforms/Passes.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <tuple>
+
+using namespace vpux;
+
+using MLIR_ParallelismReport = vpux::VPU::arch40xx::UnitTest;
+
+TEST_F(MLIR_ParallelismReport, LoggedAfterPipeline) {
+    constexpr llvm::StringLiteral inputIR = R"(
+        module @test {
+            func.func @foo(%arg0: tensor<1x8xf16>) -> tensor<1x8xf16> {
+                return %arg0 : tensor<1x8xf16>
+            }
+            func.func @main(%arg0: tensor<1x8xf16>) -> tensor<1x8xf16> {
+                %0 = call @foo(%arg0) : (tensor<1x8xf16>) -> tensor<1x8xf16>
+                return %0 : tensor<1x8xf16>
+            }
+        }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    testing::internal::CaptureStdout();
+    bool succeeded = false;
+    {
+        mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+        addParallelismReport(pm, Logger("test", LogLevel::Info));
+        pm.addPass(mlir::createSymbolDCEPass());
+        pm.addNestedPass<mlir::func::FuncOp>(mlir::createCanonicalizerPass());
+        pm.addPass(mlir::createSymbolDCEPass());
+        succeeded = mlir::succeeded(pm.run(module.get()));
+    }
+    const auto output = testing::internal::GetCapturedStdout();
+
+    ASSERT_TRUE(succeeded);
+    EXPECT_NE(output.find("Parallel fraction"), std::string::npos) << output;
+    EXPECT_NE(output.find("1 function-nested segments, 2 module-level sync points"), std::string::npos) << output;
+}
+
+TEST_F(MLIR_ParallelismReport, SilentBelowInfoLevel) {
+    constexpr llvm::StringLiteral inputIR = R"(
+        module @test {
+            func.func @main(%arg0: tensor<1x8xf16>) -> tensor<1x8xf16> {
+                return %arg0 : tensor<1x8xf16>
+            }
+        }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    testing::internal::CaptureStdout();
+    {
+        mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+        addParallelismReport(pm, Logger("test", LogLevel::Warning));
+        pm.addNestedPass<mlir::func::FuncOp>(mlir::createCanonicalizerPass());
+        std::ignore = pm.run(module.get());
+    }
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(output.find("Parallel fraction"), std::string::npos) << output;
+}
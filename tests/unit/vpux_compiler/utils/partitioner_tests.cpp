@@ -9,6 +9,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 using namespace vpux;
 
 TEST(MLIR_PartitionerTests, SimpleCases) {
@@ -245,3 +249,68 @@ TEST(MLIR_PartitionerTests, SimpleCases) {
         ASSERT_EQ(alloc.gaps()[0].end, 10);
     }
 }
+
+TEST(MLIR_PartitionerTests, IndexedBackendMatchesLinear) {
+    // Random traces of allocations, fixed allocations (as done for spilled buffers) and frees
+    // must produce the same addresses and gaps with both backends
+    constexpr AddressType totalSize = 4096;
+    const std::vector<AddressType> alignments = {1, 2, 16, 64};
+
+    std::mt19937 generator(1);
+    for (size_t trace = 0; trace < 50; ++trace) {
+        Partitioner linear(totalSize, Partitioner::Backend::Linear);
+        Partitioner indexed(totalSize, Partitioner::Backend::Indexed);
+
+        // (address, size)
+        std::vector<std::pair<AddressType, AddressType>> allocated;
+        std::vector<std::pair<AddressType, AddressType>> freed;
+        for (size_t step = 0; step < 500; ++step) {
+            const auto action = generator() % 8;
+            if (action < 4) {
+                const auto size = 1 + generator() % (generator() % 4 == 0 ? 1024 : 64);
+                const auto alignment = alignments[generator() % alignments.size()];
+                const auto dir = generator() % 2 == 0 ? Partitioner::Direction::Up : Partitioner::Direction::Down;
+
+                const auto addr = linear.alloc(size, alignment, dir);
+                ASSERT_EQ(indexed.alloc(size, alignment, dir), addr);
+                if (addr != InvalidAddress) {
+                    allocated.emplace_back(addr, size);
+                }
+            } else if (action < 7 && !allocated.empty()) {
+                const auto ind = generator() % allocated.size();
+                const auto [addr, size] = allocated[ind];
+                allocated.erase(allocated.begin() + ind);
+
+                linear.free(addr, size);
+                indexed.free(addr, size);
+                freed.emplace_back(addr, size);
+            } else if (!freed.empty()) {
+                const auto [addr, size] = freed.back();
+                freed.pop_back();
+
+                const auto isFree = [&](const Partitioner::Gap& gap) {
+                    return gap.begin <= addr && addr + size <= gap.end;
+                };
+                const auto gaps = linear.gaps();
+                if (std::none_of(gaps.begin(), gaps.end(), isFree)) {
+                    continue;
+                }
+
+                linear.allocFixed(addr, size);
+                indexed.allocFixed(addr, size);
+                allocated.emplace_back(addr, size);
+            }
+
+            const auto linearGaps = linear.gaps();
+            const auto indexedGaps = indexed.gaps();
+            ASSERT_EQ(linearGaps.size(), indexedGaps.size());
+            ASSERT_EQ(linear.numGaps(), indexed.numGaps());
+            for (size_t i = 0; i < linearGaps.size(); ++i) {
+                ASSERT_EQ(linearGaps[i].begin, indexedGaps[i].begin);
+                ASSERT_EQ(linearGaps[i].end, indexedGaps[i].end);
+            }
+            ASSERT_EQ(linear.totalFreeSize(), indexed.totalFreeSize());
+            ASSERT_EQ(linear.maxFreeSize(), indexed.maxFreeSize());
+        }
+    }
+}
@@ -0,0 +1,220 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/priority_executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+// Occupies the only worker of the executor until `release` is called
+class WorkerBlocker final {
+public:
+    explicit WorkerBlocker(PriorityExecutor& executor) {
+        std::promise<void> started;
+        auto startedFuture = started.get_future();
+        executor.submit(
+                [started = std::make_shared<std::promise<void>>(std::move(started)),
+                 released = _release.get_future().share()]() {
+                    started->set_value();
+                    released.wait();
+                },
+                TaskPriority::Foreground);
+        startedFuture.wait();
+    }
+
+    void release() {
+        _release.set_value();
+    }
+
+private:
+    std::promise<void> _release;
+};
+
+}  // namespace
+
+TEST(MLIR_PriorityExecutorTests, AllTasksExecuted) {
+    PriorityExecutor executor(4, 1);
+
+    std::atomic<int> numExecuted{0};
+    std::vector<PriorityExecutor::TaskId> ids;
+    for (size_t i = 0; i < 100; ++i) {
+        const auto priority = i % 2 == 0 ? TaskPriority::Foreground : TaskPriority::Background;
+        ids.push_back(executor.submit(
+                [&]() {
+                    ++numExecuted;
+                },
+                priority));
+    }
+
+    for (auto id : ids) {
+        executor.runOrWait(id);
+    }
+
+    EXPECT_EQ(numExecuted.load(), 100);
+    EXPECT_EQ(executor.getQueueDepth(), 0);
+
+    const auto statistics = executor.getStatistics();
+    EXPECT_EQ(statistics.numForegroundTasks, 50);
+    EXPECT_EQ(statistics.numBackgroundTasks, 50);
+}
+
+TEST(MLIR_PriorityExecutorTests, BackgroundTasksUseAllWorkers) {
+    constexpr size_t numWorkers = 4;
+    PriorityExecutor executor(numWorkers, 1);
+
+    // Either the workers have the idle priority or all of them fall back to the normal one, in both cases the
+    // background tasks are not limited to a single worker
+    std::atomic<size_t> numStarted{0};
+    std::promise<void> released;
+    auto releasedFuture = released.get_future().share();
+    std::vector<PriorityExecutor::TaskId> ids;
+    for (size_t i = 0; i < numWorkers; ++i) {
+        ids.push_back(executor.submit(
+                [&numStarted, releasedFuture]() {
+                    ++numStarted;
+                    releasedFuture.wait();
+                },
+                TaskPriority::Background));
+    }
+
+    while (numStarted.load() != numWorkers) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(executor.getQueueDepth(), 0);
+
+    released.set_value();
+    for (auto id : ids) {
+        executor.runOrWait(id);
+    }
+    EXPECT_EQ(executor.getStatistics().numTasksRunByWaiter, 0);
+}
+
+TEST(MLIR_PriorityExecutorTests, ForegroundFirst) {
+    PriorityExecutor executor(1, 1);
+    WorkerBlocker blocker(executor);
+
+    std::mutex mutex;
+    std::vector<int> order;
+    const auto makeTask = [&](int value) {
+        return [&, value]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(value);
+        };
+    };
+
+    executor.submit(makeTask(3), TaskPriority::Background);
+    const auto promotedId = executor.submit(makeTask(2), TaskPriority::Background);
+    executor.submit(makeTask(1), TaskPriority::Foreground);
+    const auto lastId = executor.submit(makeTask(4), TaskPriority::Background);
+    EXPECT_EQ(executor.getQueueDepth(), 4);
+
+    EXPECT_TRUE(executor.promote(promotedId));
+    EXPECT_FALSE(executor.promote(promotedId));
+
+    blocker.release();
+    while (executor.getQueueDepth() != 0) {
+        std::this_thread::yield();
+    }
+    executor.runOrWait(lastId);
+
+    EXPECT_EQ(order, std::vector<int>({1, 2, 3, 4}));
+    EXPECT_EQ(executor.getStatistics().numPromotedTasks, 1);
+    EXPECT_EQ(executor.getStatistics().maxQueueDepth, 4);
+}
+
+TEST(MLIR_PriorityExecutorTests, RunQueuedTaskByWaiter) {
+    PriorityExecutor executor(1, 1);
+    WorkerBlocker blocker(executor);
+
+    std::thread::id executorThread;
+    const auto id = executor.submit(
+            [&]() {
+                executorThread = std::this_thread::get_id();
+            },
+            TaskPriority::Background);
+
+    // The only worker is busy, so the task is executed by the waiting thread
+    executor.runOrWait(id);
+    EXPECT_EQ(executorThread, std::this_thread::get_id());
+    EXPECT_EQ(executor.getStatistics().numTasksRunByWaiter, 1);
+
+    blocker.release();
+}
+
+TEST(MLIR_PriorityExecutorTests, CancelPending) {
+    PriorityExecutor executor(1, 1);
+    WorkerBlocker blocker(executor);
+
+    std::atomic<int> numExecuted{0};
+    for (size_t i = 0; i < 10; ++i) {
+        executor.submit(
+                [&]() {
+                    ++numExecuted;
+                },
+                TaskPriority::Background);
+    }
+
+    std::thread canceler([&]() {
+        executor.cancelPending();
+    });
+    while (executor.getQueueDepth() != 0) {
+        std::this_thread::yield();
+    }
+    blocker.release();
+    canceler.join();
+
+    EXPECT_EQ(numExecuted.load(), 0);
+    EXPECT_EQ(executor.getStatistics().numCanceledTasks, 10);
+}
+
+TEST(MLIR_PriorityExecutorTests, WaiterBoostsIdlePriorityWorker) {
+    PriorityExecutor executor(1, 1);
+
+    std::promise<void> started;
+    std::promise<void> released;
+    auto startedFuture = started.get_future();
+    const auto id = executor.submit(
+            [&, releasedFuture = released.get_future().share()]() {
+                started.set_value();
+                releasedFuture.wait();
+            },
+            TaskPriority::Background);
+    startedFuture.wait();
+
+    std::thread waiter([&]() {
+        executor.runOrWait(id);
+    });
+    if (executor.getNumIdlePriorityWorkers() != 0) {
+        // The task is running on the idle priority worker, so the waiter raises its priority
+        while (executor.getStatistics().numBoostedTasks == 0) {
+            std::this_thread::yield();
+        }
+    }
+    released.set_value();
+    waiter.join();
+
+    EXPECT_EQ(executor.getStatistics().numTasksRunByWaiter, 0);
+    EXPECT_EQ(executor.getStatistics().numBoostedTasks, executor.getNumIdlePriorityWorkers() != 0 ? 1 : 0);
+
+    // The worker is back at the idle priority and keeps executing tasks
+    std::atomic<int> numExecuted{0};
+    const auto nextId = executor.submit(
+            [&]() {
+                ++numExecuted;
+            },
+            TaskPriority::Background);
+    executor.runOrWait(nextId);
+    EXPECT_EQ(numExecuted.load(), 1);
+}
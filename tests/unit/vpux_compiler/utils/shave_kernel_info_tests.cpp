@@ -0,0 +1,146 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/act_kernels/shave_binary_resources.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+constexpr uint32_t ENTRY_POINT = 0x1E000;
+
+constexpr size_t ELF_HEADER_SIZE = 52;
+constexpr size_t SECTION_HEADER_SIZE = 40;
+
+constexpr uint32_t SHT_PROGBITS = 1;
+constexpr uint32_t SHT_STRTAB = 3;
+
+void write16(std::vector<uint8_t>& blob, size_t offset, uint16_t value) {
+    blob[offset] = static_cast<uint8_t>(value & 0xFF);
+    blob[offset + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+void write32(std::vector<uint8_t>& blob, size_t offset, uint32_t value) {
+    for (size_t i = 0; i < 4; ++i) {
+        blob[offset + i] = static_cast<uint8_t>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+struct SectionDesc {
+    std::string name;
+    uint32_t type;
+    std::vector<uint8_t> data;
+};
+
+/*
+   Little-endian ELF32 image with the given sections after the null one. The section name table is the last
+   section. The cache of ShaveBinaryResources is keyed by the address of the blob, so the blob has static storage
+   like the embedded kernels
+*/
+const std::vector<uint8_t>& getKernelBlob() {
+    static const std::vector<uint8_t> blob = [] {
+        std::vector<SectionDesc> sections = {
+                {"", 0, {}},
+                {".text", SHT_PROGBITS, {0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17}},
+                {".data", SHT_PROGBITS, {0x20, 0x21, 0x22, 0x23}},
+                {".rodata", SHT_PROGBITS, {0x30, 0x31}},
+                {".shstrtab", SHT_STRTAB, {}},
+        };
+
+        std::vector<uint32_t> nameOffsets;
+        auto& names = sections.back().data;
+        for (const auto& section : sections) {
+            nameOffsets.push_back(static_cast<uint32_t>(names.size()));
+            names.insert(names.end(), section.name.begin(), section.name.end());
+            names.push_back('\0');
+        }
+
+        std::vector<uint8_t> image(ELF_HEADER_SIZE);
+        std::vector<uint32_t> dataOffsets;
+        for (const auto& section : sections) {
+            dataOffsets.push_back(static_cast<uint32_t>(image.size()));
+            image.insert(image.end(), section.data.begin(), section.data.end());
+        }
+        image.resize((image.size() + 3) / 4 * 4);
+        const auto sectionHeadersOffset = image.size();
+        image.resize(sectionHeadersOffset + sections.size() * SECTION_HEADER_SIZE);
+
+        const std::array<uint8_t, 7> ident = {0x7F, 'E', 'L', 'F', /*ELFCLASS32*/ 1, /*ELFDATA2LSB*/ 1,
+                                              /*EV_CURRENT*/ 1};
+        std::memcpy(image.data(), ident.data(), ident.size());
+        write16(image, 16, /*ET_EXEC*/ 2);
+        write32(image, 20, /*EV_CURRENT*/ 1);
+        write32(image, 24, ENTRY_POINT);
+        write32(image, 32, static_cast<uint32_t>(sectionHeadersOffset));
+        write16(image, 40, static_cast<uint16_t>(ELF_HEADER_SIZE));
+        write16(image, 46, static_cast<uint16_t>(SECTION_HEADER_SIZE));
+        write16(image, 48, static_cast<uint16_t>(sections.size()));
+        write16(image, 50, static_cast<uint16_t>(sections.size() - 1));
+
+        for (size_t i = 1; i < sections.size(); ++i) {
+            const auto header = sectionHeadersOffset + i * SECTION_HEADER_SIZE;
+            write32(image, header, nameOffsets[i]);
+            write32(image, header + 4, sections[i].type);
+            write32(image, header + 16, dataOffsets[i]);
+            write32(image, header + 20, static_cast<uint32_t>(sections[i].data.size()));
+            write32(image, header + 32, 1);
+        }
+        return image;
+    }();
+    return blob;
+}
+
+}  // namespace
+
+TEST(MLIR_ShaveKernelInfo, EntryPointAndSections) {
+    const auto& blob = getKernelBlob();
+    const auto& info = ShaveBinaryResources::getInstance().getKernelInfo(blob);
+
+    EXPECT_EQ(info.entryPoint, ENTRY_POINT);
+
+    const auto text = info.getSection({".text"});
+    EXPECT_EQ(text.size(), 8);
+    EXPECT_EQ(text.front(), 0x10);
+    // The sections are views into the kernel binary
+    EXPECT_GE(text.data(), blob.data());
+    EXPECT_LE(text.data() + text.size(), blob.data() + blob.size());
+
+    // The kernel is parsed once
+    EXPECT_EQ(&ShaveBinaryResources::getInstance().getKernelInfo(blob), &info);
+}
+
+TEST(MLIR_ShaveKernelInfo, SectionNameAliases) {
+    const auto& info = ShaveBinaryResources::getInstance().getKernelInfo(getKernelBlob());
+
+    const auto data = info.getSection({".data.custom", ".data"});
+    ASSERT_EQ(data.size(), 4);
+    EXPECT_EQ(data.front(), 0x20);
+    EXPECT_EQ(data.data(), info.getSection({".data"}).data());
+}
+
+TEST(MLIR_ShaveKernelInfo, LastMatchingSectionWins) {
+    const auto& info = ShaveBinaryResources::getInstance().getKernelInfo(getKernelBlob());
+
+    // The section order in the ELF decides, not the order of the names
+    const auto section = info.getSection({".rodata", ".data"});
+    ASSERT_EQ(section.size(), 2);
+    EXPECT_EQ(section.front(), 0x30);
+    EXPECT_EQ(info.getSection({".data", ".text"}).front(), 0x20);
+}
+
+TEST(MLIR_ShaveKernelInfo, MissingSectionThrows) {
+    const auto& info = ShaveBinaryResources::getInstance().getKernelInfo(getKernelBlob());
+
+    EXPECT_ANY_THROW(info.getSection({".bss"}));
+    EXPECT_ANY_THROW(info.getSection({}));
+}
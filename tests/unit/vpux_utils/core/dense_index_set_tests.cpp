@@ -0,0 +1,82 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/core/dense_index_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace vpux;
+
+TEST(MLIR_DenseIndexSetTest, SimpleUsage) {
+    DenseIndexSet set(8);
+    EXPECT_TRUE(set.empty());
+
+    EXPECT_TRUE(set.insert(5));
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_FALSE(set.insert(5));
+    // Out of the initial capacity
+    EXPECT_TRUE(set.insert(100));
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_FALSE(set.contains(2));
+    EXPECT_FALSE(set.contains(1000));
+    EXPECT_EQ(std::vector<size_t>(set.begin(), set.end()), std::vector<size_t>({1, 5, 100}));
+
+    EXPECT_EQ(set.erase(5), 1);
+    EXPECT_EQ(set.erase(5), 0);
+    EXPECT_EQ(set.erase(1000), 0);
+    EXPECT_EQ(std::vector<size_t>(set.begin(), set.end()), std::vector<size_t>({1, 100}));
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(set.begin() == set.end());
+}
+
+TEST(MLIR_DenseIndexSetTest, ModifyDuringIteration) {
+    DenseIndexSet set(16);
+    for (size_t ind : {0, 3, 7, 12}) {
+        set.insert(ind);
+    }
+
+    // Same elements are visited as for std::set: the current one can be erased,
+    // elements inserted after the current position are visited, the ones before are not
+    std::vector<size_t> visited;
+    for (auto ind : set) {
+        visited.push_back(ind);
+        set.erase(ind);
+        if (ind == 3) {
+            set.insert(1);
+            set.insert(5);
+        }
+    }
+    EXPECT_EQ(visited, std::vector<size_t>({0, 3, 5, 7, 12}));
+    EXPECT_EQ(std::vector<size_t>(set.begin(), set.end()), std::vector<size_t>({1}));
+}
+
+TEST(MLIR_DenseIndexSetTest, CompareWithStdSet) {
+    constexpr size_t capacity = 300;
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<size_t> indDistribution(0, capacity - 1);
+
+    DenseIndexSet set(capacity);
+    std::set<size_t> refSet;
+    for (size_t iteration = 0; iteration < 10000; ++iteration) {
+        const auto ind = indDistribution(generator);
+        if (generator() % 2 == 0) {
+            EXPECT_EQ(set.insert(ind), refSet.insert(ind).second);
+        } else {
+            EXPECT_EQ(set.erase(ind), refSet.erase(ind));
+        }
+        EXPECT_EQ(set.size(), refSet.size());
+    }
+    EXPECT_EQ(std::vector<size_t>(set.begin(), set.end()), std::vector<size_t>(refSet.begin(), refSet.end()));
+}
@@ -0,0 +1,143 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/core/elf_section_lookup.hpp"
+
+#include <llvm/BinaryFormat/ELF.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+constexpr uint32_t SHT_CUSTOM = llvm::ELF::SHT_LOUSER + 1;
+
+struct SectionDesc final {
+    std::string name;
+    uint32_t type;
+    std::vector<uint8_t> data;
+};
+
+template <typename T>
+void append(std::vector<uint8_t>& blob, const T& value) {
+    const auto offset = blob.size();
+    blob.resize(offset + sizeof(T));
+    std::memcpy(blob.data() + offset, &value, sizeof(T));
+}
+
+// ELF64 image with the section contents first and the section header table at the end, like the compiled blobs
+std::vector<uint8_t> makeElf(const std::vector<SectionDesc>& sections) {
+    std::vector<uint8_t> blob(sizeof(llvm::ELF::Elf64_Ehdr));
+
+    std::vector<llvm::ELF::Elf64_Shdr> headers(1);
+    std::memset(headers.data(), 0, sizeof(llvm::ELF::Elf64_Shdr));
+
+    std::string names(1, '\0');
+    for (const auto& section : sections) {
+        llvm::ELF::Elf64_Shdr header = {};
+        header.sh_name = static_cast<uint32_t>(names.size());
+        header.sh_type = section.type;
+        header.sh_offset = blob.size();
+        header.sh_size = section.data.size();
+        headers.push_back(header);
+
+        names += section.name + '\0';
+        blob.insert(blob.end(), section.data.begin(), section.data.end());
+    }
+
+    llvm::ELF::Elf64_Shdr namesHeader = {};
+    namesHeader.sh_name = static_cast<uint32_t>(names.size());
+    namesHeader.sh_type = llvm::ELF::SHT_STRTAB;
+    names += ".shstrtab";
+    names += '\0';
+    namesHeader.sh_offset = blob.size();
+    namesHeader.sh_size = names.size();
+    headers.push_back(namesHeader);
+    blob.insert(blob.end(), names.begin(), names.end());
+
+    llvm::ELF::Elf64_Ehdr elfHeader = {};
+    std::memcpy(elfHeader.e_ident, llvm::ELF::ElfMagic, std::strlen(llvm::ELF::ElfMagic));
+    elfHeader.e_ident[llvm::ELF::EI_CLASS] = llvm::ELF::ELFCLASS64;
+    elfHeader.e_ident[llvm::ELF::EI_DATA] = llvm::ELF::ELFDATA2LSB;
+    elfHeader.e_ident[llvm::ELF::EI_VERSION] = llvm::ELF::EV_CURRENT;
+    elfHeader.e_ehsize = sizeof(llvm::ELF::Elf64_Ehdr);
+    elfHeader.e_shoff = blob.size();
+    elfHeader.e_shentsize = sizeof(llvm::ELF::Elf64_Shdr);
+    elfHeader.e_shnum = static_cast<uint16_t>(headers.size());
+    elfHeader.e_shstrndx = static_cast<uint16_t>(headers.size() - 1);
+    std::memcpy(blob.data(), &elfHeader, sizeof(elfHeader));
+
+    for (const auto& header : headers) {
+        append(blob, header);
+    }
+    return blob;
+}
+
+const std::vector<SectionDesc> sections = {
+        {".weights", llvm::ELF::SHT_PROGBITS, std::vector<uint8_t>(1000, 0xAB)},
+        {".metadata", SHT_CUSTOM, {1, 2, 3, 4, 5}},
+        {".empty", llvm::ELF::SHT_PROGBITS, {}},
+};
+
+}  // namespace
+
+TEST(MLIR_ElfSectionLookupTest, FindByType) {
+    const auto blob = makeElf(sections);
+
+    const auto metadata = findElfSectionByType(blob, SHT_CUSTOM);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(std::vector<uint8_t>(metadata->begin(), metadata->end()), sections[1].data);
+    // The result points into the blob, nothing is copied
+    EXPECT_EQ(metadata->data(), blob.data() + sizeof(llvm::ELF::Elf64_Ehdr) + sections[0].data.size());
+
+    const auto weights = findElfSectionByType(blob, llvm::ELF::SHT_PROGBITS);
+    ASSERT_TRUE(weights.has_value());
+    EXPECT_EQ(weights->size(), sections[0].data.size());
+
+    EXPECT_FALSE(findElfSectionByType(blob, llvm::ELF::SHT_LOUSER + 2).has_value());
+}
+
+TEST(MLIR_ElfSectionLookupTest, FindByName) {
+    const auto blob = makeElf(sections);
+
+    const auto metadata = findElfSectionByName(blob, ".metadata");
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(std::vector<uint8_t>(metadata->begin(), metadata->end()), sections[1].data);
+
+    const auto empty = findElfSectionByName(blob, ".empty");
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(empty->empty());
+
+    EXPECT_FALSE(findElfSectionByName(blob, ".meta").has_value());
+}
+
+TEST(MLIR_ElfSectionLookupTest, InvalidBlob) {
+    const auto blob = makeElf(sections);
+
+    // Section header table is cut off
+    const auto truncated = ArrayRef<uint8_t>(blob).drop_back(1);
+    EXPECT_ANY_THROW(findElfSectionByType(truncated, SHT_CUSTOM));
+
+    auto notElf = blob;
+    notElf[0] = 0;
+    EXPECT_ANY_THROW(findElfSectionByType(notElf, SHT_CUSTOM));
+
+    // Section content is out of the blob
+    auto badSection = blob;
+    llvm::ELF::Elf64_Ehdr elfHeader;
+    std::memcpy(&elfHeader, badSection.data(), sizeof(elfHeader));
+    const auto metadataHeaderOffset = elfHeader.e_shoff + 2 * sizeof(llvm::ELF::Elf64_Shdr);
+    llvm::ELF::Elf64_Shdr metadataHeader;
+    std::memcpy(&metadataHeader, badSection.data() + metadataHeaderOffset, sizeof(metadataHeader));
+    metadataHeader.sh_size = badSection.size();
+    std::memcpy(badSection.data() + metadataHeaderOffset, &metadataHeader, sizeof(metadataHeader));
+    EXPECT_ANY_THROW(findElfSectionByType(badSection, SHT_CUSTOM));
+    EXPECT_TRUE(findElfSectionByName(badSection, ".weights").has_value());
+}
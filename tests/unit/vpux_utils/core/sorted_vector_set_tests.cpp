@@ -0,0 +1,148 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/core/sorted_vector_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+using Set = SortedVectorSet<size_t, 4>;
+
+std::vector<size_t> toVector(const Set& set) {
+    return std::vector<size_t>(set.begin(), set.end());
+}
+
+std::vector<size_t> toVector(const std::set<size_t>& set) {
+    return std::vector<size_t>(set.begin(), set.end());
+}
+
+}  // namespace
+
+TEST(MLIR_SortedVectorSetTest, SimpleUsage) {
+    Set set;
+    EXPECT_TRUE(set.empty());
+
+    EXPECT_TRUE(set.insert(5).second);
+    EXPECT_TRUE(set.insert(1).second);
+    EXPECT_TRUE(set.insert(9).second);
+    const auto [pos, inserted] = set.insert(5);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(*pos, 5);
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_EQ(set.count(2), 0);
+    EXPECT_TRUE(set.find(2) == set.end());
+    EXPECT_EQ(*set.find(9), 9);
+    EXPECT_EQ(set.front(), 1);
+    EXPECT_EQ(set.back(), 9);
+
+    EXPECT_EQ(set.erase(5), 1);
+    EXPECT_EQ(set.erase(5), 0);
+    EXPECT_EQ(toVector(set), std::vector<size_t>({1, 9}));
+
+    set.erase(set.begin());
+    EXPECT_EQ(toVector(set), std::vector<size_t>({9}));
+
+    const std::vector<size_t> values = {7, 3, 9, 3, 12, 0};
+    set.insert(values.begin(), values.end());
+    EXPECT_EQ(toVector(set), std::vector<size_t>({0, 3, 7, 9, 12}));
+    EXPECT_EQ(set, Set({12, 9, 7, 3, 0}));
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(set.begin() == set.end());
+}
+
+TEST(MLIR_SortedVectorSetTest, SetOperations) {
+    Set set = {1, 3, 5, 7};
+
+    EXPECT_FALSE(set.merge(Set({3, 7})));
+    EXPECT_TRUE(set.merge(Set({0, 4, 8})));
+    EXPECT_EQ(toVector(set), std::vector<size_t>({0, 1, 3, 4, 5, 7, 8}));
+
+    EXPECT_FALSE(set.subtract(Set({2, 6})));
+    EXPECT_TRUE(set.subtract(Set({0, 5, 6, 8, 10})));
+    EXPECT_EQ(toVector(set), std::vector<size_t>({1, 3, 4, 7}));
+
+    EXPECT_FALSE(set.intersect(Set({0, 1, 3, 4, 7, 9})));
+    EXPECT_TRUE(set.intersect(Set({3, 7, 9})));
+    EXPECT_EQ(toVector(set), std::vector<size_t>({3, 7}));
+
+    // Operations with itself
+    EXPECT_FALSE(set.merge(set));
+    EXPECT_FALSE(set.intersect(set));
+    EXPECT_TRUE(set.subtract(set));
+    EXPECT_TRUE(set.empty());
+}
+
+TEST(MLIR_SortedVectorSetTest, CompareWithStdSet) {
+    constexpr size_t maxValue = 300;
+    std::mt19937 generator(1);
+
+    Set set;
+    std::set<size_t> refSet;
+    for (size_t iteration = 0; iteration < 2000; ++iteration) {
+        Set other;
+        std::set<size_t> refOther;
+        const auto otherSize = generator() % 50;
+        for (size_t ind = 0; ind < otherSize; ++ind) {
+            const auto val = generator() % maxValue;
+            other.insert(val);
+            refOther.insert(val);
+        }
+        ASSERT_EQ(toVector(other), toVector(refOther));
+
+        std::set<size_t> refResult;
+        switch (generator() % 5) {
+        case 0: {
+            const auto val = generator() % maxValue;
+            EXPECT_EQ(set.insert(val).second, refSet.insert(val).second);
+            break;
+        }
+        case 1: {
+            const auto val = generator() % maxValue;
+            EXPECT_EQ(set.erase(val), refSet.erase(val));
+            break;
+        }
+        case 2:
+            std::set_union(refSet.begin(), refSet.end(), refOther.begin(), refOther.end(),
+                           std::inserter(refResult, refResult.end()));
+            EXPECT_EQ(set.merge(other), refResult != refSet);
+            refSet = std::move(refResult);
+            break;
+        case 3:
+            std::set_difference(refSet.begin(), refSet.end(), refOther.begin(), refOther.end(),
+                                std::inserter(refResult, refResult.end()));
+            EXPECT_EQ(set.subtract(other), refResult != refSet);
+            refSet = std::move(refResult);
+            break;
+        default:
+            // Keep the set from getting empty too often
+            if (set.size() < 20) {
+                set.insert(other.begin(), other.end());
+                refSet.insert(refOther.begin(), refOther.end());
+                break;
+            }
+            std::set_intersection(refSet.begin(), refSet.end(), refOther.begin(), refOther.end(),
+                                  std::inserter(refResult, refResult.end()));
+            EXPECT_EQ(set.intersect(other), refResult != refSet);
+            refSet = std::move(refResult);
+            break;
+        }
+        ASSERT_EQ(toVector(set), toVector(refSet));
+    }
+}
@@ -0,0 +1,136 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/parser/api.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace vpux::profiling;
+
+namespace {
+
+// The name is truncated like the names of the tasks read from the blob
+TaskInfo makeTask(const std::string& name, const std::string& layerType, TaskInfo::ExecType execType,
+                  uint64_t startTime, uint64_t duration) {
+    TaskInfo task{};
+    const auto nameLen = name.copy(task.name, sizeof(task.name) - 1);
+    task.name[nameLen] = 0;
+    const auto typeLen = layerType.copy(task.layer_type, sizeof(task.layer_type) - 1);
+    task.layer_type[typeLen] = 0;
+    task.exec_type = execType;
+    task.start_time_ns = startTime;
+    task.duration_ns = duration;
+    return task;
+}
+
+const std::string LONG_LAYER_NAME = std::string(300, 'a');
+const std::string LONG_LAYER_NAME_PREFIX = std::string(250, 'b');
+
+/*
+   Tasks in the order getLayerInfo(blob, ...) aggregates them: DPU, DMA, SW and M2I engine lists one after another.
+   Each engine list is ordered by its own records, not by time
+*/
+std::vector<TaskInfo> getEngineOrderedTasks() {
+    using ExecType = TaskInfo::ExecType;
+    return {
+            // DPU
+            makeTask("conv?t_Convolution/cluster_1", "Convolution", ExecType::DPU, 130, 60),
+            makeTask("conv?t_Convolution/cluster_0", "Convolution", ExecType::DPU, 120, 50),
+            makeTask("conv?t_Convolution/cluster_0/variant_0", "Convolution", ExecType::DPU, 120, 20),
+            makeTask("pool?t_MaxPool/cluster_0", "MaxPool", ExecType::DPU, 400, 30),
+            // DMA
+            makeTask("pool?t_MaxPool/_output_cluster_0", "", ExecType::DMA, 440, 10),
+            makeTask("conv?t_Convolution/_input_cluster_0", "", ExecType::DMA, 20, 30),
+            makeTask(LONG_LAYER_NAME + "?t_Add/_input", "", ExecType::DMA, 200, 15),
+            // SW
+            makeTask(LONG_LAYER_NAME + "?t_Add/cluster_0", "Add", ExecType::SW, 230, 40),
+            makeTask(LONG_LAYER_NAME_PREFIX + "?t_Multiply/cluster_1", "Multiply", ExecType::SW, 300, 25),
+            makeTask(LONG_LAYER_NAME_PREFIX + "?t_Multiply/cluster_0", "Multiply", ExecType::SW, 290, 20),
+            makeTask(LONG_LAYER_NAME + "?t_Add/cluster_1", "Add", ExecType::SW, 225, 35),
+    };
+}
+
+// Tasks in the order getTaskInfo returns them
+std::vector<TaskInfo> getTimeOrderedTasks() {
+    auto tasks = getEngineOrderedTasks();
+    std::stable_sort(tasks.begin(), tasks.end(), [](const TaskInfo& a, const TaskInfo& b) {
+        return a.start_time_ns < b.start_time_ns;
+    });
+    return tasks;
+}
+
+void expectEqualLayers(const std::vector<LayerInfo>& actual, const std::vector<LayerInfo>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(std::string(actual[i].name), std::string(expected[i].name)) << "layer " << i;
+        EXPECT_EQ(std::string(actual[i].layer_type), std::string(expected[i].layer_type)) << "layer " << i;
+        EXPECT_EQ(actual[i].status, expected[i].status) << "layer " << i;
+        EXPECT_EQ(actual[i].start_time_ns, expected[i].start_time_ns) << "layer " << i;
+        EXPECT_EQ(actual[i].duration_ns, expected[i].duration_ns) << "layer " << i;
+        EXPECT_EQ(actual[i].dpu_ns, expected[i].dpu_ns) << "layer " << i;
+        EXPECT_EQ(actual[i].sw_ns, expected[i].sw_ns) << "layer " << i;
+        EXPECT_EQ(actual[i].dma_ns, expected[i].dma_ns) << "layer " << i;
+    }
+}
+
+}  // namespace
+
+TEST(MLIR_ProfilingLayerInfo, EngineOrderMatchesTimeOrder) {
+    const auto timeOrderedLayers = getLayerInfo(getTimeOrderedTasks());
+    const auto engineOrderedLayers = getLayerInfo(getEngineOrderedTasks());
+    expectEqualLayers(engineOrderedLayers, timeOrderedLayers);
+
+    auto reversedTasks = getTimeOrderedTasks();
+    std::reverse(reversedTasks.begin(), reversedTasks.end());
+    expectEqualLayers(getLayerInfo(reversedTasks), timeOrderedLayers);
+}
+
+TEST(MLIR_ProfilingLayerInfo, Statistics) {
+    const auto layers = getLayerInfo(getEngineOrderedTasks());
+    ASSERT_EQ(layers.size(), 4);
+
+    // The variant is skipped, the input DMA is the earliest task of the layer and gives its type
+    const auto& conv = layers[0];
+    EXPECT_EQ(std::string(conv.name), "conv");
+    EXPECT_EQ(std::string(conv.layer_type), "");
+    EXPECT_EQ(conv.status, LayerInfo::layer_status_t::EXECUTED);
+    EXPECT_EQ(conv.start_time_ns, 20);
+    EXPECT_EQ(conv.duration_ns, 170);
+    EXPECT_EQ(conv.dpu_ns, 110);
+    EXPECT_EQ(conv.dma_ns, 30);
+    EXPECT_EQ(conv.sw_ns, 0);
+
+    const auto& pool = layers[3];
+    EXPECT_EQ(std::string(pool.name), "pool");
+    EXPECT_EQ(std::string(pool.layer_type), "MaxPool");
+    EXPECT_EQ(pool.start_time_ns, 400);
+    EXPECT_EQ(pool.duration_ns, 50);
+    EXPECT_EQ(pool.dpu_ns, 30);
+    EXPECT_EQ(pool.dma_ns, 10);
+}
+
+TEST(MLIR_ProfilingLayerInfo, LongLayerNames) {
+    const auto layers = getLayerInfo(getEngineOrderedTasks());
+    ASSERT_EQ(layers.size(), 4);
+
+    // The task names lose the suffixes, all the tasks of the layer still make a single truncated layer
+    const auto& add = layers[1];
+    EXPECT_EQ(std::string(add.name), LONG_LAYER_NAME.substr(0, sizeof(add.name) - 1));
+    EXPECT_EQ(add.start_time_ns, 200);
+    EXPECT_EQ(add.duration_ns, 70);
+    EXPECT_EQ(add.dma_ns, 15);
+    EXPECT_EQ(add.sw_ns, 75);
+
+    // The name fits, the suffixes are cut in the middle
+    const auto& multiply = layers[2];
+    EXPECT_EQ(std::string(multiply.name), LONG_LAYER_NAME_PREFIX);
+    EXPECT_EQ(multiply.start_time_ns, 290);
+    EXPECT_EQ(multiply.duration_ns, 35);
+    EXPECT_EQ(multiply.sw_ns, 45);
+}
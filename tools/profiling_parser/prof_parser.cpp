@@ -9,8 +9,10 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 #include <gflags/gflags.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include <flatbuffers/minireflect.h>
 #include "schema/profiling_generated.h"
@@ -120,15 +122,15 @@ void dumpProfilingMetadata(const uint8_t* blobData, size_t blobSize, std::ostrea
     output << prettyProfilingMeta << std::endl;
 }
 
-std::vector<uint8_t> readBinaryFile(std::string path) {
-    std::ifstream file;
-    file.open(path, std::ios::in | std::ios::binary);
-    file.seekg(0, file.end);
-    size_t blob_length = file.tellg();
-    file.seekg(0, file.beg);
-    std::vector<uint8_t> data(blob_length);
-    file.read(reinterpret_cast<char*>(data.data()), data.size());
-    return data;
+// Large files are memory-mapped, so only the pages which are actually accessed by the parser are loaded
+std::unique_ptr<llvm::MemoryBuffer> readBinaryFile(const std::string& path) {
+    auto buffer = llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    VPUX_THROW_WHEN(!buffer, "Cannot read '{0}': {1}", path, buffer.getError().message());
+    return std::move(buffer.get());
+}
+
+const uint8_t* getData(const llvm::MemoryBuffer& buffer) {
+    return reinterpret_cast<const uint8_t*>(buffer.getBufferStart());
 }
 
 void writeProfilingOutput(const OutputFormat format, const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
@@ -177,15 +179,15 @@ int main(int argc, char** argv) {
             if (!FLAGS_p.empty()) {
                 throw std::runtime_error("Cannot use -p when -m is specified");
             }
-            dumpProfilingMetadata(blob.data(), blob.size(), output);
+            dumpProfilingMetadata(getData(*blob), blob->getBufferSize(), output);
             return 0;
         }
 
         auto profdata = readBinaryFile(FLAGS_p);
         auto format = getOutputFormat();
 
-        writeProfilingOutput(format, blob.data(), blob.size(), profdata.data(), profdata.size(), output, getVerbosity(),
-                             FLAGS_g, FLAGS_fast_clk);
+        writeProfilingOutput(format, getData(*blob), blob->getBufferSize(), getData(*profdata),
+                             profdata->getBufferSize(), output, getVerbosity(), FLAGS_g, FLAGS_fast_clk);
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         std::cerr << usage << std::endl;